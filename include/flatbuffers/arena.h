@@ -0,0 +1,220 @@
+/*
+ * Copyright 2019 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_ARENA_H_
+#define FLATBUFFERS_ARENA_H_
+
+#include "flatbuffers/base.h"
+
+namespace flatbuffers {
+
+// Support code for object API types generated with --cpp-arena.
+// Such types allocate their subobjects, strings and vectors from the Arena
+// that is current on the calling thread (see Arena::Scope), or from the heap
+// if there is none. UnPack() into an arena thus takes a handful of block
+// allocations instead of one per subobject, string and vector, and the whole
+// tree can be released at once.
+
+// A monotonic allocator: Allocate() bumps a pointer into a block of memory,
+// and nothing is released until Reset() or destruction. Not thread-safe.
+class Arena {
+ public:
+  // Alignment of all allocations.
+  static const size_t kAlignment = 16;
+
+  explicit Arena(size_t block_size = 4096)
+      : blocks_(nullptr), cur_(nullptr), end_(nullptr),
+        block_size_(block_size < 256 ? 256 : block_size), allocated_(0) {}
+
+  ~Arena() { Free(blocks_); }
+
+  void *Allocate(size_t size) {
+    size = (size + kAlignment - 1) & ~(kAlignment - 1);
+    if (static_cast<size_t>(end_ - cur_) < size) NewBlock(size);
+    auto p = cur_;
+    cur_ += size;
+    allocated_ += size;
+    return p;
+  }
+
+  // Makes all memory available again, keeping only the most recent (and
+  // largest) block. Objects allocated from this arena must be destroyed
+  // first. Alternatively, a tree that only owns arena memory (e.g. the result
+  // of UnPack() within a Scope) can simply be abandoned, which frees it in
+  // O(1) without running any destructors.
+  void Reset() {
+    if (!blocks_) return;
+    Free(blocks_->prev);
+    blocks_->prev = nullptr;
+    cur_ = BlockData(blocks_);
+    allocated_ = 0;
+  }
+
+  // Bytes handed out since construction or the last Reset().
+  size_t allocated() const { return allocated_; }
+
+  // Makes an arena current on this thread for the lifetime of the scope.
+  class Scope {
+   public:
+    explicit Scope(Arena *arena) : prev_(Current()) { Current() = arena; }
+    ~Scope() { Current() = prev_; }
+
+   private:
+    Scope(const Scope &);
+    Scope &operator=(const Scope &);
+
+    Arena *prev_;
+  };
+
+  // The arena current on this thread, or nullptr.
+  static Arena *current() { return Current(); }
+
+  // Used by the operator new and delete of generated types. An object
+  // remembers where it came from, so it can be deleted correctly after the
+  // scope has ended.
+  static void *New(size_t size) {
+    auto arena = Current();
+    auto p = static_cast<Arena **>(arena ? arena->Allocate(size + kAlignment)
+                                         : ::operator new(size + kAlignment));
+    *p = arena;
+    return reinterpret_cast<uint8_t *>(p) + kAlignment;
+  }
+
+  static void Delete(void *p) {
+    if (!p) return;
+    // Computed as an integer, or GCC warns that operator delete is given a
+    // pointer into an object, not seeing that it points back to its start.
+    auto header = reinterpret_cast<Arena **>(reinterpret_cast<uintptr_t>(p) -
+                                             kAlignment);
+    if (!*header) ::operator delete(header);
+  }
+
+ private:
+  Arena(const Arena &);
+  Arena &operator=(const Arena &);
+
+  struct Block {
+    Block *prev;
+    size_t size;
+  };
+
+  static Arena *&Current() {
+    static FLATBUFFERS_THREAD_LOCAL Arena *current = nullptr;
+    return current;
+  }
+
+  static uint8_t *BlockData(Block *block) {
+    return reinterpret_cast<uint8_t *>(block) + kAlignment;
+  }
+
+  void NewBlock(size_t size) {
+    // Each block is twice the size of the previous one, up to 1MB, so the
+    // number of blocks stays logarithmic in the total size.
+    auto block_size = block_size_;
+    if (block_size_ < (1 << 20)) block_size_ *= 2;
+    if (block_size < size) block_size = size;
+    auto block = static_cast<Block *>(::operator new(block_size + kAlignment));
+    block->prev = blocks_;
+    block->size = block_size;
+    blocks_ = block;
+    cur_ = BlockData(block);
+    end_ = cur_ + block_size;
+  }
+
+  static void Free(Block *block) {
+    while (block) {
+      auto prev = block->prev;
+      ::operator delete(block);
+      block = prev;
+    }
+  }
+
+  Block *blocks_;
+  uint8_t *cur_;
+  uint8_t *end_;
+  size_t block_size_;
+  size_t allocated_;
+};
+
+// A std allocator for the strings and vectors of generated types, using the
+// arena that was current when it was constructed, or the heap.
+template<typename T> class ArenaAllocator {
+ public:
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+  template<typename U> struct rebind { typedef ArenaAllocator<U> other; };
+
+  ArenaAllocator() : arena_(Arena::current()) {}
+  explicit ArenaAllocator(Arena *arena) : arena_(arena) {}
+  template<typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.arena()) {}
+
+  T *allocate(size_t n) {
+    auto size = n * sizeof(T);
+    return static_cast<T *>(arena_ ? arena_->Allocate(size)
+                                   : ::operator new(size));
+  }
+
+  void deallocate(T *p, size_t) {
+    if (!arena_) ::operator delete(p);
+  }
+
+  // Copies go to the arena current at the time of the copy, like new objects.
+  ArenaAllocator select_on_container_copy_construction() const {
+    return ArenaAllocator();
+  }
+
+  Arena *arena() const { return arena_; }
+
+ private:
+  Arena *arena_;
+};
+
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+  return a.arena() == b.arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+  return !(a == b);
+}
+
+// The object API string type with --cpp-arena.
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>
+    arena_string;
+
+// The object API type of strings in unions with --cpp-arena. Unions hold
+// their values by pointer, so the string itself is allocated from the arena
+// too, like the generated types.
+class ArenaUnionString : public arena_string {
+ public:
+  ArenaUnionString() {}
+  ArenaUnionString(const char *s, size_t size) : arena_string(s, size) {}
+  ArenaUnionString(const ArenaUnionString &other) : arena_string(other) {}
+  ArenaUnionString &operator=(const ArenaUnionString &other) {
+    arena_string::operator=(other);
+    return *this;
+  }
+
+  void *operator new(std::size_t count) { return Arena::New(count); }
+  void operator delete(void *ptr) { Arena::Delete(ptr); }
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_ARENA_H_
@@ -176,6 +176,12 @@
   #define FLATBUFFERS_NOEXCEPT
 #endif
 
+#if defined(_MSC_VER) && _MSC_VER < 1900
+  #define FLATBUFFERS_THREAD_LOCAL __declspec(thread)
+#else
+  #define FLATBUFFERS_THREAD_LOCAL thread_local
+#endif
+
 // NOTE: the FLATBUFFERS_DELETE_FUNC macro may change the access mode to
 // private, so be sure to put it at the end or reset access mode explicitly.
 #if (!defined(_MSC_VER) || _MSC_FULL_VER >= 180020827) && \
@@ -231,6 +237,30 @@
   #endif
 #endif  // !FLATBUFFERS_LOCALE_INDEPENDENT
 
+#ifndef FLATBUFFERS_VERIFIER_AVX2
+  // Let the Verifier check vectors of strings 8 elements at a time using
+  // AVX2 gathers, if the CPU it runs on supports them (checked at runtime).
+  // Define as 0 to always use the scalar code.
+  #if (FLATBUFFERS_GCC >= 40900 || FLATBUFFERS_CLANG >= 30800) && \
+      defined(__x86_64__)
+    #define FLATBUFFERS_VERIFIER_AVX2 1
+  #else
+    #define FLATBUFFERS_VERIFIER_AVX2 0
+  #endif
+#endif  // !FLATBUFFERS_VERIFIER_AVX2
+
+// Hint that memory at `addr` will be read soon. Used by the key lookups in
+// Vector to fetch the elements of the next few probes ahead of time.
+#if defined(__GNUC__) || defined(__clang__)
+  #define FLATBUFFERS_PREFETCH(addr) __builtin_prefetch(addr)
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+  #include <xmmintrin.h>
+  #define FLATBUFFERS_PREFETCH(addr) \
+    _mm_prefetch(reinterpret_cast<const char *>(addr), _MM_HINT_T0)
+#else
+  #define FLATBUFFERS_PREFETCH(addr) ((void)(addr))
+#endif
+
 // Suppress Undefined Behavior Sanitizer (recoverable only). Usage:
 // - __supress_ubsan__("undefined")
 // - __supress_ubsan__("signed-integer-overflow")
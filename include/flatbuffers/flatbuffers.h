@@ -23,6 +23,10 @@
 #include <cmath>
 #endif
 
+#if FLATBUFFERS_VERIFIER_AVX2
+#include <immintrin.h>
+#endif
+
 namespace flatbuffers {
 // Generic 'operator==' with conditional specialisations.
 template<typename T> inline bool IsTheSameAs(T e, T def) { return e == def; }
@@ -211,6 +215,29 @@ template<typename Iterator> struct VectorReverseIterator :
   Iterator iter_;
 };
 
+// 32bit FNV-1a over a range of bytes. Used to key the lookup tables the
+// builder keeps for serialized data it may want to share, and the hash
+// indices of vectors of tables (see FlatBufferBuilder::CreateHashIndex).
+inline uint32_t HashBytes(const uint8_t *data, size_t len) {
+  uint32_t hash = 0x811C9DC5;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+
+// Hash of the key of a table in a hash index. Scalars are hashed in their
+// wire (little endian) representation, so indices are portable.
+template<typename T> uint32_t HashKey(T key) {
+  key = EndianScalar(key);
+  return HashBytes(reinterpret_cast<const uint8_t *>(&key), sizeof(T));
+}
+
+inline uint32_t HashKey(const char *key) {
+  return HashBytes(reinterpret_cast<const uint8_t *>(key), strlen(key));
+}
+
 struct String;
 
 // This is used as a helper type for accessing vectors.
@@ -317,17 +344,71 @@ template<typename T> class Vector {
   const T *data() const { return reinterpret_cast<const T *>(Data()); }
   T *data() { return reinterpret_cast<T *>(Data()); }
 
+  // Binary search in a vector sorted by key (see
+  // FlatBufferBuilder::CreateVectorOfSortedTables). The loop doesn't branch
+  // on the comparisons, and prefetches the elements (tables) both possible
+  // next probes will look at.
   template<typename K> return_type LookupByKey(K key) const {
-    void *search_result = std::bsearch(
-        &key, Data(), size(), IndirectHelper<T>::element_stride, KeyCompare<K>);
-
-    if (!search_result) {
-      return nullptr;  // Key not found.
+    size_t n = size();
+    if (!n) return nullptr;
+    size_t base = 0;
+    while (n > 1) {
+      auto half = n / 2;
+      n -= half;
+      FLATBUFFERS_PREFETCH(Read(base + n / 2));
+      FLATBUFFERS_PREFETCH(Read(base + half + n / 2));
+      base = KeyCompare(base + half, key) < 0 ? base + half : base;
     }
-
-    const uint8_t *element = reinterpret_cast<const uint8_t *>(search_result);
-
-    return IndirectHelper<T>::Read(element, 0);
+    // `base` is now either the lower bound, or the element right before it.
+    auto comp = KeyCompare(base, key);
+    if (comp < 0 && ++base < size()) comp = KeyCompare(base, key);
+    return comp ? nullptr : Read(base);
+  }
+
+  // Lookup using the hash index of this vector (see
+  // FlatBufferBuilder::CreateHashIndex), in O(1). Without an index (e.g. in
+  // data from before it was added), this is the same as LookupByKey.
+  template<typename K>
+  return_type LookupByKeyHashed(const Vector<uint32_t> *index, K key) const {
+    if (!index || !index->size()) return LookupByKey(key);
+    // Slots hold the element index + 1, or 0 if empty.
+    auto num_slots = index->size();
+    auto slot = HashKey(key) & (num_slots - 1);
+    for (uoffset_t probes = 0; probes < num_slots; probes++) {
+      auto i = index->Get(slot);
+      if (!i) break;
+      if (i <= size() && !KeyCompare(i - 1, key)) return Read(i - 1);
+      slot = (slot + 1) & (num_slots - 1);
+    }
+    return nullptr;
+  }
+
+  // Like LookupByKey, but for a vector stored in Eytzinger (breadth-first
+  // binary tree) order by FlatBufferBuilder::CreateVectorOfEytzingerTables.
+  // Probes then go down the vector rather than jumping around it, and the
+  // elements 4 levels down the tree from a probe are next to each other, so
+  // they can be prefetched together, along with the tables of both children.
+  template<typename K> return_type LookupByKeyEytzinger(K key) const {
+    size_t n = size();
+    // 1-based tree index, the children of node i are 2i and 2i+1.
+    size_t i = 1;
+    while (i <= n) {
+      if (16 * i <= n) {
+        FLATBUFFERS_PREFETCH(Data() +
+                             (16 * i - 1) * IndirectHelper<T>::element_stride);
+      }
+      if (2 * i < n) {
+        FLATBUFFERS_PREFETCH(Read(2 * i - 1));
+        FLATBUFFERS_PREFETCH(Read(2 * i));
+      }
+      i = 2 * i + (KeyCompare(i - 1, key) < 0);
+    }
+    // Undo the right turns since the last left turn, which is the lower
+    // bound. Not finding a left turn means all elements are less than key.
+    while (i & 1) i >>= 1;
+    i >>= 1;
+    if (!i || KeyCompare(i - 1, key)) return nullptr;
+    return Read(i - 1);
   }
 
  protected:
@@ -342,14 +423,13 @@ template<typename T> class Vector {
   // Private and unimplemented copy constructor.
   Vector(const Vector &);
 
-  template<typename K> static int KeyCompare(const void *ap, const void *bp) {
-    const K *key = reinterpret_cast<const K *>(ap);
-    const uint8_t *data = reinterpret_cast<const uint8_t *>(bp);
-    auto table = IndirectHelper<T>::Read(data, 0);
+  return_type Read(size_t i) const {
+    return IndirectHelper<T>::Read(Data(), static_cast<uoffset_t>(i));
+  }
 
-    // std::bsearch compares with the operands transposed, so we negate the
-    // result here.
-    return -table->KeyCompareWithValue(*key);
+  // Compares element `i` with `key`, < 0 if the element is smaller.
+  template<typename K> int KeyCompare(size_t i, const K &key) const {
+    return Read(i)->KeyCompareWithValue(key);
   }
 };
 
@@ -418,6 +498,10 @@ struct String : public Vector<char> {
   }
 };
 
+inline uint32_t HashKey(const String *key) {
+  return HashBytes(key->Data(), key->size());
+}
+
 // Convenience function to get std::string from a String returning an empty
 // string on null pointer.
 static inline std::string GetString(const String * str) {
@@ -816,6 +900,15 @@ class vector_downward {
     scratch_ += sizeof(T);
   }
 
+  // Grows the scratchpad by `len` uninitialized bytes. Pointers obtained
+  // before this call are invalidated, since it may reallocate.
+  uint8_t *scratch_make_space(size_t len) {
+    ensure_space(len);
+    auto space = scratch_;
+    scratch_ += len;
+    return space;
+  }
+
   // fill() is most frequently called with small byte counts (<= 4),
   // which is why we're using loops rather than calling memset.
   void fill(size_t zero_pad_bytes) {
@@ -933,8 +1026,11 @@ class FlatBufferBuilder {
         minalign_(1),
         force_defaults_(false),
         dedup_vtables_(true),
+        num_vtable_slots_(0),
+        num_vtables_(0),
         string_pool(nullptr) {
     EndianCheck();
+    ClearVTables();
   }
 
   // clang-format off
@@ -952,8 +1048,11 @@ class FlatBufferBuilder {
       minalign_(1),
       force_defaults_(false),
       dedup_vtables_(true),
+      num_vtable_slots_(0),
+      num_vtables_(0),
       string_pool(nullptr) {
     EndianCheck();
+    ClearVTables();
     // Default construct and swap idiom.
     // Lack of delegating constructors in vs2010 makes it more verbose than needed.
     Swap(other);
@@ -984,6 +1083,11 @@ class FlatBufferBuilder {
     swap(minalign_, other.minalign_);
     swap(force_defaults_, other.force_defaults_);
     swap(dedup_vtables_, other.dedup_vtables_);
+    swap(num_vtable_slots_, other.num_vtable_slots_);
+    swap(num_vtables_, other.num_vtables_);
+    for (size_t i = 0; i < kNumFixedVTables; i++) {
+      swap(fixed_vtables_[i], other.fixed_vtables_[i]);
+    }
     swap(string_pool, other.string_pool);
   }
 
@@ -1000,6 +1104,7 @@ class FlatBufferBuilder {
   /// to construct another buffer.
   void Clear() {
     ClearOffsets();
+    ClearVTables();
     buf_.clear();
     nested = false;
     finished = false;
@@ -1030,6 +1135,7 @@ class FlatBufferBuilder {
   FLATBUFFERS_ATTRIBUTE(deprecated("use Release() instead")) DetachedBuffer
   ReleaseBufferPointer() {
     Finished();
+    ClearVTables();
     return buf_.release();
   }
 
@@ -1037,6 +1143,7 @@ class FlatBufferBuilder {
   /// @return A `DetachedBuffer` that owns the buffer and its allocator.
   DetachedBuffer Release() {
     Finished();
+    ClearVTables();
     return buf_.release();
   }
 
@@ -1050,6 +1157,7 @@ class FlatBufferBuilder {
   /// @remark If the allocator is owned, it gets deleted when the destructor is called..
   uint8_t *ReleaseRaw(size_t &size, size_t &offset) {
     Finished();
+    ClearVTables();
     return buf_.release_raw(size, offset);
   }
 
@@ -1225,25 +1333,22 @@ class FlatBufferBuilder {
       WriteScalar<voffset_t>(buf_.data() + field_location->id, pos);
     }
     ClearOffsets();
-    auto vt1 = reinterpret_cast<voffset_t *>(buf_.data());
+    auto vt1 = buf_.data();
     auto vt1_size = ReadScalar<voffset_t>(vt1);
     auto vt_use = GetSize();
     // See if we already have generated a vtable with this exact same
     // layout before. If so, make it point to the old one, remove this one.
     if (dedup_vtables_) {
-      for (auto it = buf_.scratch_data(); it < buf_.scratch_end();
-           it += sizeof(uoffset_t)) {
-        auto vt_offset_ptr = reinterpret_cast<uoffset_t *>(it);
-        auto vt2 = reinterpret_cast<voffset_t *>(buf_.data_at(*vt_offset_ptr));
-        auto vt2_size = *vt2;
-        if (vt1_size != vt2_size || 0 != memcmp(vt2, vt1, vt1_size)) continue;
-        vt_use = *vt_offset_ptr;
+      auto vt1_hash = HashBytes(vt1, vt1_size);
+      auto vt2_offset = FindVTable(vt1, vt1_size, vt1_hash);
+      if (vt2_offset) {
+        vt_use = vt2_offset;
         buf_.pop(GetSize() - vtableoffsetloc);
-        break;
+      } else {
+        // This is a new vtable, remember it.
+        AddVTable(vt_use, vt1_hash);
       }
     }
-    // If this is a new vtable, remember it.
-    if (vt_use == GetSize()) { buf_.scratch_push_small(vt_use); }
     // Fill the vtable offset we created above.
     // The offset points from the beginning of the object to where the
     // vtable is stored.
@@ -1262,6 +1367,63 @@ class FlatBufferBuilder {
     return EndTable(start);
   }
 
+  // Generated code uses StartFixedTable/EndFixedTable instead of the above
+  // when it knows the layout of a table in advance, which is the case when
+  // all its fields are present. This reserves and zeroes `size` bytes for the
+  // table (including its vtable offset) in one go, and returns a pointer to
+  // them, for the caller to write the fields into.
+  uint8_t *StartFixedTable(size_t size, size_t alignment) {
+    NotNested();
+    PreAlign(size, (std::max)(alignment, sizeof(soffset_t)));
+    buf_.fill_big(size);
+    return buf_.data();
+  }
+
+  // Stores an offset field at byte `field` of a table from StartFixedTable.
+  template<typename T>
+  void AddFixedOffset(uint8_t *table, voffset_t field, Offset<T> off) {
+    auto loc = GetSize() - field;
+    FLATBUFFERS_ASSERT(off.o && off.o <= loc);
+    WriteScalar<uoffset_t>(table + field, loc - off.o);
+  }
+
+  // Finishes a table from StartFixedTable, given its vtable in native
+  // endianness. The vtable must be static: its address is used to find the
+  // copy written for an earlier table, without comparing any bytes.
+  uoffset_t EndFixedTable(const voffset_t *vtable) {
+    auto table = GetSize();
+    uoffset_t vt_use = 0;
+    FixedVTable *cached = nullptr;
+    if (dedup_vtables_) {
+      cached = &fixed_vtables_[(reinterpret_cast<size_t>(vtable) /
+                                sizeof(voffset_t)) % kNumFixedVTables];
+      if (cached->vtable == vtable) vt_use = cached->off;
+    }
+    if (!vt_use) {
+      auto vt_size = vtable[0];
+      auto vt = buf_.make_space(vt_size);
+      for (size_t i = 0; i < vt_size / sizeof(voffset_t); i++) {
+        WriteScalar<voffset_t>(vt + i * sizeof(voffset_t), vtable[i]);
+      }
+      vt_use = GetSize();
+      if (cached) {
+        auto vt_hash = HashBytes(vt, vt_size);
+        auto vt2_offset = FindVTable(vt, vt_size, vt_hash);
+        if (vt2_offset) {
+          vt_use = vt2_offset;
+          buf_.pop(vt_size);
+        } else {
+          AddVTable(vt_use, vt_hash);
+        }
+        cached->vtable = vtable;
+        cached->off = vt_use;
+      }
+    }
+    WriteScalar(buf_.data_at(table),
+                static_cast<soffset_t>(vt_use) - static_cast<soffset_t>(table));
+    return table;
+  }
+
   // This checks a required field has been set in a given table that has
   // just been constructed.
   template<typename T> void Required(Offset<T> table, voffset_t field);
@@ -1279,6 +1441,18 @@ class FlatBufferBuilder {
     max_voffset_ = 0;
   }
 
+  // Forgets all vtables written so far, such that they won't be shared with
+  // tables created afterwards. Only the bookkeeping is reset, the caller is
+  // responsible for also clearing the scratch pad of buf_.
+  void ClearVTables() {
+    num_vtable_slots_ = 0;
+    num_vtables_ = 0;
+    for (size_t i = 0; i < kNumFixedVTables; i++) {
+      fixed_vtables_[i].vtable = nullptr;
+      fixed_vtables_[i].off = 0;
+    }
+  }
+
   // Aligns such that when "len" bytes are written, an object can be written
   // after it with "alignment" without padding.
   void PreAlign(size_t len, size_t alignment) {
@@ -1358,21 +1532,19 @@ class FlatBufferBuilder {
   /// @param[in] len The number of bytes that should be stored from `str`.
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateSharedString(const char *str, size_t len) {
-    if (!string_pool)
-      string_pool = new StringOffsetMap(StringOffsetCompare(buf_));
-    auto size_before_string = buf_.size();
-    // Must first serialize the string, since the set is all offsets into
-    // buffer.
-    auto off = CreateString(str, len);
-    auto it = string_pool->find(off);
+    NotNested();
+    if (!string_pool) string_pool = new StringPool();
+    auto hash = HashBytes(reinterpret_cast<const uint8_t *>(str), len);
     // If it exists we reuse existing serialized data!
-    if (it != string_pool->end()) {
-      // We can remove the string we serialized.
-      buf_.pop(buf_.size() - size_before_string);
-      return *it;
+    auto existing = string_pool->Find(buf_, str, len, hash);
+    if (existing) {
+      string_pool->hits++;
+      return Offset<String>(existing);
     }
+    string_pool->misses++;
+    auto off = CreateString(str, len);
     // Record this string for future use.
-    string_pool->insert(off);
+    string_pool->Insert(off.o, hash);
     return off;
   }
 
@@ -1403,6 +1575,28 @@ class FlatBufferBuilder {
     return CreateSharedString(str->c_str(), str->size());
   }
 
+  /// @brief Limit the memory used to remember strings for
+  /// `CreateSharedString`. Once the limit is hit, new strings are still
+  /// serialized, but not remembered, so only strings seen before can be
+  /// shared. By default, there is no limit.
+  /// @param[in] max_bytes The maximum size of the string pool in bytes.
+  void SetSharedStringPoolLimit(size_t max_bytes) {
+    if (!string_pool) string_pool = new StringPool();
+    string_pool->max_bytes = max_bytes;
+  }
+
+  /// @brief The number of `CreateSharedString` calls since the last `Clear()`
+  /// that returned a string serialized before.
+  size_t GetSharedStringHits() const {
+    return string_pool ? string_pool->hits : 0;
+  }
+
+  /// @brief The number of `CreateSharedString` calls since the last `Clear()`
+  /// that had to serialize the string.
+  size_t GetSharedStringMisses() const {
+    return string_pool ? string_pool->misses : 0;
+  }
+
   /// @cond FLATBUFFERS_INTERNAL
   uoffset_t EndVector(size_t len) {
     FLATBUFFERS_ASSERT(nested);  // Hit if no corresponding StartVector.
@@ -1474,7 +1668,8 @@ class FlatBufferBuilder {
   /// buffer as a `vector`.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
-  template<typename T> Offset<Vector<T>> CreateVector(const std::vector<T> &v) {
+  template<typename T, typename Alloc>
+  Offset<Vector<T>> CreateVector(const std::vector<T, Alloc> &v) {
     return CreateVector(data(v), v.size());
   }
 
@@ -1630,9 +1825,9 @@ class FlatBufferBuilder {
   /// serialize into the buffer as a `vector`.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
-  template<typename T, typename S>
+  template<typename T, typename S, typename Alloc>
   Offset<Vector<const T *>> CreateVectorOfNativeStructs(
-      const std::vector<S> &v) {
+      const std::vector<S, Alloc> &v) {
     return CreateVectorOfNativeStructs<T, S>(data(v), v.size());
   }
 
@@ -1749,6 +1944,74 @@ class FlatBufferBuilder {
     return CreateVectorOfSortedTables(data(*v), v->size());
   }
 
+  /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
+  /// in Eytzinger order: the sorted tables laid out as an implicit binary
+  /// search tree, level by level. Look up keys in it with
+  /// `Vector::LookupByKeyEytzinger`, which is faster than `LookupByKey` on a
+  /// sorted vector for large vectors. Anything else expecting the vector to
+  /// be sorted (such as `LookupByKey`) won't work on it.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] v An array of type `Offset<T>` that contains the `table`
+  /// offsets to store in the buffer, it is reordered in place into the order
+  /// of the `vector`.
+  /// @param[in] len The number of elements to store in the `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset<Vector<Offset<T>>> CreateVectorOfEytzingerTables(Offset<T> *v,
+                                                          size_t len) {
+    std::sort(v, v + len, TableKeyComparator<T>(buf_));
+    std::vector<Offset<T>> sorted(v, v + len);
+    EytzingerOrder(data(sorted), v, 0, 1, len);
+    return CreateVector(v, len);
+  }
+
+  /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
+  /// in Eytzinger order, see above.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] v An array of type `Offset<T>` that contains the `table`
+  /// offsets to store in the buffer, it is reordered in place into the order
+  /// of the `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset<Vector<Offset<T>>> CreateVectorOfEytzingerTables(
+      std::vector<Offset<T>> *v) {
+    return CreateVectorOfEytzingerTables(data(*v), v->size());
+  }
+
+  /// @brief Serialize a hash index for a vector of tables with a key, which
+  /// `Vector::LookupByKeyHashed` can use to find keys in O(1). Generated code
+  /// has a helper to create it for fields with the `hash_index` attribute.
+  /// The index is an open addressing hash table with at least twice as many
+  /// slots as there are elements, each holding an element index + 1 or 0.
+  /// @param[in] hashes `HashKey` of the key of each element of the vector.
+  /// @param[in] len The number of elements of the vector.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the index is stored.
+  Offset<Vector<uint32_t>> CreateHashIndex(const uint32_t *hashes,
+                                           size_t len) {
+    size_t num_slots = 1;
+    while (num_slots < len * 2) num_slots *= 2;
+    std::vector<uint32_t> slots(num_slots, 0);
+    for (size_t i = 0; i < len; i++) {
+      auto slot = hashes[i] & (num_slots - 1);
+      while (slots[slot]) slot = (slot + 1) & (num_slots - 1);
+      slots[slot] = static_cast<uint32_t>(i + 1);
+    }
+    return CreateVector(slots);
+  }
+
+  /// @brief Serialize a hash index for a vector of tables with a key, see
+  /// above.
+  /// @param[in] hashes `HashKey` of the key of each element of the vector.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the index is stored.
+  Offset<Vector<uint32_t>> CreateHashIndex(
+      const std::vector<uint32_t> &hashes) {
+    return CreateHashIndex(data(hashes), hashes.size());
+  }
+
   /// @brief Specialized version of `CreateVector` for non-copying use cases.
   /// Write the data any time later to the returned buffer pointer `buf`.
   /// @param[in] len The number of elements to store in the `vector`.
@@ -1846,6 +2109,7 @@ protected:
   void Finish(uoffset_t root, const char *file_identifier, bool size_prefix) {
     NotNested();
     buf_.clear_scratch();
+    ClearVTables();
     // This will cause the whole buffer to be aligned.
     PreAlign((size_prefix ? sizeof(uoffset_t) : 0) + sizeof(uoffset_t) +
                  (file_identifier ? kFileIdentifierLength : 0),
@@ -1868,7 +2132,7 @@ protected:
   vector_downward buf_;
 
   // Accumulating offsets of table members while it is being built.
-  // We store these in the scratch pad of buf_, after the vtable offsets.
+  // We store these in the scratch pad of buf_, after the vtable index.
   uoffset_t num_field_loc;
   // Track how much of the vtable is in use, so we can output the most compact
   // possible vtable.
@@ -1886,20 +2150,92 @@ protected:
 
   bool dedup_vtables_;
 
-  struct StringOffsetCompare {
-    StringOffsetCompare(const vector_downward &buf) : buf_(&buf) {}
-    bool operator()(const Offset<String> &a, const Offset<String> &b) const {
-      auto stra = reinterpret_cast<const String *>(buf_->data_at(a.o));
-      auto strb = reinterpret_cast<const String *>(buf_->data_at(b.o));
-      return StringLessThan(stra->data(), stra->size(),
-                            strb->data(), strb->size());
-    }
-    const vector_downward *buf_;
+  // Entry of the open-addressing hash tables (linear probing, at most half
+  // full) used to find data that was serialized before.
+  struct HashSlot {
+    uoffset_t off;  // 0 if this slot is empty.
+    uint32_t hash;
   };
 
+  static void InsertHashSlot(HashSlot *slots, size_t num_slots,
+                             uoffset_t off, uint32_t hash) {
+    auto mask = num_slots - 1;
+    auto i = hash & mask;
+    while (slots[i].off) i = (i + 1) & mask;
+    slots[i].off = off;
+    slots[i].hash = hash;
+  }
+
+  // Offsets of all vtables written so far are kept in a hash table at the
+  // start of the scratch pad of buf_, so EndTable can find a matching vtable
+  // in O(1).
+  size_t num_vtable_slots_;  // 0 or a power of 2.
+  size_t num_vtables_;
+
+  // The vtables most recently written by EndFixedTable, by the address of
+  // their static copy in generated code.
+  struct FixedVTable {
+    const voffset_t *vtable;
+    uoffset_t off;
+  };
+  static const size_t kNumFixedVTables = 8;
+  FixedVTable fixed_vtables_[kNumFixedVTables];
+
   // For use with CreateSharedString. Instantiated on first use only.
-  typedef std::set<Offset<String>, StringOffsetCompare> StringOffsetMap;
-  StringOffsetMap *string_pool;
+  // This is a hash table of the offsets of the strings serialized so far.
+  // It doesn't use the builder's allocator, which is meant for the buffer
+  // only (and e.g. in case of gRPC can only hold a single allocation).
+  struct StringPool {
+    StringPool()
+        : num_strings(0),
+          max_bytes(~static_cast<size_t>(0)),
+          hits(0),
+          misses(0) {}
+
+    void clear() {
+      std::fill(slots.begin(), slots.end(), HashSlot());
+      num_strings = 0;
+      hits = 0;
+      misses = 0;
+    }
+
+    uoffset_t Find(const vector_downward &buf, const char *str, size_t len,
+                   uint32_t hash) const {
+      if (!num_strings) return 0;
+      auto mask = slots.size() - 1;
+      for (auto i = hash & mask; slots[i].off; i = (i + 1) & mask) {
+        if (slots[i].hash != hash) continue;
+        auto str2 = reinterpret_cast<const String *>(buf.data_at(slots[i].off));
+        if (str2->size() == len && 0 == memcmp(str2->data(), str, len))
+          return slots[i].off;
+      }
+      return 0;
+    }
+
+    // Returns false if the string wasn't added because of `max_bytes`.
+    bool Insert(uoffset_t off, uint32_t hash) {
+      if ((num_strings + 1) * 2 > slots.size()) {
+        auto new_num_slots = slots.empty() ? 64 : slots.size() * 2;
+        if (new_num_slots * sizeof(HashSlot) > max_bytes) return false;
+        std::vector<HashSlot> new_slots(new_num_slots, HashSlot());
+        for (auto it = slots.begin(); it != slots.end(); ++it) {
+          if (it->off)
+            InsertHashSlot(data(new_slots), new_num_slots, it->off, it->hash);
+        }
+        slots.swap(new_slots);
+      }
+      InsertHashSlot(data(slots), slots.size(), off, hash);
+      num_strings++;
+      return true;
+    }
+
+    std::vector<HashSlot> slots;  // Size is 0 or a power of 2.
+    size_t num_strings;
+    size_t max_bytes;
+    size_t hits;
+    size_t misses;
+  };
+  StringPool *string_pool;
 
  private:
   // Allocates space for a vector of structures.
@@ -1915,6 +2251,65 @@ protected:
   Offset<Vector<const T *>> EndVectorOfStructs(size_t vector_size) {
     return Offset<Vector<const T *>>(EndVector(vector_size));
   }
+
+  // Stores the subtree of 1-based tree node `node` in Eytzinger order in
+  // `out`, taking elements in order from `sorted` starting at `i`. Returns
+  // the index of the first element not used.
+  template<typename T>
+  static size_t EytzingerOrder(const T *sorted, T *out, size_t i, size_t node,
+                               size_t len) {
+    if (node > len) return i;
+    i = EytzingerOrder(sorted, out, i, 2 * node, len);
+    out[node - 1] = sorted[i++];
+    return EytzingerOrder(sorted, out, i, 2 * node + 1, len);
+  }
+
+  // Returns the offset of an earlier vtable identical to `vt`, or 0.
+  uoffset_t FindVTable(const uint8_t *vt, voffset_t vt_size,
+                       uint32_t hash) const {
+    if (!num_vtables_) return 0;
+    auto slots = reinterpret_cast<const HashSlot *>(buf_.scratch_data());
+    auto mask = num_vtable_slots_ - 1;
+    for (auto i = hash & mask; slots[i].off; i = (i + 1) & mask) {
+      if (slots[i].hash != hash) continue;
+      auto vt2 = buf_.data_at(slots[i].off);
+      if (ReadScalar<voffset_t>(vt2) == vt_size &&
+          0 == memcmp(vt2, vt, vt_size))
+        return slots[i].off;
+    }
+    return 0;
+  }
+
+  void AddVTable(uoffset_t off, uint32_t hash) {
+    if ((num_vtables_ + 1) * 2 > num_vtable_slots_) GrowVTables();
+    InsertHashSlot(reinterpret_cast<HashSlot *>(buf_.scratch_data()),
+                   num_vtable_slots_, off, hash);
+    num_vtables_++;
+  }
+
+  // Doubles the vtable index. Builds the new table on top of the scratch pad,
+  // then moves it down over the old one. This relies on the index being the
+  // only thing in the scratch pad, which is true at the end of EndTable.
+  void GrowVTables() {
+    FLATBUFFERS_ASSERT(buf_.scratch_size() ==
+                       num_vtable_slots_ * sizeof(HashSlot));
+    auto old_size = num_vtable_slots_ * sizeof(HashSlot);
+    auto new_num_slots = num_vtable_slots_ ? num_vtable_slots_ * 2 : 16;
+    auto new_size = new_num_slots * sizeof(HashSlot);
+    auto new_slots =
+        reinterpret_cast<HashSlot *>(buf_.scratch_make_space(new_size));
+    memset(new_slots, 0, new_size);
+    auto old_slots = reinterpret_cast<HashSlot *>(buf_.scratch_data());
+    for (size_t i = 0; i < num_vtable_slots_; i++) {
+      if (old_slots[i].off) {
+        InsertHashSlot(new_slots, new_num_slots, old_slots[i].off,
+                       old_slots[i].hash);
+      }
+    }
+    memmove(old_slots, new_slots, new_size);
+    buf_.scratch_pop(old_size);
+    num_vtable_slots_ = new_num_slots;
+  }
 };
 /// @}
 
@@ -1967,6 +2362,18 @@ inline bool BufferHasIdentifier(const void *buf, const char *identifier, bool si
                  FlatBufferBuilder::kFileIdentifierLength) == 0;
 }
 
+// clang-format off
+#ifndef FLATBUFFERS_CPP98_STL
+  /// @brief Function type used to verify parts of a buffer concurrently.
+  /// It must call `task(i)` once for every `i` in `[0, num_tasks)`, possibly
+  /// on multiple threads, and only return once all of them have finished.
+  /// Typically this hands the tasks to a thread pool and waits for them.
+  typedef std::function<void (size_t num_tasks,
+                              const std::function<void (size_t i)> &task)>
+          parallel_for_function_t;
+#endif
+// clang-format on
+
 // Helper class to verify the integrity of a FlatBuffer
 class Verifier FLATBUFFERS_FINAL_CLASS {
  public:
@@ -1980,10 +2387,32 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
         max_tables_(_max_tables),
         upper_bound_(0),
         check_alignment_(_check_alignment)
+        // clang-format off
+        #ifndef FLATBUFFERS_CPP98_STL
+        , parallel_tasks_(0),
+        parallel_min_size_(0)
+        #endif
+        // clang-format on
   {
     FLATBUFFERS_ASSERT(size_ < FLATBUFFERS_MAX_BUFFER_SIZE);
   }
 
+  // clang-format off
+  #ifndef FLATBUFFERS_CPP98_STL
+  // Verify vectors of at least `min_size` tables by splitting them into
+  // `num_tasks` parts that are verified by `parallel_for`, each with its own
+  // Verifier. Those start at the current depth and get the remaining table
+  // budget, which is updated with their totals afterwards, so the outcome is
+  // the same as verifying the whole vector here.
+  void SetParallelFor(const parallel_for_function_t &parallel_for,
+                      size_t num_tasks, uoffset_t min_size = 1024) {
+    parallel_for_ = parallel_for;
+    parallel_tasks_ = num_tasks;
+    parallel_min_size_ = min_size;
+  }
+  #endif
+  // clang-format on
+
   // Central location where any verification failures register.
   bool Check(bool ok) const {
     // clang-format off
@@ -2075,7 +2504,15 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   // Special case for string contents, after the above has been called.
   bool VerifyVectorOfStrings(const Vector<Offset<String>> *vec) const {
     if (vec) {
-      for (uoffset_t i = 0; i < vec->size(); i++) {
+      uoffset_t i = 0;
+      // clang-format off
+      #if FLATBUFFERS_VERIFIER_AVX2
+        if (__builtin_cpu_supports("avx2")) i = VerifyStringsAVX2(vec);
+      #endif
+      // clang-format on
+      // Anything the fast path didn't accept (including the first failure,
+      // so it gets reported the usual way) is checked one by one.
+      for (; i < vec->size(); i++) {
         if (!VerifyString(vec->Get(i))) return false;
       }
     }
@@ -2085,6 +2522,14 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   // Special case for table contents, after the above has been called.
   template<typename T> bool VerifyVectorOfTables(const Vector<Offset<T>> *vec) {
     if (vec) {
+      // clang-format off
+      #ifndef FLATBUFFERS_CPP98_STL
+        if (parallel_for_ && parallel_tasks_ > 1 &&
+            vec->size() >= parallel_min_size_) {
+          return VerifyVectorOfTablesParallel(vec);
+        }
+      #endif
+      // clang-format on
       for (uoffset_t i = 0; i < vec->size(); i++) {
         if (!vec->Get(i)->Verify(*this)) return false;
       }
@@ -2093,6 +2538,12 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   }
 
   bool VerifyTableStart(const uint8_t *table) {
+    return VerifyComplexity() && VerifyVTable(table);
+  }
+
+  // Check that the vtable of a table lies within the buffer, which makes it
+  // safe to look up field offsets in it.
+  bool VerifyVTable(const uint8_t *table) const {
     // Check the vtable offset.
     auto tableo = static_cast<size_t>(table - buf_);
     if (!Verify<soffset_t>(tableo)) return false;
@@ -2100,11 +2551,55 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     // gives the result we want.
     auto vtableo = tableo - static_cast<size_t>(ReadScalar<soffset_t>(table));
     // Check the vtable size field, then check vtable fits in its entirety.
-    return VerifyComplexity() && Verify<voffset_t>(vtableo) &&
+    return Verify<voffset_t>(vtableo) &&
            VerifyAlignment<voffset_t>(ReadScalar<voffset_t>(buf_ + vtableo)) &&
            Verify(vtableo, ReadScalar<voffset_t>(buf_ + vtableo));
   }
 
+  // Shallow checks used by the checked accessors (see `--gen-checked-accessors`
+  // in flatc), which only verify what they are about to hand out: the bytes
+  // of a string or vector, or the vtable of a table. Everything these point to
+  // is checked again when accessed, so no recursion or table counting is
+  // needed.
+  bool VerifyShallow(const String *str) const { return VerifyString(str); }
+
+  template<typename T> bool VerifyShallow(const Vector<T> *vec) const {
+    return VerifyVector(vec);
+  }
+
+  // Union values: the type isn't known until they are cast.
+  bool VerifyShallow(const void *) const { return true; }
+
+  template<typename T> bool VerifyShallow(const T *table) const {
+    return !table || VerifyVTable(reinterpret_cast<const uint8_t *>(table));
+  }
+
+  // Checked access to the root table, returns nullptr if the root offset,
+  // the identifier (if given) or the vtable of the root don't check out.
+  template<typename T>
+  const T *GetRootChecked(const char *identifier = nullptr) const {
+    if (identifier && (size_ < 2 * sizeof(flatbuffers::uoffset_t) ||
+                       !BufferHasIdentifier(buf_, identifier))) {
+      return nullptr;
+    }
+    auto o = VerifyOffset(0);
+    if (!o) return nullptr;
+    auto root = reinterpret_cast<const T *>(buf_ + o);
+    return VerifyShallow(root) ? root : nullptr;
+  }
+
+  // Checked access to element `i` of a vector of tables or strings returned
+  // by a checked accessor, returns nullptr if the element doesn't check out.
+  template<typename T>
+  const T *GetChecked(const Vector<Offset<T>> *vec, uoffset_t i) const {
+    if (!vec || i >= vec->size()) return nullptr;
+    auto elem = reinterpret_cast<const uint8_t *>(vec->Data()) +
+                i * sizeof(uoffset_t);
+    if (!VerifyOffset(static_cast<size_t>(elem - buf_))) return nullptr;
+    auto p = vec->Get(i);
+    return VerifyShallow(p) ? p : nullptr;
+  }
+
   template<typename T>
   bool VerifyBufferFromStart(const char *identifier, size_t start) {
     if (identifier &&
@@ -2188,6 +2683,103 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   }
 
  private:
+  // clang-format off
+  #ifndef FLATBUFFERS_CPP98_STL
+  template<typename T>
+  bool VerifyVectorOfTablesParallel(const Vector<Offset<T>> *vec) {
+    auto size = static_cast<size_t>(vec->size());
+    auto num_tasks = (std::min)(parallel_tasks_, size);
+    // Tasks don't split their vectors any further.
+    Verifier task_verifier(*this);
+    task_verifier.num_tables_ = 0;
+    task_verifier.max_tables_ = max_tables_ - num_tables_;
+    task_verifier.upper_bound_ = 0;
+    task_verifier.parallel_for_ = nullptr;
+    std::vector<Verifier> verifiers(num_tasks, task_verifier);
+    std::vector<uint8_t> results(num_tasks, 0);
+    parallel_for_(num_tasks, [&](size_t task) {
+      auto &verifier = verifiers[task];
+      for (auto i = size * task / num_tasks; i < size * (task + 1) / num_tasks;
+           i++) {
+        if (!vec->Get(static_cast<uoffset_t>(i))->Verify(verifier)) return;
+      }
+      results[task] = 1;
+    });
+    auto ok = true;
+    size_t num_tables = num_tables_;
+    for (size_t task = 0; task < num_tasks; task++) {
+      ok = ok && results[task];
+      num_tables += verifiers[task].num_tables_;
+      upper_bound_ = (std::max)(upper_bound_, verifiers[task].upper_bound_);
+    }
+    if (!ok) return false;
+    if (!Check(num_tables <= max_tables_)) return false;
+    num_tables_ = static_cast<uoffset_t>(num_tables);
+    return true;
+  }
+  #endif
+
+  #if FLATBUFFERS_VERIFIER_AVX2
+  // Does the same checks as VerifyString for 8 elements of `vec` at a time.
+  // Returns the number of elements at the start of `vec` that passed, the
+  // caller must verify the rest.
+  __attribute__((target("avx2")))
+  uoffset_t VerifyStringsAVX2(const Vector<Offset<String>> *vec) const {
+    // The vector itself has been verified, so all offsets below fit in 32
+    // bits, and positions are in the buffer (and aligned, if checked).
+    if (size_ <= sizeof(uoffset_t)) return 0;
+    const auto elems = vec->Data();
+    const auto base = reinterpret_cast<const int *>(buf_);
+    const auto zero = _mm256_setzero_si256();
+    const auto lane = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    const auto align_mask = _mm256_set1_epi32(check_alignment_ ? 3 : 0);
+    // Highest position a string (its size field) can start at.
+    const auto max_start =
+        _mm256_set1_epi32(static_cast<int>(size_ - sizeof(uoffset_t)));
+    auto max_tail = zero;
+    uoffset_t i = 0;
+    for (; i + 8 <= vec->size(); i += 8) {
+      auto pos = _mm256_add_epi32(
+          _mm256_set1_epi32(static_cast<int>(elems - buf_ + i * 4)), lane);
+      auto off = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i *>(elems + i * sizeof(uoffset_t)));
+      // The size field must be in the buffer: off <= max_start - pos.
+      auto room = _mm256_sub_epi32(max_start, pos);
+      auto ok = _mm256_cmpeq_epi32(_mm256_min_epu32(off, room), off);
+      // And aligned.
+      auto start = _mm256_add_epi32(pos, off);
+      ok = _mm256_and_si256(
+          ok, _mm256_cmpeq_epi32(_mm256_and_si256(start, align_mask), zero));
+      if (_mm256_movemask_epi8(ok) != -1) break;
+      // The terminator must be in the buffer: len < max_start - start.
+      auto len = _mm256_i32gather_epi32(base, start, 1);
+      room = _mm256_sub_epi32(max_start, start);
+      auto too_long = _mm256_cmpeq_epi32(_mm256_max_epu32(len, room), len);
+      if (_mm256_movemask_epi8(too_long)) break;
+      // And be 0. Load the 4 bytes ending at it, to stay inside the buffer.
+      auto tail_start = _mm256_add_epi32(_mm256_add_epi32(start, len),
+                                         _mm256_set1_epi32(1));
+      auto tail = _mm256_i32gather_epi32(base, tail_start, 1);
+      ok = _mm256_cmpeq_epi32(_mm256_srli_epi32(tail, 24), zero);
+      if (_mm256_movemask_epi8(ok) != -1) break;
+      max_tail = _mm256_max_epu32(max_tail, tail_start);
+    }
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+      uint32_t tails[8];
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(tails), max_tail);
+      for (int j = 0; j < 8; j++) {
+        // The terminator is the last byte VerifyString would have checked.
+        auto upper_bound = static_cast<size_t>(tails[j]) + sizeof(uoffset_t);
+        if (i && upper_bound_ < upper_bound) upper_bound_ = upper_bound;
+      }
+    #else
+      (void)max_tail;
+    #endif
+    return i;
+  }
+  #endif  // FLATBUFFERS_VERIFIER_AVX2
+  // clang-format on
+
   const uint8_t *buf_;
   size_t size_;
   uoffset_t depth_;
@@ -2196,8 +2788,31 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   uoffset_t max_tables_;
   mutable size_t upper_bound_;
   bool check_alignment_;
+  // clang-format off
+  #ifndef FLATBUFFERS_CPP98_STL
+  parallel_for_function_t parallel_for_;
+  size_t parallel_tasks_;
+  uoffset_t parallel_min_size_;
+  #endif
+  // clang-format on
 };
 
+// clang-format off
+#ifndef FLATBUFFERS_CPP98_STL
+// Verify a buffer with root type T, like Verifier::VerifyBuffer, but with
+// large vectors of tables verified in `num_tasks` parts by `parallel_for`.
+// See Verifier::SetParallelFor.
+template<typename T>
+bool VerifyBufferParallel(const uint8_t *buf, size_t buf_len,
+                          const parallel_for_function_t &parallel_for,
+                          size_t num_tasks, const char *identifier = nullptr) {
+  Verifier verifier(buf, buf_len);
+  verifier.SetParallelFor(parallel_for, num_tasks);
+  return verifier.VerifyBuffer<T>(identifier);
+}
+#endif
+// clang-format on
+
 // Convenient way to bundle a buffer and its length, to pass it around
 // typed by its root.
 // A BufferRef does not own its buffer.
@@ -2285,6 +2900,42 @@ class Table {
     return field_offset ? reinterpret_cast<P>(p) : nullptr;
   }
 
+  // Checked versions of the above, which verify only the bytes they read
+  // (this table's vtable, the field and, for pointers, what it points to)
+  // rather than requiring the whole buffer to have been verified upfront.
+  // A field that doesn't check out reads as absent.
+  voffset_t GetOptionalFieldOffsetChecked(const Verifier &verifier,
+                                          voffset_t field) const {
+    return verifier.VerifyVTable(data_) ? GetOptionalFieldOffset(field) : 0;
+  }
+
+  template<typename T>
+  T GetFieldChecked(const Verifier &verifier, voffset_t field,
+                    T defaultval) const {
+    auto field_offset = GetOptionalFieldOffsetChecked(verifier, field);
+    return field_offset && verifier.Verify<T>(data_, field_offset)
+               ? ReadScalar<T>(data_ + field_offset)
+               : defaultval;
+  }
+
+  template<typename P>
+  P GetPointerChecked(const Verifier &verifier, voffset_t field) const {
+    auto field_offset = GetOptionalFieldOffsetChecked(verifier, field);
+    if (!field_offset || !verifier.VerifyOffset(data_, field_offset))
+      return nullptr;
+    auto p = GetPointer<P>(field);
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
+
+  template<typename P>
+  P GetStructChecked(const Verifier &verifier, voffset_t field) const {
+    auto field_offset = GetOptionalFieldOffsetChecked(verifier, field);
+    return field_offset && verifier.Verify(data_, field_offset,
+                                           sizeof(*static_cast<P>(nullptr)))
+               ? GetStruct<P>(field)
+               : nullptr;
+  }
+
   template<typename T> bool SetField(voffset_t field, T val, T def) {
     auto field_offset = GetOptionalFieldOffset(field);
     if (!field_offset) return IsTheSameAs(val, def);
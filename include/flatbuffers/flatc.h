@@ -69,26 +69,73 @@ class FlatCompiler {
     ErrorFn error_fn;
   };
 
-  explicit FlatCompiler(const InitParams &params) : params_(params) {}
+  explicit FlatCompiler(const InitParams &params)
+      : params_(params), messages_(nullptr), output_to_stdout_(false) {}
 
   int Compile(int argc, const char **argv);
 
   std::string GetUsageString(const char *program_name) const;
 
+  // Whether Compile() writes its output to stdout (--ndjson with an input
+  // named -), so warnings and errors should go elsewhere.
+  bool OutputToStdout() const { return output_to_stdout_; }
+
  private:
-  void ParseFile(flatbuffers::Parser &parser, const std::string &filename,
+  struct Settings;
+  class IncludeCache;
+  class Manifest;
+  struct ManifestEntry;
+
+  // Output of a file compiled on another thread (--jobs), to be reported in the
+  // order of the input files.
+  struct Message {
+    enum Kind { kOutput, kWarning, kError };
+    Message(Kind _kind, const std::string &_text, bool _usage,
+            bool _show_exe_name)
+        : kind(_kind), text(_text), usage(_usage),
+          show_exe_name(_show_exe_name) {}
+    Kind kind;
+    std::string text;
+    bool usage;
+    bool show_exe_name;
+  };
+
+  bool ParseFile(flatbuffers::Parser &parser, const std::string &filename,
                  const std::string &contents,
                  std::vector<const char *> &include_directories) const;
 
-  void LoadBinarySchema(Parser &parser, const std::string &filename,
-                        const std::string &contents);
+  bool LoadBinarySchema(Parser &parser, const std::string &filename,
+                        const std::string &contents) const;
+
+  bool CompileFile(const Settings &settings,
+                   std::unique_ptr<flatbuffers::Parser> &parser,
+                   const std::string &filename, bool is_binary) const;
+
+  bool ConvertRecords(const Settings &settings, const Parser &parser,
+                      const std::string &filename) const;
+
+  bool CompileUnit(const Settings &settings,
+                   std::unique_ptr<flatbuffers::Parser> &parser,
+                   const std::vector<std::string> &filenames,
+                   const std::vector<size_t> &unit,
+                   ManifestEntry *entry) const;
+
+  bool CompileParallel(const Settings &settings,
+                       const std::vector<std::string> &filenames,
+                       const std::vector<std::vector<size_t>> &units,
+                       size_t num_jobs,
+                       std::vector<ManifestEntry> *entries) const;
 
   void Warn(const std::string &warn, bool show_exe_name = true) const;
 
   void Error(const std::string &err, bool usage = true,
              bool show_exe_name = true) const;
 
+  void Print(const std::string &text) const;
+
   InitParams params_;
+  std::vector<Message> *messages_;  // If not null, collects all output.
+  bool output_to_stdout_;
 };
 
 }  // namespace flatbuffers
@@ -36,6 +36,7 @@ namespace flexbuffers {
 
 class Reference;
 class Map;
+class MapLookup;
 
 // These are used in the lower 2 bits of a type field to determine the size of
 // the elements (and or size field) of the item pointed to (e.g. vector).
@@ -283,6 +284,7 @@ class TypedVector : public Sized {
   Type type_;
 
   friend Map;
+  friend MapLookup;
 };
 
 class FixedTypedVector : public Object {
@@ -327,6 +329,19 @@ class Map : public Vector {
                        FBT_KEY);
   }
 
+  // The hash table of the keys written for large maps with
+  // BUILDER_FLAG_HASH_MAPS, or an empty vector if there is none.
+  TypedVector HashTable() const {
+    const size_t num_prefixed_fields = 3;
+    auto keys_offset = data_ - byte_width_ * num_prefixed_fields;
+    // The hash table width sits in the second byte of the keys width field.
+    auto hash_width = static_cast<uint8_t>(
+        ReadUInt64(keys_offset + byte_width_, byte_width_) >> 8);
+    if (!hash_width) return TypedVector::EmptyTypedVector();
+    return TypedVector(Indirect(keys_offset - byte_width_, byte_width_),
+                       hash_width, FBT_UINT);
+  }
+
   static Map EmptyMap() {
     static const uint8_t empty_map[] = {
       0 /*keys_len*/, 0 /*keys_offset*/, 1 /*keys_width*/, 0 /*len*/
@@ -335,6 +350,38 @@ class Map : public Vector {
   }
 
   bool IsTheEmptyMap() const { return data_ == EmptyMap().data_; }
+
+ private:
+  // Finds the index of `key` in `keys`, or returns keys.size(), probing
+  // `num_slots` (a power of 2) slots of `slot_width` bytes that store the
+  // index + 1 of each key, starting from the slot its HashKey() selects.
+  static size_t HashedFind(const TypedVector &keys, const uint8_t *slots,
+                           uint8_t slot_width, size_t num_slots,
+                           const char *key);
+
+  friend MapLookup;
+};
+
+// Caches what is needed to look up keys in a map, for when you look up many
+// keys in the same (large) map. It uses the hash table the builder wrote for
+// the map if there is one, and otherwise builds one in memory, so it works
+// with any map. The map's buffer must outlive it.
+class MapLookup {
+ public:
+  explicit MapLookup(const Map &map);
+
+  Reference operator[](const char *key) const;
+  Reference operator[](const std::string &key) const;
+
+  const Map &map() const { return map_; }
+
+ private:
+  Map map_;
+  TypedVector keys_;
+  const uint8_t *slots_;
+  uint8_t slot_width_;
+  size_t num_slots_;
+  std::vector<uint8_t> own_slots_;
 };
 
 template<typename T>
@@ -786,7 +833,41 @@ template<typename T> int KeyCompare(const void *key, const void *elem) {
   return strcmp(skey, str_elem);
 }
 
+// 32bit FNV-1a of a map key, as used by map hash tables.
+inline uint32_t HashKey(const char *key) {
+  uint32_t hash = 0x811C9DC5;
+  for (; *key; key++) {
+    hash ^= static_cast<uint8_t>(*key);
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+
+inline size_t Map::HashedFind(const TypedVector &keys, const uint8_t *slots,
+                              uint8_t slot_width, size_t num_slots,
+                              const char *key) {
+  auto len = keys.size();
+  auto mask = num_slots - 1;
+  auto slot = HashKey(key) & mask;
+  for (size_t probes = 0; probes < num_slots; probes++) {
+    auto entry = ReadUInt64(slots + slot * slot_width, slot_width);
+    if (!entry) break;
+    auto i = static_cast<size_t>(entry - 1);
+    if (i < len &&
+        !strcmp(key, reinterpret_cast<const char *>(Indirect(
+                         keys.data_ + i * keys.byte_width_, keys.byte_width_))))
+      return i;
+    slot = (slot + 1) & mask;
+  }
+  return len;
+}
+
 inline Reference Map::operator[](const char *key) const {
+  auto table = HashTable();
+  if (table.size()) {
+    return (*static_cast<const Vector *>(this))[HashedFind(
+        Keys(), table.data_, table.byte_width_, table.size(), key)];
+  }
   auto keys = Keys();
   // We can't pass keys.byte_width_ to the comparison function, so we have
   // to pick the right one ahead of time.
@@ -807,6 +888,45 @@ inline Reference Map::operator[](const std::string &key) const {
   return (*this)[key.c_str()];
 }
 
+inline MapLookup::MapLookup(const Map &map)
+    : map_(map),
+      keys_(map.Keys()),
+      slots_(nullptr),
+      slot_width_(0),
+      num_slots_(0) {
+  auto table = map.HashTable();
+  if (table.size()) {
+    slots_ = table.data_;
+    slot_width_ = table.byte_width_;
+    num_slots_ = table.size();
+    return;
+  }
+  // Build a table with the same layout the builder would have written.
+  auto len = keys_.size();
+  num_slots_ = 1;
+  while (num_slots_ < len * 2) num_slots_ *= 2;
+  slot_width_ = sizeof(uint32_t);
+  own_slots_.resize(num_slots_ * slot_width_, 0);
+  auto mask = num_slots_ - 1;
+  for (size_t i = 0; i < len; i++) {
+    auto slot = HashKey(keys_[i].AsKey()) & mask;
+    while (ReadUInt64(&own_slots_[slot * slot_width_], slot_width_))
+      slot = (slot + 1) & mask;
+    flatbuffers::WriteScalar(&own_slots_[slot * slot_width_],
+                             static_cast<uint32_t>(i + 1));
+  }
+  slots_ = flatbuffers::vector_data(own_slots_);
+}
+
+inline Reference MapLookup::operator[](const char *key) const {
+  return map_.Values()[Map::HashedFind(keys_, slots_, slot_width_, num_slots_,
+                                       key)];
+}
+
+inline Reference MapLookup::operator[](const std::string &key) const {
+  return (*this)[key.c_str()];
+}
+
 inline Reference GetRoot(const uint8_t *buffer, size_t size) {
   // See Finish() below for the serialization counterpart of this.
   // The root starts at the end of the buffer, so we parse backwards from there.
@@ -831,6 +951,9 @@ inline Reference GetRoot(const std::vector<uint8_t> &buffer) {
 // Turn strings on if you expect many non-unique string values.
 // Additionally, sharing key vectors can save space if you have maps with
 // identical field populations.
+// BUILDER_FLAG_HASH_MAPS stores a hash table next to the keys of maps with
+// 256 or more keys, so looking up keys no longer needs a binary search.
+// Readers that don't know about it still read these maps as before.
 enum BuilderFlag {
   BUILDER_FLAG_NONE = 0,
   BUILDER_FLAG_SHARE_KEYS = 1,
@@ -838,6 +961,7 @@ enum BuilderFlag {
   BUILDER_FLAG_SHARE_KEYS_AND_STRINGS = 3,
   BUILDER_FLAG_SHARE_KEY_VECTORS = 4,
   BUILDER_FLAG_SHARE_ALL = 7,
+  BUILDER_FLAG_HASH_MAPS = 8,
 };
 
 class Builder FLATBUFFERS_FINAL_CLASS {
@@ -848,8 +972,10 @@ class Builder FLATBUFFERS_FINAL_CLASS {
         finished_(false),
         flags_(flags),
         force_min_bit_width_(BIT_WIDTH_8),
+        last_unsorted_key_(0),
         key_pool(KeyOffsetCompare(buf_)),
-        string_pool(StringOffsetCompare(buf_)) {
+        string_pool(StringOffsetCompare(buf_)),
+        key_vector_pool(KeyVectorCompare(buf_)) {
     buf_.clear();
   }
 
@@ -870,8 +996,10 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     finished_ = false;
     // flags_ remains as-is;
     force_min_bit_width_ = BIT_WIDTH_8;
+    last_unsorted_key_ = 0;
     key_pool.clear();
     string_pool.clear();
+    key_vector_pool.clear();
   }
 
   // All value constructing functions below have two versions: one that
@@ -958,6 +1086,17 @@ class Builder FLATBUFFERS_FINAL_CLASS {
         key_pool.insert(sloc);
       }
     }
+    // Inside a map the previous key is always 2 elements back. Remember the
+    // last key that is not greater than its predecessor, so EndMap() can skip
+    // sorting maps whose keys were written in order.
+    auto pos = stack_.size();
+    if (pos >= 2 && stack_[pos - 2].type_ == FBT_KEY &&
+        strcmp(reinterpret_cast<const char *>(flatbuffers::vector_data(buf_) +
+                                              stack_[pos - 2].u_),
+               reinterpret_cast<const char *>(flatbuffers::vector_data(buf_) +
+                                              sloc)) >= 0) {
+      last_unsorted_key_ = pos;
+    }
     stack_.push_back(Value(static_cast<uint64_t>(sloc), FBT_KEY, BIT_WIDTH_8));
     return sloc;
   }
@@ -1031,7 +1170,7 @@ class Builder FLATBUFFERS_FINAL_CLASS {
   size_t EndVector(size_t start, bool typed, bool fixed) {
     auto vec = CreateVector(start, stack_.size() - start, 1, typed, fixed);
     // Remove temp elements and return vector.
-    stack_.resize(start);
+    PopStack(start);
     stack_.push_back(vec);
     return static_cast<size_t>(vec.u_);
   }
@@ -1053,38 +1192,52 @@ class Builder FLATBUFFERS_FINAL_CLASS {
       Value val;
     };
     // TODO(wvo): strict aliasing?
-    // TODO(wvo): allow the caller to indicate the data is already sorted
-    // for maximum efficiency? With an assert to check sortedness to make sure
-    // we're not breaking binary search.
-    // Or, we can track if the map is sorted as keys are added which would be
-    // be quite cheap (cheaper than checking it here), so we can skip this
-    // step automatically when appliccable, and encourage people to write in
-    // sorted fashion.
-    // std::sort is typically already a lot faster on sorted data though.
-    auto dict =
-        reinterpret_cast<TwoValue *>(flatbuffers::vector_data(stack_) + start);
-    std::sort(dict, dict + len,
-              [&](const TwoValue &a, const TwoValue &b) -> bool {
-                auto as = reinterpret_cast<const char *>(
-                    flatbuffers::vector_data(buf_) + a.key.u_);
-                auto bs = reinterpret_cast<const char *>(
-                    flatbuffers::vector_data(buf_) + b.key.u_);
-                auto comp = strcmp(as, bs);
-                // If this assertion hits, you've added two keys with the same
-                // value to this map.
-                // TODO: Have to check for pointer equality, as some sort
-                // implementation apparently call this function with the same
-                // element?? Why?
-                FLATBUFFERS_ASSERT(comp || &a == &b);
-                return comp < 0;
-              });
+    // Key() tracks whether keys were added in sorted order (which also rules
+    // out duplicates), so we only need to sort if one of this map's keys was
+    // out of order.
+    if (last_unsorted_key_ >= start + 2) {
+      auto dict = reinterpret_cast<TwoValue *>(
+          flatbuffers::vector_data(stack_) + start);
+      std::sort(dict, dict + len,
+                [&](const TwoValue &a, const TwoValue &b) -> bool {
+                  auto as = reinterpret_cast<const char *>(
+                      flatbuffers::vector_data(buf_) + a.key.u_);
+                  auto bs = reinterpret_cast<const char *>(
+                      flatbuffers::vector_data(buf_) + b.key.u_);
+                  auto comp = strcmp(as, bs);
+                  // If this assertion hits, you've added two keys with the
+                  // same value to this map.
+                  // TODO: Have to check for pointer equality, as some sort
+                  // implementation apparently call this function with the
+                  // same element?? Why?
+                  FLATBUFFERS_ASSERT(comp || &a == &b);
+                  return comp < 0;
+                });
+    }
     // First create a vector out of all keys.
-    // TODO(wvo): if kBuilderFlagShareKeyVectors is true, see if we can share
-    // the first vector.
+    auto reset_to = buf_.size();
     auto keys = CreateVector(start, len, 2, true, false);
-    auto vec = CreateVector(start + 1, len, 2, false, false, &keys);
+    if (flags_ & BUILDER_FLAG_SHARE_KEY_VECTORS) {
+      auto it = key_vector_pool.find(keys);
+      if (it != key_vector_pool.end()) {
+        // An identical key vector is already in the buffer. Remove the one we
+        // just serialized, and point this map at the existing one instead.
+        buf_.resize(reset_to);
+        keys = *it;
+      } else {
+        key_vector_pool.insert(keys);
+      }
+    }
+    // Maps big enough to need 16-bit sizes (which leaves room for the hash
+    // table width next to the keys width) may also get a hash table.
+    Value hash_table;
+    auto hashed =
+        (flags_ & BUILDER_FLAG_HASH_MAPS) && WidthU(len) >= BIT_WIDTH_16;
+    if (hashed) hash_table = CreateHashTable(start, len);
+    auto vec = CreateVector(start + 1, len, 2, false, false, &keys,
+                            hashed ? &hash_table : nullptr);
     // Remove temp elements and return map.
-    stack_.resize(start);
+    PopStack(start);
     stack_.push_back(vec);
     return static_cast<size_t>(vec.u_);
   }
@@ -1388,6 +1541,15 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     }
   };
 
+  // Shrinks the stack back to `start` at the end of a vector or map.
+  // A key out of order past `start` can no longer be told apart from one that
+  // was out of order in an enclosing map, so conservatively move the marker to
+  // `start` (where the new vector or map will be).
+  void PopStack(size_t start) {
+    stack_.resize(start);
+    last_unsorted_key_ = (std::min)(last_unsorted_key_, start);
+  }
+
   void WriteAny(const Value &val, uint8_t byte_width) {
     switch (val.type_) {
       case FBT_NULL:
@@ -1429,16 +1591,45 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     return vloc;
   }
 
+  // Writes an open addressing hash table for the (sorted) keys of a map, where
+  // each slot holds the index + 1 of a key, or 0 if it is empty.
+  Value CreateHashTable(size_t start, size_t len) {
+    size_t num_slots = 1;
+    while (num_slots < len * 2) num_slots *= 2;
+    std::vector<uint64_t> slots(num_slots, 0);
+    auto mask = num_slots - 1;
+    for (size_t i = 0; i < len; i++) {
+      auto key = reinterpret_cast<const char *>(flatbuffers::vector_data(buf_) +
+                                                stack_[start + i * 2].u_);
+      auto slot = HashKey(key) & mask;
+      while (slots[slot]) slot = (slot + 1) & mask;
+      slots[slot] = i + 1;
+    }
+    auto bit_width = WidthU(num_slots);
+    auto byte_width = Align(bit_width);
+    Write<uint64_t>(num_slots, byte_width);
+    auto vloc = buf_.size();
+    for (size_t i = 0; i < num_slots; i++) Write(slots[i], byte_width);
+    return Value(static_cast<uint64_t>(vloc), FBT_VECTOR_UINT, bit_width);
+  }
+
   Value CreateVector(size_t start, size_t vec_len, size_t step, bool typed,
-                     bool fixed, const Value *keys = nullptr) {
+                     bool fixed, const Value *keys = nullptr,
+                     const Value *hash_table = nullptr) {
     FLATBUFFERS_ASSERT(!fixed || typed); // typed=false, fixed=true combination is not supported.
     // Figure out smallest bit width we can store this vector with.
     auto bit_width = (std::max)(force_min_bit_width_, WidthU(vec_len));
     auto prefix_elems = 1;
     if (keys) {
       // If this vector is part of a map, we will pre-fix an offset to the keys
-      // to this vector.
-      bit_width = (std::max)(bit_width, keys->ElemWidth(buf_.size(), 0));
+      // to this vector, preceded by an offset to its hash table if any.
+      if (hash_table) {
+        bit_width =
+            (std::max)(bit_width, hash_table->ElemWidth(buf_.size(), 0));
+        prefix_elems++;
+      }
+      bit_width = (std::max)(
+          bit_width, keys->ElemWidth(buf_.size(), prefix_elems - 1));
       prefix_elems += 2;
     }
     Type vector_type = FBT_KEY;
@@ -1462,8 +1653,15 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     auto byte_width = Align(bit_width);
     // Write vector. First the keys width/offset if available, and size.
     if (keys) {
+      uint64_t keys_width = 1ULL << keys->min_bit_width_;
+      if (hash_table) {
+        // Older readers only look at the low byte of the keys width.
+        FLATBUFFERS_ASSERT(byte_width > 1);
+        WriteOffset(hash_table->u_, byte_width);
+        keys_width |= (1ULL << hash_table->min_bit_width_) << 8;
+      }
       WriteOffset(keys->u_, byte_width);
-      Write<uint64_t>(1ULL << keys->min_bit_width_, byte_width);
+      Write<uint64_t>(keys_width, byte_width);
     }
     if (!fixed) Write<uint64_t>(vec_len, byte_width);
     // Then the actual data.
@@ -1497,6 +1695,9 @@ class Builder FLATBUFFERS_FINAL_CLASS {
 
   BitWidth force_min_bit_width_;
 
+  // Stack position of the last key that was added out of order (0 if none).
+  size_t last_unsorted_key_;
+
   struct KeyOffsetCompare {
     explicit KeyOffsetCompare(const std::vector<uint8_t> &buf) : buf_(&buf) {}
     bool operator()(size_t a, size_t b) const {
@@ -1522,11 +1723,36 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     const std::vector<uint8_t> *buf_;
   };
 
+  // Orders key vectors by length, then by their keys, so maps with the same
+  // set of keys find each other regardless of whether the keys were pooled.
+  struct KeyVectorCompare {
+    explicit KeyVectorCompare(const std::vector<uint8_t> &buf) : buf_(&buf) {}
+    bool operator()(const Value &a, const Value &b) const {
+      auto data = flatbuffers::vector_data(*buf_);
+      flexbuffers::TypedVector av(
+          data + a.u_, static_cast<uint8_t>(1U << a.min_bit_width_), FBT_KEY);
+      flexbuffers::TypedVector bv(
+          data + b.u_, static_cast<uint8_t>(1U << b.min_bit_width_), FBT_KEY);
+      if (av.size() != bv.size()) return av.size() < bv.size();
+      for (size_t i = 0; i < av.size(); i++) {
+        auto stra = av[i].AsKey();
+        auto strb = bv[i].AsKey();
+        if (stra == strb) continue;
+        auto comp = strcmp(stra, strb);
+        if (comp) return comp < 0;
+      }
+      return false;
+    }
+    const std::vector<uint8_t> *buf_;
+  };
+
   typedef std::set<size_t, KeyOffsetCompare> KeyOffsetMap;
   typedef std::set<StringOffset, StringOffsetCompare> StringOffsetMap;
+  typedef std::set<Value, KeyVectorCompare> KeyVectorMap;
 
   KeyOffsetMap key_pool;
   StringOffsetMap string_pool;
+  KeyVectorMap key_vector_pool;
 };
 
 }  // namespace flexbuffers
@@ -17,6 +17,7 @@
 #ifndef FLATBUFFERS_IDL_H_
 #define FLATBUFFERS_IDL_H_
 
+#include <iosfwd>
 #include <map>
 #include <memory>
 #include <stack>
@@ -297,7 +298,8 @@ struct StructDef : public Definition {
         sortbysize(true),
         has_key(false),
         minalign(1),
-        bytesize(0) {}
+        bytesize(0),
+        field_lookup_count(0) {}
 
   void PadLastField(size_t min_align) {
     auto padding = PaddingBytes(bytesize, min_align);
@@ -310,6 +312,11 @@ struct StructDef : public Definition {
 
   bool Deserialize(Parser &parser, const reflection::Object *object);
 
+  // Like fields.Lookup(), but uses the hash table built by BuildFieldLookup()
+  // if it is up to date with fields, which is much faster in parsing JSON.
+  FieldDef *LookupField(const std::string &field_name) const;
+  void BuildFieldLookup();
+
   SymbolTable<FieldDef> fields;
 
   bool fixed;       // If it's struct, not a table.
@@ -319,6 +326,10 @@ struct StructDef : public Definition {
   size_t minalign;  // What the whole object needs to be aligned to.
   size_t bytesize;  // Size if fixed.
 
+  // Open addressing hash table (by HashFnv1a) of fields, a power of 2 in size.
+  std::vector<FieldDef *> field_lookup;
+  size_t field_lookup_count;  // Number of fields in field_lookup.
+
   flatbuffers::unique_ptr<std::string> original_location;
 };
 
@@ -459,6 +470,7 @@ struct IDLOptions {
   bool scoped_enums;
   bool include_dependence_headers;
   bool mutable_buffer;
+  bool checked_accessors;
   bool one_file;
   bool proto_mode;
   bool proto_oneof_union;
@@ -467,9 +479,11 @@ struct IDLOptions {
   bool generate_name_strings;
   bool generate_object_based_api;
   bool gen_compare;
+  bool gen_json;
   std::string cpp_object_api_pointer_type;
   std::string cpp_object_api_string_type;
   bool cpp_object_api_string_flexible_constructor;
+  bool cpp_object_api_arena;
   bool gen_nullable;
   bool gen_generated;
   std::string object_prefix;
@@ -477,6 +491,7 @@ struct IDLOptions {
   bool union_value_namespacing;
   bool allow_non_utf8;
   bool natural_utf8;
+  bool fixed_precision_floats;
   std::string include_prefix;
   bool keep_include_path;
   bool binary_schema_comments;
@@ -537,6 +552,7 @@ struct IDLOptions {
         scoped_enums(false),
         include_dependence_headers(true),
         mutable_buffer(false),
+        checked_accessors(false),
         one_file(false),
         proto_mode(false),
         proto_oneof_union(false),
@@ -545,14 +561,17 @@ struct IDLOptions {
         generate_name_strings(false),
         generate_object_based_api(false),
         gen_compare(false),
+        gen_json(false),
         cpp_object_api_pointer_type("std::unique_ptr"),
         cpp_object_api_string_flexible_constructor(false),
+        cpp_object_api_arena(false),
         gen_nullable(false),
         gen_generated(false),
         object_suffix("T"),
         union_value_namespacing(true),
         allow_non_utf8(false),
         natural_utf8(false),
+        fixed_precision_floats(false),
         keep_include_path(false),
         binary_schema_comments(false),
         binary_schema_builtins(false),
@@ -572,6 +591,7 @@ struct IDLOptions {
 struct ParserState {
   ParserState()
       : cursor_(nullptr),
+        end_(nullptr),
         line_start_(nullptr),
         line_(0),
         token_(-1),
@@ -580,6 +600,7 @@ struct ParserState {
  protected:
   void ResetState(const char *source) {
     cursor_ = source;
+    end_ = source + strlen(source);
     line_ = 0;
     MarkNewLine();
   }
@@ -595,6 +616,7 @@ struct ParserState {
   }
 
   const char *cursor_;
+  const char *end_;  // The terminating 0, for reading blocks of chars.
   const char *line_start_;
   int line_;  // the current line being parsed
   int token_;
@@ -662,6 +684,8 @@ class Parser : public ParserState {
         opts(options),
         uses_flexbuffers_(false),
         source_(nullptr),
+        external_buffer_(nullptr),
+        external_buffer_size_(0),
         anonymous_counter(0),
         recurse_protection_counter(0) {
     if (opts.force_defaults) {
@@ -681,6 +705,7 @@ class Parser : public ParserState {
     known_attributes_["bit_flags"] = true;
     known_attributes_["original_order"] = true;
     known_attributes_["nested_flatbuffer"] = true;
+    known_attributes_["hash_index"] = true;
     known_attributes_["csharp_partial"] = true;
     known_attributes_["streaming"] = true;
     known_attributes_["idempotent"] = true;
@@ -732,6 +757,23 @@ class Parser : public ParserState {
   // See reflection/reflection.fbs
   void Serialize();
 
+  // Makes the generators output the FlatBuffer `buf` (e.g. a memory-mapped
+  // file) instead of the contents of builder_, without copying it. It must
+  // stay valid until this is called again with nullptr.
+  void SetExternalBuffer(const uint8_t *buf, size_t size) {
+    external_buffer_ = buf;
+    external_buffer_size_ = buf ? size : 0;
+  }
+
+  // The FlatBuffer the generators output: the external one if set, or else
+  // the one in builder_. Check the size before getting the pointer.
+  size_t GetBufferSize() const {
+    return external_buffer_ ? external_buffer_size_ : builder_.GetSize();
+  }
+  const uint8_t *GetBufferPointer() const {
+    return external_buffer_ ? external_buffer_ : builder_.GetBufferPointer();
+  }
+
   // Deserialize a schema buffer
   bool Deserialize(const uint8_t *buf, const size_t size);
 
@@ -825,7 +867,8 @@ class Parser : public ParserState {
   FLATBUFFERS_CHECKED_ERROR SkipAnyJsonValue();
   FLATBUFFERS_CHECKED_ERROR ParseFlexBufferValue(flexbuffers::Builder *builder);
   FLATBUFFERS_CHECKED_ERROR StartParseFile(const char *source,
-                                           const char *source_filename);
+                                           const char *source_filename,
+                                           int line = 1);
   FLATBUFFERS_CHECKED_ERROR ParseRoot(const char *_source,
                                     const char **include_paths,
                                     const char *source_filename);
@@ -833,6 +876,10 @@ class Parser : public ParserState {
                                            const char **include_paths,
                                            const char *source_filename,
                                            const char *include_filename);
+  FLATBUFFERS_CHECKED_ERROR DoParseJson(const char *_source,
+                                        const char *source_filename = nullptr,
+                                        int line = 1);
+  FLATBUFFERS_CHECKED_ERROR ParseJsonRoot();
   FLATBUFFERS_CHECKED_ERROR CheckClash(std::vector<FieldDef*> &fields,
                                        StructDef *struct_def,
                                        const char *suffix,
@@ -871,12 +918,52 @@ class Parser : public ParserState {
  private:
   const char *source_;
 
+  const uint8_t *external_buffer_;
+  size_t external_buffer_size_;
+
   std::string file_being_parsed_;
 
   std::vector<std::pair<Value, FieldDef *>> field_stack_;
 
   int anonymous_counter;
   int recurse_protection_counter;
+
+  friend class JsonConverter;
+};
+
+// Converts JSON to binary FlatBuffers using the schema of another Parser,
+// without parsing the schema again. The schema is only read, so any number of
+// converters (e.g. one per thread) can share one Parser, as long as it isn't
+// used to parse anything else at the same time. Each converter has its own
+// builder and parsing state, which it reuses between calls.
+class JsonConverter {
+ public:
+  explicit JsonConverter(const Parser &schema);
+  ~JsonConverter();
+
+  // Parses a JSON object of the schema's root type into builder().
+  bool Parse(const char *json);
+
+  // Converts newline-delimited JSON read from `in`: one object of the root
+  // type per line, blank lines skipped. Each is written to `out` as a
+  // size-prefixed FlatBuffer, one after another. The input is read in large
+  // blocks, and each line parsed in place with the same builder. Stops at the
+  // first line that can't be converted, or at a read or write error, with
+  // error() set. source_filename is only used in error messages.
+  bool ConvertStream(std::istream &in, std::ostream &out,
+                     const char *source_filename = nullptr);
+
+  // Holds the FlatBuffer from the last successful call to Parse().
+  FlatBufferBuilder &builder() { return parser_.builder_; }
+
+  // User readable error if Parse() == false.
+  const std::string &error() const { return parser_.error_; }
+
+ private:
+  JsonConverter(const JsonConverter &);
+  JsonConverter &operator=(const JsonConverter &);
+
+  Parser parser_;
 };
 
 // Utility functions for multiple generators:
@@ -898,6 +985,26 @@ extern bool GenerateTextFromTable(const Parser &parser,
 extern bool GenerateText(const Parser &parser,
                          const void *flatbuffer,
                          std::string *text);
+
+// Receives text in chunks from GenerateText below, e.g. to write it to a
+// file or socket as it is generated.
+class TextSink {
+ public:
+  virtual ~TextSink() {}
+  // Return false to stop generating (e.g. on a write error).
+  virtual bool Write(const char *data, size_t size) = 0;
+};
+
+// Like GenerateText above, but passes the text on to sink in chunks of about
+// chunk_size bytes while generating, so the whole text is never in memory.
+// Returns false if sink returns false.
+extern bool GenerateText(const Parser &parser,
+                         const void *flatbuffer,
+                         TextSink *sink,
+                         size_t chunk_size = 1 << 16);
+// Writes the text of the parser's buffer to path + file_name + ".json". Unless
+// a custom SaveFileFunction is set, it is streamed to a temporary file that
+// replaces the file once complete.
 extern bool GenerateTextFile(const Parser &parser,
                              const std::string &path,
                              const std::string &file_name);
@@ -1017,6 +1124,12 @@ extern std::string TextMakeRule(const Parser &parser,
                                 const std::string &path,
                                 const std::string &file_names);
 
+// The name of the binary file GenerateBinary writes for file_name.
+// See idl_gen_general.cpp.
+extern std::string BinaryFileName(const Parser &parser,
+                                  const std::string &path,
+                                  const std::string &file_name);
+
 // Generate a make rule for the generated binary files.
 // See idl_gen_general.cpp.
 extern std::string BinaryMakeRule(const Parser &parser,
@@ -0,0 +1,609 @@
+/*
+ * Copyright 2019 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_JSON_H_
+#define FLATBUFFERS_JSON_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/flexbuffers.h"
+#include "flatbuffers/hash.h"
+#include "flatbuffers/util.h"
+
+// Limits the depth of nested objects and arrays, like for the Parser (see
+// idl.h), so deeply nested JSON can't overflow the stack.
+#if !defined(FLATBUFFERS_MAX_PARSING_DEPTH)
+#  define FLATBUFFERS_MAX_PARSING_DEPTH 64
+#endif
+
+namespace flatbuffers {
+
+// Support code for the JSON serializers and parsers generated with
+// --gen-json (C++ only).
+// The generated ToJson() and FromJson() functions know the names and types
+// of all fields at compile time, so unlike GenerateText() and the Parser
+// they don't need the schema at runtime. All they need is the writer and
+// reader below, which deal with the JSON syntax.
+
+// Writes JSON in the same format GenerateText() does.
+class JsonWriter {
+ public:
+  // Appends to text. A negative indent_step puts everything on one line.
+  // With strict_json, field names are quoted.
+  explicit JsonWriter(std::string *text, int indent_step = 2,
+                      bool strict_json = false)
+      : text_(*text), indent_step_(indent_step), strict_json_(strict_json) {}
+
+  void StartObject() {
+    text_ += '{';
+    counts_.push_back(0);
+  }
+
+  // Starts the next field of the current object.
+  void Key(const char *name) {
+    if (counts_.back()++) text_ += ',';
+    NewLine();
+    text_.append(Indent(counts_.size()), ' ');
+    if (strict_json_) text_ += '\"';
+    text_ += name;
+    if (strict_json_) text_ += '\"';
+    text_ += ": ";
+  }
+
+  void EndObject() { End('}'); }
+
+  void StartArray() {
+    text_ += '[';
+    NewLine();
+    counts_.push_back(0);
+  }
+
+  // Starts the next element of the current array.
+  void Element() {
+    if (counts_.back()++) {
+      text_ += ',';
+      NewLine();
+    }
+    text_.append(Indent(counts_.size()), ' ');
+  }
+
+  void EndArray() { End(']'); }
+
+  template<typename T> void Number(T val) { text_ += NumToString(val); }
+  void Number(float val) { text_ += FloatToShortestString(val); }
+  void Number(double val) { text_ += FloatToShortestString(val); }
+
+  void Bool(bool val) { text_ += val ? "true" : "false"; }
+
+  // The name of an enum value.
+  void Enum(const char *name) {
+    text_ += '\"';
+    text_ += name;
+    text_ += '\"';
+  }
+
+  // Returns false if the string is not valid UTF-8.
+  bool String(const flatbuffers::String *str) {
+    return EscapeString(str->c_str(), str->size(), &text_, false, false);
+  }
+
+  void FlexBuffer(const Vector<uint8_t> *buf) {
+    flexbuffers::GetRoot(buf->data(), buf->size())
+        .ToString(true, strict_json_, text_);
+  }
+
+ private:
+  JsonWriter(const JsonWriter &);
+  JsonWriter &operator=(const JsonWriter &);
+
+  void NewLine() {
+    if (indent_step_ >= 0) text_ += '\n';
+  }
+
+  size_t Indent(size_t depth) const {
+    return depth * static_cast<size_t>(std::max(indent_step_, 0));
+  }
+
+  void End(char close) {
+    counts_.pop_back();
+    NewLine();
+    text_.append(Indent(counts_.size()), ' ');
+    text_ += close;
+    // Like GenerateText(), end a complete document with a newline.
+    if (counts_.empty()) NewLine();
+  }
+
+  std::string &text_;
+  int indent_step_;
+  bool strict_json_;
+  // The number of fields or elements written so far, for each open object or
+  // array.
+  std::vector<size_t> counts_;
+};
+
+// Reads JSON as accepted by the Parser: field names may be unquoted,
+// strings may use single quotes, comments and trailing commas are allowed.
+// All functions return false on error, after which error() says what went
+// wrong.
+class JsonReader {
+ public:
+  // json must be 0-terminated. If skip_unknown_fields is false, fields that
+  // are not in the schema are an error.
+  explicit JsonReader(const char *json, bool skip_unknown_fields = false)
+      : start_(json),
+        cursor_(json),
+        first_(true),
+        depth_(0),
+        skip_unknown_fields_(skip_unknown_fields) {}
+
+  bool ok() const { return error_.empty(); }
+  const std::string &error() const { return error_; }
+
+  // Records an error at the current position, and returns false.
+  bool Error(const std::string &msg) {
+    if (error_.empty()) {
+      int line = 1;
+      for (auto p = start_; p < cursor_; p++) line += *p == '\n';
+      error_ = "line " + NumToString(line) + ": error: " + msg;
+    }
+    return false;
+  }
+
+  bool StartObject() {
+    first_ = true;
+    return Nest() && Expect('{');
+  }
+
+  // Reads the name of the next field of the current object into key().
+  // Returns false at the end of the object, or on error.
+  bool NextKey() {
+    if (!NextItem('}')) return false;
+    if (IsQuote(*cursor_)) {
+      if (!ParseString(&key_)) return false;
+    } else {
+      auto ident = cursor_;
+      while (is_alnum(*cursor_) || *cursor_ == '_') cursor_++;
+      if (ident == cursor_) return Error("field name expected");
+      key_.assign(ident, cursor_);
+    }
+    return Expect(':');
+  }
+
+  const std::string &key() const { return key_; }
+
+  template<size_t N> bool KeyIs(const char (&name)[N]) const {
+    return key_.size() == N - 1 && !memcmp(key_.data(), name, N - 1);
+  }
+
+  bool StartArray() {
+    first_ = true;
+    return Nest() && Expect('[');
+  }
+
+  // Returns false at the end of the current array, or on error.
+  bool NextElement() { return NextItem(']'); }
+
+  // Returns the next character that isn't whitespace, without consuming it.
+  char Peek() {
+    SkipSpace();
+    return *cursor_;
+  }
+
+  // Consumes a null, if that is what comes next.
+  bool Null() {
+    SkipSpace();
+    if (!IsWord("null")) return false;
+    cursor_ += 4;
+    return true;
+  }
+
+  // Reads a string into str().
+  bool String() {
+    SkipSpace();
+    if (!IsQuote(*cursor_)) return Error("string constant expected");
+    return ParseString(&str_);
+  }
+
+  const std::string &str() const { return str_; }
+
+  // Reads a number. Like the Parser, this also accepts true and false, and
+  // numbers in quotes.
+  template<typename T> bool Number(T *val) {
+    SkipSpace();
+    if (IsQuote(*cursor_)) {
+      if (!ParseString(&str_)) return false;
+      return StringToNumber(str_.c_str(), val) ||
+             Error("invalid number: " + str_);
+    }
+    if (IsWord("true") || IsWord("false")) {
+      *val = static_cast<T>(*cursor_ == 't');
+      cursor_ += *cursor_ == 't' ? 4 : 5;
+      return true;
+    }
+    char buf[64];
+    if (!NumberToken(buf, sizeof(buf))) return false;
+    return StringToNumber(buf, val) ||
+           Error("invalid number: " + std::string(buf));
+  }
+
+  bool Bool(bool *val) {
+    uint8_t b = 0;
+    if (!Number(&b)) return false;
+    *val = b != 0;
+    return true;
+  }
+
+  // Reads a number, or the hash of a string or identifier, for fields with
+  // the hash attribute.
+  template<typename T, typename H>
+  bool HashedNumber(T *val, H (*hash)(const char *)) {
+    SkipSpace();
+    if (IsQuote(*cursor_)) {
+      if (!ParseString(&str_)) return false;
+    } else if (is_alpha(*cursor_) || *cursor_ == '_') {
+      auto ident = cursor_;
+      str_.assign(ident, Identifier());
+    } else {
+      return Number(val);
+    }
+    *val = static_cast<T>(hash(str_.c_str()));
+    return true;
+  }
+
+  // Reads an enum value: a number, or one or more (space separated, or'ed
+  // together) value names, quoted or not.
+  template<typename T>
+  bool Enum(T *val, const char *const *names, const T *values, size_t count) {
+    SkipSpace();
+    if (IsQuote(*cursor_)) {
+      if (!ParseString(&str_)) return false;
+    } else if (is_alpha(*cursor_) || *cursor_ == '_') {
+      auto ident = cursor_;
+      str_.assign(ident, Identifier());
+    } else {
+      return Number(val);
+    }
+    T result = 0;
+    for (auto word = str_.c_str(); *word;) {
+      if (*word == ' ') {
+        word++;
+        continue;
+      }
+      auto end = word;
+      while (*end && *end != ' ') end++;
+      // Allow names qualified with the enum name, e.g. Color.Red.
+      auto name = word;
+      for (auto p = word; p < end; p++) {
+        if (*p == '.') name = p + 1;
+      }
+      auto len = static_cast<size_t>(end - name);
+      size_t i = 0;
+      while (i < count &&
+             (strlen(names[i]) != len || memcmp(names[i], name, len))) {
+        i++;
+      }
+      if (i < count) {
+        result = static_cast<T>(result | values[i]);
+      } else {
+        T num;
+        std::string numstr(word, end);
+        if (!StringToNumber(numstr.c_str(), &num)) {
+          return Error("unknown enum value: " + numstr);
+        }
+        result = static_cast<T>(result | num);
+      }
+      word = end;
+    }
+    *val = result;
+    return true;
+  }
+
+  // Reads any JSON value into a FlexBuffer.
+  bool FlexBuffer(flexbuffers::Builder *builder) {
+    SkipSpace();
+    if (*cursor_ == '{') {
+      auto start = builder->StartMap();
+      if (!StartObject()) return false;
+      while (NextKey()) {
+        builder->Key(key_);
+        if (!FlexBuffer(builder)) return false;
+      }
+      if (!ok()) return false;
+      builder->EndMap(start);
+    } else if (*cursor_ == '[') {
+      auto start = builder->StartVector();
+      if (!StartArray()) return false;
+      while (NextElement()) {
+        if (!FlexBuffer(builder)) return false;
+      }
+      if (!ok()) return false;
+      builder->EndVector(start, false, false);
+    } else if (IsQuote(*cursor_)) {
+      if (!ParseString(&str_)) return false;
+      builder->String(str_);
+    } else if (IsWord("true") || IsWord("false")) {
+      builder->Bool(*cursor_ == 't');
+      cursor_ += *cursor_ == 't' ? 4 : 5;
+    } else if (Null()) {
+      builder->Null();
+    } else {
+      char buf[64];
+      if (!NumberToken(buf, sizeof(buf))) return false;
+      int64_t i;
+      double d;
+      if (StringToNumber(buf, &i)) {
+        builder->Int(i);
+      } else if (StringToNumber(buf, &d)) {
+        builder->Double(d);
+      } else {
+        return Error("invalid number: " + std::string(buf));
+      }
+    }
+    return true;
+  }
+
+  // Reads any JSON value into a FlexBuffer, and stores it in fbb as the
+  // contents of a flexbuffer field.
+  bool FlexBuffer(FlatBufferBuilder &fbb, Offset<Vector<uint8_t>> *vec) {
+    flexbuffers::Builder builder(1024, flexbuffers::BUILDER_FLAG_SHARE_ALL);
+    if (!FlexBuffer(&builder)) return false;
+    builder.Finish();
+    // Force alignment for nested flexbuffer
+    fbb.ForceVectorAlignment(builder.GetSize(), sizeof(uint8_t),
+                             sizeof(largest_scalar_t));
+    *vec = fbb.CreateVector(builder.GetBuffer());
+    return true;
+  }
+
+  // Skips over any JSON value.
+  bool SkipValue() {
+    SkipSpace();
+    if (*cursor_ == '{') {
+      if (!StartObject()) return false;
+      while (NextKey()) {
+        if (!SkipValue()) return false;
+      }
+      return ok();
+    } else if (*cursor_ == '[') {
+      if (!StartArray()) return false;
+      while (NextElement()) {
+        if (!SkipValue()) return false;
+      }
+      return ok();
+    } else if (IsQuote(*cursor_)) {
+      return ParseString(&str_);
+    } else {
+      char buf[64];
+      return NumberToken(buf, sizeof(buf));
+    }
+  }
+
+  // Called for a field that is not in the schema.
+  bool SkipUnknownField() {
+    if (!skip_unknown_fields_ && key_ != "$schema") {
+      return Error("unknown field: " + key_);
+    }
+    return SkipValue();
+  }
+
+  // Checks that nothing but whitespace follows the root value.
+  bool ExpectEnd() {
+    SkipSpace();
+    return !*cursor_ || Error("unexpected text after the root value");
+  }
+
+  // Marks and rewinds to a position in the text, for values that have to be
+  // parsed after other values that follow them, like unions whose type comes
+  // after the value.
+  const char *Mark() const { return cursor_; }
+  void Rewind(const char *mark) { cursor_ = mark; }
+
+ private:
+  JsonReader(const JsonReader &);
+  JsonReader &operator=(const JsonReader &);
+
+  static bool IsQuote(char c) { return c == '\"' || c == '\''; }
+
+  bool IsWord(const char *word) const {
+    auto len = strlen(word);
+    return !strncmp(cursor_, word, len) && !is_alnum(cursor_[len]) &&
+           cursor_[len] != '_';
+  }
+
+  void SkipSpace() {
+    for (;;) {
+      auto c = *cursor_;
+      if (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+        cursor_++;
+      } else if (c == '/' && cursor_[1] == '/') {
+        while (*cursor_ && *cursor_ != '\n') cursor_++;
+      } else if (c == '/' && cursor_[1] == '*') {
+        auto end = strstr(cursor_ + 2, "*/");
+        cursor_ = end ? end + 2 : cursor_ + strlen(cursor_);
+      } else {
+        return;
+      }
+    }
+  }
+
+  bool Expect(char c) {
+    SkipSpace();
+    if (*cursor_ != c) return Error(std::string("expecting: ") + c);
+    cursor_++;
+    return true;
+  }
+
+  // Enters an object or array, unless that would nest them too deeply.
+  bool Nest() {
+    if (depth_ >= FLATBUFFERS_MAX_PARSING_DEPTH) {
+      return Error("maximum parsing recursion of " +
+                   NumToString(FLATBUFFERS_MAX_PARSING_DEPTH) + " reached");
+    }
+    depth_++;
+    return true;
+  }
+
+  // Starts the next field or element of the current object or array.
+  bool NextItem(char close) {
+    SkipSpace();
+    if (!first_) {
+      if (*cursor_ == ',') {
+        cursor_++;
+        SkipSpace();
+      } else if (*cursor_ != close) {
+        return Error(std::string("expecting: , or ") + close);
+      }
+    }
+    if (*cursor_ == close) {
+      cursor_++;
+      depth_--;
+      // The object or array is a value of its parent, which has now had at
+      // least one item.
+      first_ = false;
+      return false;
+    }
+    first_ = false;
+    return true;
+  }
+
+  // Skips an identifier, which may be qualified, and returns its end.
+  const char *Identifier() {
+    while (is_alnum(*cursor_) || *cursor_ == '_' || *cursor_ == '.') cursor_++;
+    return cursor_;
+  }
+
+  // Copies the characters of a number (or of true, nan, inf etc.) into buf.
+  bool NumberToken(char *buf, size_t size) {
+    auto begin = cursor_;
+    while (is_alnum(*cursor_) || *cursor_ == '.' || *cursor_ == '+' ||
+           *cursor_ == '-' || *cursor_ == '_') {
+      cursor_++;
+    }
+    auto len = static_cast<size_t>(cursor_ - begin);
+    if (!len) {
+      return Error(*cursor_ ? std::string("unexpected character: ") + *cursor_
+                            : std::string("unexpected end of text"));
+    }
+    if (len >= size) return Error("number too long");
+    memcpy(buf, begin, len);
+    buf[len] = 0;
+    return true;
+  }
+
+  bool ParseHex(int digits, uint32_t *val) {
+    *val = 0;
+    for (int i = 0; i < digits; i++) {
+      auto c = *cursor_;
+      if (!is_xdigit(c)) {
+        return Error("escape code must be followed by hex digits");
+      }
+      auto digit = is_digit(c) ? c - '0' : (c | 0x20) - 'a' + 10;
+      *val = *val * 16 + static_cast<uint32_t>(digit);
+      cursor_++;
+    }
+    return true;
+  }
+
+  // Reads a quoted string, decoding escape codes.
+  bool ParseString(std::string *s) {
+    auto quote = *cursor_++;
+    s->clear();
+    for (;;) {
+      // Copy runs of plain characters in one go.
+      auto run = cursor_;
+      while (static_cast<unsigned char>(*cursor_) >= ' ' &&
+             static_cast<unsigned char>(*cursor_) < 0x80 &&
+             *cursor_ != quote && *cursor_ != '\\') {
+        cursor_++;
+      }
+      s->append(run, cursor_);
+      auto c = *cursor_;
+      if (c == quote) {
+        cursor_++;
+        return true;
+      } else if (c == '\\') {
+        cursor_++;
+        switch (*cursor_++) {
+          case 'n': *s += '\n'; break;
+          case 't': *s += '\t'; break;
+          case 'r': *s += '\r'; break;
+          case 'b': *s += '\b'; break;
+          case 'f': *s += '\f'; break;
+          case '\"': *s += '\"'; break;
+          case '\'': *s += '\''; break;
+          case '\\': *s += '\\'; break;
+          case '/': *s += '/'; break;
+          case 'x': {
+            uint32_t val;
+            if (!ParseHex(2, &val)) return false;
+            *s += static_cast<char>(val);
+            break;
+          }
+          case 'u': {
+            uint32_t val;
+            if (!ParseHex(4, &val)) return false;
+            if (val >= 0xD800 && val <= 0xDBFF) {
+              // A high surrogate, which must be followed by a low one.
+              uint32_t low;
+              if (cursor_[0] != '\\' || cursor_[1] != 'u') {
+                return Error("illegal Unicode sequence (unpaired high "
+                             "surrogate)");
+              }
+              cursor_ += 2;
+              if (!ParseHex(4, &low)) return false;
+              if (low < 0xDC00 || low > 0xDFFF) {
+                return Error("illegal Unicode sequence (multiple high "
+                             "surrogates)");
+              }
+              val = (((val & 0x3FF) << 10) | (low & 0x3FF)) + 0x10000;
+            } else if (val >= 0xDC00 && val <= 0xDFFF) {
+              return Error("illegal Unicode sequence (unpaired low "
+                           "surrogate)");
+            }
+            ToUTF8(val, s);
+            break;
+          }
+          default:
+            cursor_--;
+            return Error("unknown escape code in string constant");
+        }
+      } else if (static_cast<unsigned char>(c) >= 0x80) {
+        auto utf8 = cursor_;
+        if (FromUTF8(&utf8) < 0) return Error("illegal UTF-8 sequence");
+        s->append(cursor_, utf8);
+        cursor_ = utf8;
+      } else if (c) {
+        return Error("illegal character in string constant");
+      } else {
+        return Error("unterminated string constant");
+      }
+    }
+  }
+
+  const char *start_;
+  const char *cursor_;
+  // Whether the current object or array has had no items yet.
+  bool first_;
+  // Number of objects and arrays the cursor is in.
+  int depth_;
+  bool skip_unknown_fields_;
+  std::string key_;
+  std::string str_;
+  std::string error_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_JSON_H_
@@ -430,6 +430,66 @@ void ResizeVector(const reflection::Schema &schema, uoffset_t newsize, T val,
   }
 }
 
+// Records several string and vector resizes inside one FlatBuffer, and
+// applies them all at once when you call Apply(). SetString and ResizeVector
+// each walk the whole buffer and move everything after the change, so
+// editing many strings or vectors of a large buffer is a lot faster this way.
+// The strings and vectors must be distinct and live inside "flatbuf", which
+// must not be changed otherwise until Apply(), which may invalidate them.
+// If your FlatBuffer's root table is not the schema's root table, you should
+// pass in your root_table type as well.
+class ResizeBatch {
+ public:
+  ResizeBatch(const reflection::Schema &schema, std::vector<uint8_t> *flatbuf,
+              const reflection::Object *root_table = nullptr)
+      : schema_(schema), flatbuf_(flatbuf), root_table_(root_table) {}
+
+  // Changes the contents of a string, see SetString above.
+  void SetString(const std::string &val, const String *str);
+
+  // Resizes a vector, see ResizeAnyVector above. New elements are set to
+  // the elem_size bytes at "elem", or to 0 if it is null.
+  void ResizeAnyVector(uoffset_t newsize, const VectorOfAny *vec,
+                       uoffset_t num_elems, uoffset_t elem_size,
+                       const uint8_t *elem = nullptr);
+
+  // Resizes a vector, setting any new elements to "val".
+  template<typename T>
+  void ResizeVector(uoffset_t newsize, T val, const Vector<T> *vec) {
+    uint8_t elem[sizeof(T)];
+    auto is_scalar = flatbuffers::is_scalar<T>::value;
+    if (is_scalar) {
+      WriteScalar(elem, val);
+    } else {  // struct
+      memcpy(elem, &val, sizeof(T));
+    }
+    ResizeAnyVector(newsize, reinterpret_cast<const VectorOfAny *>(vec),
+                    vec->size(), static_cast<uoffset_t>(sizeof(T)), elem);
+  }
+
+  // Resizes the buffer once for all the changes recorded above.
+  void Apply();
+
+  struct Resize {
+    uoffset_t len_loc;  // Length field of the string or vector.
+    uoffset_t new_len;
+    uoffset_t start;  // Where bytes are inserted or removed.
+    int delta;
+    uoffset_t clear_begin;  // Old data to clear before resizing.
+    uoffset_t clear_end;
+    std::vector<uint8_t> data;  // New data to write at start.
+  };
+
+ private:
+  // Rounds a size change to a multiple of the largest scalar size.
+  static int AlignDelta(int delta);
+
+  const reflection::Schema &schema_;
+  std::vector<uint8_t> *flatbuf_;
+  const reflection::Object *root_table_;
+  std::vector<Resize> resizes_;
+};
+
 // Adds any new data (in the form of a new FlatBuffer) to an existing
 // FlatBuffer. This can be used when any of the above methods are not
 // sufficient, in particular for adding new tables and new fields.
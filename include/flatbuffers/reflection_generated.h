@@ -152,6 +152,16 @@ inline flatbuffers::Offset<Type> CreateType(
     BaseType base_type = None,
     BaseType element = None,
     int32_t index = -1) {
+  if (!flatbuffers::IsTheSameAs<int8_t>(static_cast<int8_t>(base_type), 0) &&
+      !flatbuffers::IsTheSameAs<int8_t>(static_cast<int8_t>(element), 0) &&
+      !flatbuffers::IsTheSameAs<int32_t>(index, -1)) {
+    static const flatbuffers::voffset_t vtable_[] = { 10, 10, 8, 9, 4 };
+    auto table_ = _fbb.StartFixedTable(10, 4);
+    flatbuffers::WriteScalar<int8_t>(table_ + 8, static_cast<int8_t>(base_type));
+    flatbuffers::WriteScalar<int8_t>(table_ + 9, static_cast<int8_t>(element));
+    flatbuffers::WriteScalar<int32_t>(table_ + 4, index);
+    return flatbuffers::Offset<Type>(_fbb.EndFixedTable(vtable_));
+  }
   TypeBuilder builder_(_fbb);
   builder_.add_index(index);
   builder_.add_element(element);
@@ -212,6 +222,14 @@ inline flatbuffers::Offset<KeyValue> CreateKeyValue(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<flatbuffers::String> key = 0,
     flatbuffers::Offset<flatbuffers::String> value = 0) {
+  if (key.o &&
+      value.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 8, 12, 4, 8 };
+    auto table_ = _fbb.StartFixedTable(12, 4);
+    _fbb.AddFixedOffset(table_, 4, key);
+    _fbb.AddFixedOffset(table_, 8, value);
+    return flatbuffers::Offset<KeyValue>(_fbb.EndFixedTable(vtable_));
+  }
   KeyValueBuilder builder_(_fbb);
   builder_.add_value(value);
   builder_.add_key(key);
@@ -313,6 +331,20 @@ inline flatbuffers::Offset<EnumVal> CreateEnumVal(
     flatbuffers::Offset<Object> object = 0,
     flatbuffers::Offset<Type> union_type = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> documentation = 0) {
+  if (name.o &&
+      !flatbuffers::IsTheSameAs<int64_t>(value, 0) &&
+      object.o &&
+      union_type.o &&
+      documentation.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 14, 28, 4, 8, 16, 20, 24 };
+    auto table_ = _fbb.StartFixedTable(28, 8);
+    _fbb.AddFixedOffset(table_, 4, name);
+    flatbuffers::WriteScalar<int64_t>(table_ + 8, value);
+    _fbb.AddFixedOffset(table_, 16, object);
+    _fbb.AddFixedOffset(table_, 20, union_type);
+    _fbb.AddFixedOffset(table_, 24, documentation);
+    return flatbuffers::Offset<EnumVal>(_fbb.EndFixedTable(vtable_));
+  }
   EnumValBuilder builder_(_fbb);
   builder_.add_value(value);
   builder_.add_documentation(documentation);
@@ -437,6 +469,22 @@ inline flatbuffers::Offset<Enum> CreateEnum(
     flatbuffers::Offset<Type> underlying_type = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> documentation = 0) {
+  if (name.o &&
+      values.o &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(is_union), 0) &&
+      underlying_type.o &&
+      attributes.o &&
+      documentation.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 16, 25, 4, 8, 24, 12, 16, 20 };
+    auto table_ = _fbb.StartFixedTable(25, 4);
+    _fbb.AddFixedOffset(table_, 4, name);
+    _fbb.AddFixedOffset(table_, 8, values);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 24, static_cast<uint8_t>(is_union));
+    _fbb.AddFixedOffset(table_, 12, underlying_type);
+    _fbb.AddFixedOffset(table_, 16, attributes);
+    _fbb.AddFixedOffset(table_, 20, documentation);
+    return flatbuffers::Offset<Enum>(_fbb.EndFixedTable(vtable_));
+  }
   EnumBuilder builder_(_fbb);
   builder_.add_documentation(documentation);
   builder_.add_attributes(attributes);
@@ -608,6 +656,32 @@ inline flatbuffers::Offset<Field> CreateField(
     bool key = false,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> documentation = 0) {
+  if (name.o &&
+      type.o &&
+      !flatbuffers::IsTheSameAs<uint16_t>(id, 0) &&
+      !flatbuffers::IsTheSameAs<uint16_t>(offset, 0) &&
+      !flatbuffers::IsTheSameAs<int64_t>(default_integer, 0) &&
+      !flatbuffers::IsTheSameAs<double>(default_real, 0.0) &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(deprecated), 0) &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(required), 0) &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(key), 0) &&
+      attributes.o &&
+      documentation.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 26, 43, 4, 24, 36, 38, 8, 16, 40, 41, 42, 28, 32 };
+    auto table_ = _fbb.StartFixedTable(43, 8);
+    _fbb.AddFixedOffset(table_, 4, name);
+    _fbb.AddFixedOffset(table_, 24, type);
+    flatbuffers::WriteScalar<uint16_t>(table_ + 36, id);
+    flatbuffers::WriteScalar<uint16_t>(table_ + 38, offset);
+    flatbuffers::WriteScalar<int64_t>(table_ + 8, default_integer);
+    flatbuffers::WriteScalar<double>(table_ + 16, default_real);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 40, static_cast<uint8_t>(deprecated));
+    flatbuffers::WriteScalar<uint8_t>(table_ + 41, static_cast<uint8_t>(required));
+    flatbuffers::WriteScalar<uint8_t>(table_ + 42, static_cast<uint8_t>(key));
+    _fbb.AddFixedOffset(table_, 28, attributes);
+    _fbb.AddFixedOffset(table_, 32, documentation);
+    return flatbuffers::Offset<Field>(_fbb.EndFixedTable(vtable_));
+  }
   FieldBuilder builder_(_fbb);
   builder_.add_default_real(default_real);
   builder_.add_default_integer(default_integer);
@@ -758,6 +832,24 @@ inline flatbuffers::Offset<Object> CreateObject(
     int32_t bytesize = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> documentation = 0) {
+  if (name.o &&
+      fields.o &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(is_struct), 0) &&
+      !flatbuffers::IsTheSameAs<int32_t>(minalign, 0) &&
+      !flatbuffers::IsTheSameAs<int32_t>(bytesize, 0) &&
+      attributes.o &&
+      documentation.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 18, 29, 4, 8, 28, 12, 16, 20, 24 };
+    auto table_ = _fbb.StartFixedTable(29, 4);
+    _fbb.AddFixedOffset(table_, 4, name);
+    _fbb.AddFixedOffset(table_, 8, fields);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 28, static_cast<uint8_t>(is_struct));
+    flatbuffers::WriteScalar<int32_t>(table_ + 12, minalign);
+    flatbuffers::WriteScalar<int32_t>(table_ + 16, bytesize);
+    _fbb.AddFixedOffset(table_, 20, attributes);
+    _fbb.AddFixedOffset(table_, 24, documentation);
+    return flatbuffers::Offset<Object>(_fbb.EndFixedTable(vtable_));
+  }
   ObjectBuilder builder_(_fbb);
   builder_.add_documentation(documentation);
   builder_.add_attributes(attributes);
@@ -880,6 +972,20 @@ inline flatbuffers::Offset<RPCCall> CreateRPCCall(
     flatbuffers::Offset<Object> response = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> documentation = 0) {
+  if (name.o &&
+      request.o &&
+      response.o &&
+      attributes.o &&
+      documentation.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 14, 24, 4, 8, 12, 16, 20 };
+    auto table_ = _fbb.StartFixedTable(24, 4);
+    _fbb.AddFixedOffset(table_, 4, name);
+    _fbb.AddFixedOffset(table_, 8, request);
+    _fbb.AddFixedOffset(table_, 12, response);
+    _fbb.AddFixedOffset(table_, 16, attributes);
+    _fbb.AddFixedOffset(table_, 20, documentation);
+    return flatbuffers::Offset<RPCCall>(_fbb.EndFixedTable(vtable_));
+  }
   RPCCallBuilder builder_(_fbb);
   builder_.add_documentation(documentation);
   builder_.add_attributes(attributes);
@@ -984,6 +1090,18 @@ inline flatbuffers::Offset<Service> CreateService(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<RPCCall>>> calls = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> documentation = 0) {
+  if (name.o &&
+      calls.o &&
+      attributes.o &&
+      documentation.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 12, 20, 4, 8, 12, 16 };
+    auto table_ = _fbb.StartFixedTable(20, 4);
+    _fbb.AddFixedOffset(table_, 4, name);
+    _fbb.AddFixedOffset(table_, 8, calls);
+    _fbb.AddFixedOffset(table_, 12, attributes);
+    _fbb.AddFixedOffset(table_, 16, documentation);
+    return flatbuffers::Offset<Service>(_fbb.EndFixedTable(vtable_));
+  }
   ServiceBuilder builder_(_fbb);
   builder_.add_documentation(documentation);
   builder_.add_attributes(attributes);
@@ -1101,6 +1219,22 @@ inline flatbuffers::Offset<Schema> CreateSchema(
     flatbuffers::Offset<flatbuffers::String> file_ext = 0,
     flatbuffers::Offset<Object> root_table = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Service>>> services = 0) {
+  if (objects.o &&
+      enums.o &&
+      file_ident.o &&
+      file_ext.o &&
+      root_table.o &&
+      services.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 16, 28, 4, 8, 12, 16, 20, 24 };
+    auto table_ = _fbb.StartFixedTable(28, 4);
+    _fbb.AddFixedOffset(table_, 4, objects);
+    _fbb.AddFixedOffset(table_, 8, enums);
+    _fbb.AddFixedOffset(table_, 12, file_ident);
+    _fbb.AddFixedOffset(table_, 16, file_ext);
+    _fbb.AddFixedOffset(table_, 20, root_table);
+    _fbb.AddFixedOffset(table_, 24, services);
+    return flatbuffers::Offset<Schema>(_fbb.EndFixedTable(vtable_));
+  }
   SchemaBuilder builder_(_fbb);
   builder_.add_services(services);
   builder_.add_root_table(root_table);
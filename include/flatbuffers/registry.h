@@ -17,6 +17,10 @@
 #ifndef FLATBUFFERS_REGISTRY_H_
 #define FLATBUFFERS_REGISTRY_H_
 
+#ifndef FLATBUFFERS_CPP98_STL
+#  include <mutex>
+#endif
+
 #include "flatbuffers/idl.h"
 
 namespace flatbuffers {
@@ -27,12 +31,25 @@ namespace flatbuffers {
 // schema.
 class Registry {
  public:
+  Registry() : generation_(0) {}
+
+  ~Registry() {
+    for (auto it = schemas_.begin(); it != schemas_.end(); ++it) {
+      ClearParsers(it->second);
+    }
+  }
+
   // Call this for all schemas that may be in use. The identifier has
   // a function in the generated code, e.g. MonsterIdentifier().
+  // The schema may also be a binary schema (.bfbs, see `flatc --schema -b`),
+  // which is faster to load than a .fbs file and needs no include paths.
   void Register(const char *file_identifier, const char *schema_path) {
-    Schema schema;
+    Lock lock(mutex_);
+    auto &schema = schemas_[file_identifier];
+    ClearParsers(schema);
     schema.path_ = schema_path;
-    schemas_[file_identifier] = schema;
+    schema.contents_.clear();
+    generation_++;
   }
 
   // Generate text from an arbitrary FlatBuffer by looking up its
@@ -41,18 +58,21 @@ class Registry {
     // Get the identifier out of the buffer.
     // If the buffer is truncated, exit.
     if (len < sizeof(uoffset_t) + FlatBufferBuilder::kFileIdentifierLength) {
-      lasterror_ = "buffer truncated";
+      SetLastError("buffer truncated");
       return false;
     }
     std::string ident(
         reinterpret_cast<const char *>(flatbuf) + sizeof(uoffset_t),
         FlatBufferBuilder::kFileIdentifierLength);
-    // Load and parse the schema.
-    Parser parser;
-    if (!LoadSchema(ident, &parser)) return false;
+    // Get a parser that has the schema loaded.
+    size_t generation;
+    auto parser = AcquireParser(ident, &generation);
+    if (!parser) return false;
     // Now we're ready to generate text.
-    if (!GenerateText(parser, flatbuf, dest)) {
-      lasterror_ = "unable to generate text for FlatBuffer binary";
+    auto ok = GenerateText(*parser, flatbuf, dest);
+    ReleaseParser(ident, parser, generation);
+    if (!ok) {
+      SetLastError("unable to generate text for FlatBuffer binary");
       return false;
     }
     return true;
@@ -63,63 +83,171 @@ class Registry {
   // If DetachedBuffer::data() is null then parsing failed.
   DetachedBuffer TextToFlatBuffer(const char *text,
                                   const char *file_identifier) {
-    // Load and parse the schema.
-    Parser parser;
-    if (!LoadSchema(file_identifier, &parser)) return DetachedBuffer();
-    // Parse the text.
-    if (!parser.Parse(text)) {
-      lasterror_ = parser.error_;
-      return DetachedBuffer();
+    // Get a parser that has the schema loaded.
+    size_t generation;
+    auto parser = AcquireParser(file_identifier, &generation);
+    if (!parser) return DetachedBuffer();
+    // Parse the text. The converter only accepts JSON, so the text can't
+    // change the schema of the parser, which is shared with later calls.
+    DetachedBuffer buf;
+    {
+      JsonConverter converter(*parser);
+      if (converter.Parse(text)) {
+        // We have a valid FlatBuffer. Detach it from the builder.
+        buf = converter.builder().Release();
+      } else {
+        SetLastError(converter.error());
+      }
     }
-    // We have a valid FlatBuffer. Detach it from the builder and return.
-    return parser.builder_.Release();
+    ReleaseParser(file_identifier, parser, generation);
+    return buf;
   }
 
   // Modify any parsing / output options used by the other functions.
-  void SetOptions(const IDLOptions &opts) { opts_ = opts; }
+  void SetOptions(const IDLOptions &opts) {
+    Lock lock(mutex_);
+    opts_ = opts;
+    ClearAllParsers();
+  }
 
   // If schemas used contain include statements, call this function for every
   // directory the parser should search them for.
-  void AddIncludeDirectory(const char *path) { include_paths_.push_back(path); }
+  void AddIncludeDirectory(const char *path) {
+    Lock lock(mutex_);
+    include_paths_.push_back(path);
+    ClearAllParsers();
+  }
 
   // Returns a human readable error if any of the above functions fail.
-  const std::string &GetLastError() { return lasterror_; }
+  // With multiple threads, this is the error of whichever failed last.
+  std::string GetLastError() {
+    Lock lock(mutex_);
+    return lasterror_;
+  }
 
  private:
-  bool LoadSchema(const std::string &ident, Parser *parser) {
-    // Find the schema, if not, exit.
+  struct Schema {
+    std::string path_;
+    // The schema file, loaded on first use.
+    std::string contents_;
+    // Parsers with this schema loaded that are not in use. Each call to the
+    // functions above takes one (or creates one if there are none), so
+    // parsers are only created as often as there are concurrent calls.
+    std::vector<Parser *> parsers_;
+  };
+
+  // Returns a parser with the schema for ident loaded, or nullptr on error.
+  // Hand it back with ReleaseParser() when done.
+  Parser *AcquireParser(const std::string &ident, size_t *generation) {
+    std::string path;
+    std::string contents;
+    IDLOptions opts;
+    std::vector<const char *> include_paths;
+    {
+      Lock lock(mutex_);
+      // Find the schema, if not, exit.
+      auto it = schemas_.find(ident);
+      if (it == schemas_.end()) {
+        // Don't attach the identifier, since it may not be human readable.
+        lasterror_ = "identifier for this buffer not in the registry";
+        return nullptr;
+      }
+      auto &schema = it->second;
+      *generation = generation_;
+      if (!schema.parsers_.empty()) {
+        auto parser = schema.parsers_.back();
+        schema.parsers_.pop_back();
+        return parser;
+      }
+      // Load the schema from disk. If not, exit.
+      if (schema.contents_.empty() &&
+          !LoadFile(schema.path_.c_str(), IsBinarySchema(schema.path_),
+                    &schema.contents_)) {
+        lasterror_ = "could not load schema: " + schema.path_;
+        return nullptr;
+      }
+      path = schema.path_;
+      contents = schema.contents_;
+      opts = opts_;
+      include_paths = include_paths_;
+    }
+    // Parse the schema, without holding the lock.
+    include_paths.push_back(nullptr);
+    auto parser = new Parser(opts);
+    auto ok =
+        IsBinarySchema(path)
+            ? parser->Deserialize(
+                  reinterpret_cast<const uint8_t *>(contents.c_str()),
+                  contents.size())
+            : parser->Parse(contents.c_str(), vector_data(include_paths),
+                            path.c_str());
+    if (!ok) {
+      SetLastError(parser->error_.empty() ? "could not load schema: " + path
+                                          : parser->error_);
+      delete parser;
+      return nullptr;
+    }
+    return parser;
+  }
+
+  void ReleaseParser(const std::string &ident, Parser *parser,
+                     size_t generation) {
+    Lock lock(mutex_);
     auto it = schemas_.find(ident);
-    if (it == schemas_.end()) {
-      // Don't attach the identifier, since it may not be human readable.
-      lasterror_ = "identifier for this buffer not in the registry";
-      return false;
+    // Drop parsers created before the schema or options were changed.
+    if (generation != generation_ || it == schemas_.end()) {
+      delete parser;
+      return;
     }
-    auto &schema = it->second;
-    // Load the schema from disk. If not, exit.
-    std::string schematext;
-    if (!LoadFile(schema.path_.c_str(), false, &schematext)) {
-      lasterror_ = "could not load schema: " + schema.path_;
-      return false;
+    it->second.parsers_.push_back(parser);
+  }
+
+  static bool IsBinarySchema(const std::string &path) {
+    return GetExtension(path) == reflection::SchemaExtension();
+  }
+
+  void ClearParsers(Schema &schema) {
+    for (auto it = schema.parsers_.begin(); it != schema.parsers_.end(); ++it) {
+      delete *it;
     }
-    // Parse schema.
-    parser->opts = opts_;
-    if (!parser->Parse(schematext.c_str(), vector_data(include_paths_),
-                       schema.path_.c_str())) {
-      lasterror_ = parser->error_;
-      return false;
+    schema.parsers_.clear();
+  }
+
+  void ClearAllParsers() {
+    for (auto it = schemas_.begin(); it != schemas_.end(); ++it) {
+      ClearParsers(it->second);
     }
-    return true;
+    generation_++;
   }
 
-  struct Schema {
-    std::string path_;
-    // TODO(wvo) optionally cache schema file or parsed schema here.
-  };
+  void SetLastError(const std::string &error) {
+    Lock lock(mutex_);
+    lasterror_ = error;
+  }
 
+  // You shouldn't really be copying instances of this class.
+  Registry(const Registry &);
+  Registry &operator=(const Registry &);
+
+  // Guards all members below. Parsers are used without holding it, since
+  // each is only used by one call at a time.
+#ifndef FLATBUFFERS_CPP98_STL
+  typedef std::lock_guard<std::mutex> Lock;
+  std::mutex mutex_;
+#else
+  // No threads to guard against.
+  struct Mutex {};
+  struct Lock {
+    explicit Lock(Mutex &) {}
+  };
+  Mutex mutex_;
+#endif
   std::string lasterror_;
   IDLOptions opts_;
   std::vector<const char *> include_paths_;
   std::map<std::string, Schema> schemas_;
+  // Incremented whenever cached parsers become outdated.
+  size_t generation_;
 };
 
 }  // namespace flatbuffers
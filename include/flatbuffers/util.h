@@ -123,6 +123,47 @@ template<typename T> std::string NumToString(T t) {
   #endif // FLATBUFFERS_PREFER_PRINTF
   // clang-format on
 }
+
+// Integers are converted by hand, which is much faster than using a
+// stringstream or printf.
+template<typename T> std::string IntToString(T t) {
+  char buf[24];  // Enough for any 64-bit integer with a sign.
+  auto p = buf + sizeof(buf);
+  auto negative = t < 0;
+  auto u = negative ? 0 - static_cast<uint64_t>(t) : static_cast<uint64_t>(t);
+  do {
+    *--p = static_cast<char>('0' + u % 10);
+    u /= 10;
+  } while (u);
+  if (negative) *--p = '-';
+  return std::string(p, buf + sizeof(buf));
+}
+template<> inline std::string NumToString<short>(short t) {
+  return IntToString(t);
+}
+template<> inline std::string NumToString<unsigned short>(unsigned short t) {
+  return IntToString(t);
+}
+template<> inline std::string NumToString<int>(int t) {
+  return IntToString(t);
+}
+template<> inline std::string NumToString<unsigned int>(unsigned int t) {
+  return IntToString(t);
+}
+template<> inline std::string NumToString<long>(long t) {
+  return IntToString(t);
+}
+template<> inline std::string NumToString<unsigned long>(unsigned long t) {
+  return IntToString(t);
+}
+template<> inline std::string NumToString<long long>(long long t) {
+  return IntToString(t);
+}
+template<>
+inline std::string NumToString<unsigned long long>(unsigned long long t) {
+  return IntToString(t);
+}
+
 // Avoid char types used as character data.
 template<> inline std::string NumToString<signed char>(signed char t) {
   return NumToString(static_cast<int>(t));
@@ -133,20 +174,6 @@ template<> inline std::string NumToString<unsigned char>(unsigned char t) {
 template<> inline std::string NumToString<char>(char t) {
   return NumToString(static_cast<int>(t));
 }
-#if defined(FLATBUFFERS_CPP98_STL)
-template<> inline std::string NumToString<long long>(long long t) {
-  char buf[21];  // (log((1 << 63) - 1) / log(10)) + 2
-  snprintf(buf, sizeof(buf), "%lld", t);
-  return std::string(buf);
-}
-
-template<>
-inline std::string NumToString<unsigned long long>(unsigned long long t) {
-  char buf[22];  // (log((1 << 63) - 1) / log(10)) + 1
-  snprintf(buf, sizeof(buf), "%llu", t);
-  return std::string(buf);
-}
-#endif  // defined(FLATBUFFERS_CPP98_STL)
 
 // Special versions for floats/doubles.
 template<typename T> std::string FloatToString(T t, int precision) {
@@ -183,6 +210,13 @@ template<> inline std::string NumToString<float>(float t) {
   return FloatToString(t, 6);
 }
 
+// Like FloatToString, but with the fewest digits that convert back to the
+// same value (instead of a fixed precision), and much faster. Numbers with
+// more than 21 digits before or 5 zeroes after the point use an exponent,
+// e.g. "1e-7".
+std::string FloatToShortestString(double d);
+std::string FloatToShortestString(float f);
+
 // Convert an integer value to a hexadecimal string.
 // The returned string length is always xdigits long, prefixed by 0 digits.
 // For example, IntToStringHex(0x23, 8) returns the string "00000023".
@@ -266,6 +300,78 @@ inline void strtoval_impl(float *val, const char *str, char **endptr) {
 #undef __strtof_impl
 // clang-format on
 
+// Converts a plain decimal integer of up to 18 digits (so it can't overflow),
+// optionally with a sign, which is what most numbers in JSON look like.
+// Returns false for anything else, which is left to strtoll/strtoull.
+template<typename T>
+inline bool StringToIntegerFastPath(T *val, const char *str) {
+  auto s = str;
+  auto negative = *s == '-';
+  if (negative || *s == '+') s++;
+  if (negative && flatbuffers::is_unsigned<T>::value) return false;
+  auto digits = s;
+  uint64_t u = 0;
+  while (is_digit(*s) && s - digits < 18) u = u * 10 + (*s++ - '0');
+  if (*s || s == digits) return false;
+  *val = negative ? static_cast<T>(0 - u) : static_cast<T>(u);
+  return true;
+}
+
+// Converts a plain decimal number, with at most 19 significant digits that
+// fit in the mantissa of T, and a power of ten that is exact in T. The result
+// is then one multiplication or division of two exact values of T, so
+// correctly rounded (Clinger's fast path). This has to be done in T itself:
+// for float, rounding to double first and then to float can be off by one.
+// This covers most numbers in JSON; for anything else (or more digits) this
+// returns false, and strtod/strtof is used.
+template<typename T>
+inline bool StringToFloatFastPath(T *val, const char *str) {
+  static const T kPow10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                              1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                              1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                              1e18, 1e19, 1e20, 1e21, 1e22 };
+  // 10^n is exact as long as 5^n fits in the mantissa.
+  const int max_exp10 = sizeof(T) == sizeof(float) ? 10 : 22;
+  const uint64_t max_m = 1ULL << std::numeric_limits<T>::digits;
+  auto s = str;
+  auto negative = *s == '-';
+  if (negative || *s == '+') s++;
+  uint64_t m = 0;
+  int num_digits = 0;  // Significant digits in m.
+  int exp10 = 0;
+  auto has_digits = false;
+  for (auto seen_point = false;; s++) {
+    if (is_digit(*s)) {
+      has_digits = true;
+      if (m || *s != '0') {
+        if (++num_digits > 19) return false;
+        m = m * 10 + static_cast<uint64_t>(*s - '0');
+      }
+      if (seen_point) exp10--;
+    } else if (*s == '.' && !seen_point) {
+      seen_point = true;
+    } else {
+      break;
+    }
+  }
+  if (!has_digits) return false;
+  if (*s == 'e' || *s == 'E') {
+    s++;
+    auto exp_negative = *s == '-';
+    if (exp_negative || *s == '+') s++;
+    if (!is_digit(*s)) return false;
+    int e = 0;
+    while (is_digit(*s) && e < 1000) e = e * 10 + (*s++ - '0');
+    exp10 += exp_negative ? -e : e;
+  }
+  if (*s || m > max_m || exp10 < -max_exp10 || exp10 > max_exp10)
+    return false;
+  auto f = static_cast<T>(m);
+  f = exp10 < 0 ? f / kPow10[-exp10] : f * kPow10[exp10];
+  *val = negative ? -f : f;
+  return true;
+}
+
 // Adaptor for strtoull()/strtoll().
 // Flatbuffers accepts numbers with any count of leading zeros (-009 is -9),
 // while strtoll with base=0 interprets first leading zero as octal prefix.
@@ -284,6 +390,8 @@ inline bool StringToIntegerImpl(T *val, const char *const str,
                                 const bool check_errno = true) {
   // T is int64_t or uint64_T
   FLATBUFFERS_ASSERT(str);
+  if ((base <= 0 || base == 10) && StringToIntegerFastPath(val, str))
+    return true;
   if (base <= 0) {
     auto s = str;
     while (*s && !is_digit(*s)) s++;
@@ -309,6 +417,7 @@ template<typename T>
 inline bool StringToFloatImpl(T *val, const char *const str) {
   // Type T must be either float or double.
   FLATBUFFERS_ASSERT(str && val);
+  if (StringToFloatFastPath(val, str)) return true;
   auto end = str;
   strtoval_impl(val, str, const_cast<char **>(&end));
   auto done = (end != str) && (*end == '\0');
@@ -393,12 +502,21 @@ inline uint64_t StringToUInt(const char *s, int base = 10) {
 typedef bool (*LoadFileFunction)(const char *filename, bool binary,
                                  std::string *dest);
 typedef bool (*FileExistsFunction)(const char *filename);
+typedef bool (*SaveFileFunction)(const char *filename, const char *buf,
+                                 size_t len, bool binary);
 
 LoadFileFunction SetLoadFileFunction(LoadFileFunction load_file_function);
 
 FileExistsFunction SetFileExistsFunction(
     FileExistsFunction file_exists_function);
 
+SaveFileFunction SetSaveFileFunction(SaveFileFunction save_file_function);
+
+// Whether SaveFile() goes through a function set with SetSaveFileFunction(),
+// rather than writing files itself. Code that writes files directly, e.g. to
+// stream them, must then use SaveFile() instead.
+bool HasCustomSaveFileFunction();
+
 // Check if file "name" exists.
 bool FileExists(const char *name);
 
@@ -411,6 +529,50 @@ bool DirExists(const char *name);
 // no transcoding.
 bool LoadFile(const char *name, bool binary, std::string *buf);
 
+// A read-only view of the contents of a file, set by MapFile().
+class MappedFile {
+ public:
+  MappedFile() : data_(nullptr), size_(0), mapped_(false) {}
+  ~MappedFile() { Reset(); }
+
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+  // Makes this view own `contents` instead, which is left empty. For files
+  // that aren't mapped, such as from a custom MapFileFunction.
+  void Assign(std::string *contents) {
+    Reset();
+    contents_.swap(*contents);
+    data_ = reinterpret_cast<const uint8_t *>(contents_.data());
+    size_ = contents_.size();
+  }
+
+  // Unmaps the file, if any.
+  void Reset();
+
+ private:
+  MappedFile(const MappedFile &);
+  MappedFile &operator=(const MappedFile &);
+
+  friend bool MapFileRaw(const char *name, MappedFile *file);
+
+  const uint8_t *data_;
+  size_t size_;
+  bool mapped_;
+  std::string contents_;  // If not mapped.
+};
+
+typedef bool (*MapFileFunction)(const char *filename, MappedFile *file);
+
+MapFileFunction SetMapFileFunction(MapFileFunction map_file_function);
+
+// Map file "name" into memory read-only, such that "file" gives access to
+// its contents without reading them all up front, or copying them. Falls
+// back to loading the file if it can't be mapped (e.g. if it is empty).
+// Returns false if the file can't be read. Unlike LoadFile(), this doesn't
+// go through the LoadFileFunction, but through a MapFileFunction of its own.
+bool MapFile(const char *name, MappedFile *file);
+
 // Save data "buf" of length "len" bytes into a file
 // "name" returning true if successful, false otherwise.
 // If "binary" is false data is written using ifstream's
@@ -131,6 +131,7 @@ struct EquipmentUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, Equipment type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackFrom(const void *obj, Equipment _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   WeaponT *AsWeapon() {
@@ -421,6 +422,30 @@ inline flatbuffers::Offset<Monster> CreateMonster(
     Equipment equipped_type = Equipment_NONE,
     flatbuffers::Offset<void> equipped = 0,
     flatbuffers::Offset<flatbuffers::Vector<const Vec3 *>> path = 0) {
+  if (pos &&
+      !flatbuffers::IsTheSameAs<int16_t>(mana, 150) &&
+      !flatbuffers::IsTheSameAs<int16_t>(hp, 100) &&
+      name.o &&
+      inventory.o &&
+      !flatbuffers::IsTheSameAs<int8_t>(static_cast<int8_t>(color), 2) &&
+      weapons.o &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(equipped_type), 0) &&
+      equipped.o &&
+      path.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 26, 42, 4, 36, 38, 16, 0, 20, 40, 24, 41, 28, 32 };
+    auto table_ = _fbb.StartFixedTable(42, 4);
+    memcpy(table_ + 4, pos, sizeof(*pos));
+    flatbuffers::WriteScalar<int16_t>(table_ + 36, mana);
+    flatbuffers::WriteScalar<int16_t>(table_ + 38, hp);
+    _fbb.AddFixedOffset(table_, 16, name);
+    _fbb.AddFixedOffset(table_, 20, inventory);
+    flatbuffers::WriteScalar<int8_t>(table_ + 40, static_cast<int8_t>(color));
+    _fbb.AddFixedOffset(table_, 24, weapons);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 41, static_cast<uint8_t>(equipped_type));
+    _fbb.AddFixedOffset(table_, 28, equipped);
+    _fbb.AddFixedOffset(table_, 32, path);
+    return flatbuffers::Offset<Monster>(_fbb.EndFixedTable(vtable_));
+  }
   MonsterBuilder builder_(_fbb);
   builder_.add_path(path);
   builder_.add_equipped(equipped);
@@ -545,6 +570,14 @@ inline flatbuffers::Offset<Weapon> CreateWeapon(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<flatbuffers::String> name = 0,
     int16_t damage = 0) {
+  if (name.o &&
+      !flatbuffers::IsTheSameAs<int16_t>(damage, 0)) {
+    static const flatbuffers::voffset_t vtable_[] = { 8, 10, 4, 8 };
+    auto table_ = _fbb.StartFixedTable(10, 4);
+    _fbb.AddFixedOffset(table_, 4, name);
+    flatbuffers::WriteScalar<int16_t>(table_ + 8, damage);
+    return flatbuffers::Offset<Weapon>(_fbb.EndFixedTable(vtable_));
+  }
   WeaponBuilder builder_(_fbb);
   builder_.add_name(name);
   builder_.add_damage(damage);
@@ -573,16 +606,15 @@ inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolv
 inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = pos(); if (_e) _o->pos = flatbuffers::unique_ptr<Vec3>(new Vec3(*_e)); };
+  { auto _e = pos(); if (_e) { if (_o->pos) *_o->pos = *_e; else _o->pos = flatbuffers::unique_ptr<Vec3>(new Vec3(*_e)); } else _o->pos.reset(); };
   { auto _e = mana(); _o->mana = _e; };
   { auto _e = hp(); _o->hp = _e; };
-  { auto _e = name(); if (_e) _o->name = _e->str(); };
-  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->inventory[_i] = _e->Get(_i); } } };
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else _o->name.clear(); };
+  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->inventory[_i] = _e->Get(_i); } } else _o->inventory.clear(); };
   { auto _e = color(); _o->color = _e; };
-  { auto _e = weapons(); if (_e) { _o->weapons.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->weapons[_i] = flatbuffers::unique_ptr<WeaponT>(_e->Get(_i)->UnPack(_resolver)); } } };
-  { auto _e = equipped_type(); _o->equipped.type = _e; };
-  { auto _e = equipped(); if (_e) _o->equipped.value = EquipmentUnion::UnPack(_e, equipped_type(), _resolver); };
-  { auto _e = path(); if (_e) { _o->path.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->path[_i] = *_e->Get(_i); } } };
+  { auto _e = weapons(); if (_e) { _o->weapons.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->weapons[_i]) _e->Get(_i)->UnPackTo(_o->weapons[_i].get(), _resolver); else _o->weapons[_i] = flatbuffers::unique_ptr<WeaponT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->weapons.clear(); };
+  { auto _e = equipped(); _o->equipped.UnPackFrom(_e, equipped_type(), _resolver); };
+  { auto _e = path(); if (_e) { _o->path.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->path[_i] = *_e->Get(_i); } } else _o->path.clear(); };
 }
 
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -626,7 +658,7 @@ inline WeaponT *Weapon::UnPack(const flatbuffers::resolver_function_t *_resolver
 inline void Weapon::UnPackTo(WeaponT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = name(); if (_e) _o->name = _e->str(); };
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else _o->name.clear(); };
   { auto _e = damage(); _o->damage = _e; };
 }
 
@@ -681,6 +713,23 @@ inline void *EquipmentUnion::UnPack(const void *obj, Equipment type, const flatb
   }
 }
 
+inline void EquipmentUnion::UnPackFrom(const void *obj, Equipment _type, const flatbuffers::resolver_function_t *resolver) {
+  if (obj && value && _type == type) {
+    switch (type) {
+      case Equipment_Weapon: {
+        auto ptr = reinterpret_cast<const Weapon *>(obj);
+        auto _o = reinterpret_cast<WeaponT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  if (obj) value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> EquipmentUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Equipment_Weapon: {
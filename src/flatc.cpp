@@ -16,46 +16,382 @@
 
 #include "flatbuffers/flatc.h"
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "flatbuffers/hash.h"
+
+// clang-format off
+#ifdef _WIN32
+#  include <fcntl.h>
+#  include <io.h>
+#endif
+// clang-format on
 
 #define FLATC_VERSION "1.11.0"
 
 namespace flatbuffers {
 
-void FlatCompiler::ParseFile(
+// Settings from the command line that apply to every input file.
+struct FlatCompiler::Settings {
+  IDLOptions opts;
+  std::string output_path;
+  std::vector<const char *> include_directories;
+  std::vector<bool> generator_enabled;
+  bool print_make_rules;
+  bool raw_binary;
+  bool schema_binary;
+  bool grpc_enabled;
+  bool ndjson;
+  size_t binary_files_from;
+  const Parser *conform_parser;  // nullptr without --conform.
+  // All options that affect the output, to tell if a unit is up to date.
+  std::string options_key;
+  const Manifest *manifest;  // nullptr without --incremental.
+};
+
+// Each schema is compiled with its own parser, which parses all the files it
+// includes again. While compiling, this keeps the contents of included files
+// in memory, so that a file included by many schemas is read only once, and
+// the parsers on different threads share a single copy.
+class FlatCompiler::IncludeCache {
+ public:
+  // Installs the cache as the file loading functions of util.h.
+  class Scope {
+   public:
+    Scope()
+        : load_file_(SetLoadFileFunction(LoadFile)),
+          file_exists_(SetFileExistsFunction(FileExists)) {
+      Get().load_file_ = load_file_;
+      Get().file_exists_ = file_exists_;
+    }
+    ~Scope() {
+      SetLoadFileFunction(load_file_);
+      SetFileExistsFunction(file_exists_);
+      std::lock_guard<std::mutex> lock(Get().mutex_);
+      Get().files_.clear();
+    }
+
+   private:
+    LoadFileFunction load_file_;
+    FileExistsFunction file_exists_;
+  };
+
+  // Loads an input file given on the command line, bypassing the cache:
+  // those are read once anyway.
+  static bool LoadInputFile(const char *name, bool binary,
+                            std::string *dest) {
+    auto load_file = Get().load_file_;
+    return load_file ? load_file(name, binary, dest)
+                     : flatbuffers::LoadFile(name, binary, dest);
+  }
+
+ private:
+  struct File {
+    bool exists;
+    bool loaded;
+    std::string contents;
+  };
+
+  IncludeCache() : load_file_(nullptr), file_exists_(nullptr) {}
+
+  static IncludeCache &Get() {
+    static IncludeCache cache;
+    return cache;
+  }
+
+  static bool LoadFile(const char *name, bool binary, std::string *dest) {
+    auto &cache = Get();
+    {
+      std::lock_guard<std::mutex> lock(cache.mutex_);
+      auto it = cache.files_.find(name);
+      if (it != cache.files_.end() && it->second.loaded) {
+        *dest = it->second.contents;
+        return it->second.exists;
+      }
+    }
+    // Two threads may both load a file that isn't cached yet, but they'll
+    // store the same contents.
+    File file;
+    file.exists = cache.load_file_(name, binary, &file.contents);
+    file.loaded = true;
+    *dest = file.contents;
+    std::lock_guard<std::mutex> lock(cache.mutex_);
+    cache.files_[name] = file;
+    return file.exists;
+  }
+
+  static bool FileExists(const char *name) {
+    auto &cache = Get();
+    {
+      std::lock_guard<std::mutex> lock(cache.mutex_);
+      auto it = cache.files_.find(name);
+      if (it != cache.files_.end()) return it->second.exists;
+    }
+    File file;
+    file.exists = cache.file_exists_(name);
+    file.loaded = false;
+    std::lock_guard<std::mutex> lock(cache.mutex_);
+    cache.files_.insert(std::make_pair(std::string(name), file));
+    return file.exists;
+  }
+
+  std::mutex mutex_;
+  std::map<std::string, File> files_;
+  LoadFileFunction load_file_;
+  FileExistsFunction file_exists_;
+};
+
+// With --incremental, the manifest records for each unit of inputs the
+// hashes of the files it was compiled from, including all the files they
+// include, and of the files it generated. A unit is skipped if none of these
+// changed since.
+struct FlatCompiler::ManifestEntry {
+  ManifestEntry() : key(0) {}
+  uint64_t key;  // 0 if the unit wasn't compiled.
+  std::map<std::string, uint64_t> inputs;
+  std::map<std::string, uint64_t> outputs;
+};
+
+class FlatCompiler::Manifest {
+ public:
+  typedef ManifestEntry Entry;
+
+  // While in scope, generated files are only written if their contents
+  // changed, and recorded in the entry of the current thread, if any.
+  class Scope {
+   public:
+    Scope() : save_file_(SetSaveFileFunction(SaveFile)) {
+      PreviousSaveFile() = save_file_;
+    }
+    ~Scope() { SetSaveFileFunction(save_file_); }
+
+   private:
+    SaveFileFunction save_file_;
+  };
+
+  // Makes `entry` the one of the current thread for the lifetime of the
+  // recorder.
+  class Recorder {
+   public:
+    explicit Recorder(Entry *entry) { Recording() = entry; }
+    ~Recorder() { Recording() = nullptr; }
+  };
+
+  // Records a file written without SaveFile() as an output of the current
+  // thread's entry, if any.
+  static void RecordOutput(const std::string &name) {
+    MappedFile file;
+    if (Recording() && MapFile(name.c_str(), &file)) {
+      Recording()->outputs[name] = Hash(file.data(), file.size());
+    }
+  }
+
+  static uint64_t Hash(const uint8_t *data, size_t size) {
+    auto hash = FnvTraits<uint64_t>::kOffsetBasis;
+    for (size_t i = 0; i < size; i++) {
+      hash ^= data[i];
+      hash *= FnvTraits<uint64_t>::kFnvPrime;
+    }
+    return hash;
+  }
+  static uint64_t Hash(const std::string &data) {
+    return Hash(reinterpret_cast<const uint8_t *>(data.c_str()), data.size());
+  }
+
+  // A missing or unreadable manifest is the same as an empty one.
+  void Load(const std::string &filename) {
+    std::string contents;
+    if (!IncludeCache::LoadInputFile(filename.c_str(), false, &contents))
+      return;
+    std::stringstream ss(contents);
+    std::string line;
+    if (!std::getline(ss, line) || line != kHeader) return;
+    Entry *entry = nullptr;
+    while (std::getline(ss, line)) {
+      auto sep = line.find(' ');
+      auto sep2 = line.find(' ', sep + 1);
+      if (sep == std::string::npos) break;
+      auto kind = line.substr(0, sep);
+      auto hash = StringToUInt(line.substr(sep + 1, sep2 - sep - 1).c_str(),
+                               16);
+      auto path = sep2 == std::string::npos ? "" : line.substr(sep2 + 1);
+      if (kind == "unit") {
+        entry = &entries_[hash];
+        entry->key = hash;
+      } else if (entry && kind == "in" && !path.empty()) {
+        entry->inputs[path] = hash;
+      } else if (entry && kind == "out" && !path.empty()) {
+        entry->outputs[path] = hash;
+      } else {
+        break;
+      }
+    }
+  }
+
+  bool Save(const std::string &filename) const {
+    if (!changed_) return true;
+    std::stringstream ss;
+    ss << kHeader << "\n" << std::hex << std::setfill('0');
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      ss << "unit " << std::setw(16) << it->first << "\n";
+      WriteFiles(ss, "in ", it->second.inputs);
+      WriteFiles(ss, "out ", it->second.outputs);
+    }
+    return SaveFileRaw(filename.c_str(), ss.str(), false);
+  }
+
+  bool UpToDate(uint64_t key) const {
+    auto it = entries_.find(key);
+    return it != entries_.end() && Unchanged(it->second.inputs) &&
+           Unchanged(it->second.outputs);
+  }
+
+  void Update(const Entry &entry) {
+    entries_[entry.key] = entry;
+    changed_ = true;
+  }
+
+  Manifest() : changed_(false) {}
+
+ private:
+  static const char *const kHeader;
+
+  static SaveFileFunction &PreviousSaveFile() {
+    static SaveFileFunction save_file = nullptr;
+    return save_file;
+  }
+
+  static Entry *&Recording() {
+    static FLATBUFFERS_THREAD_LOCAL Entry *entry = nullptr;
+    return entry;
+  }
+
+  static bool SaveFileRaw(const char *name, const std::string &contents,
+                          bool binary) {
+    return PreviousSaveFile()(name, contents.c_str(), contents.size(),
+                              binary);
+  }
+
+  static bool SaveFile(const char *name, const char *buf, size_t len,
+                       bool binary) {
+    if (Recording()) {
+      Recording()->outputs[name] =
+          Hash(reinterpret_cast<const uint8_t *>(buf), len);
+    }
+    {
+      // Unmapped before writing, since a mapped file can't be replaced on
+      // Windows, and may change under the mapping elsewhere.
+      MappedFile existing;
+      if (MapFile(name, &existing) && existing.size() == len &&
+          !memcmp(existing.data(), buf, len)) {
+        return true;
+      }
+    }
+    return PreviousSaveFile()(name, buf, len, binary);
+  }
+
+  static void WriteFiles(std::stringstream &ss, const char *kind,
+                         const std::map<std::string, uint64_t> &files) {
+    for (auto it = files.begin(); it != files.end(); ++it) {
+      ss << kind << std::setw(16) << it->second << " " << it->first << "\n";
+    }
+  }
+
+  static bool Unchanged(const std::map<std::string, uint64_t> &files) {
+    for (auto it = files.begin(); it != files.end(); ++it) {
+      MappedFile file;
+      if (!MapFile(it->first.c_str(), &file) ||
+          Hash(file.data(), file.size()) != it->second) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::map<uint64_t, Entry> entries_;
+  bool changed_;
+};
+
+const char *const FlatCompiler::Manifest::kHeader = "flatc manifest 1";
+
+// Splits the input files into units that can be compiled independently: each
+// schema starts a new parser, and the JSON and binary files that follow it
+// are read with that parser.
+static std::vector<std::vector<size_t>> SplitIntoUnits(
+    const std::vector<std::string> &filenames, size_t binary_files_from) {
+  std::vector<std::vector<size_t>> units;
+  for (size_t i = 0; i < filenames.size(); i++) {
+    auto ext = flatbuffers::GetExtension(filenames[i]);
+    auto is_schema = i < binary_files_from && (ext == "fbs" || ext == "proto");
+    if (is_schema || units.empty()) units.push_back(std::vector<size_t>());
+    units.back().push_back(i);
+  }
+  return units;
+}
+
+bool FlatCompiler::ParseFile(
     flatbuffers::Parser &parser, const std::string &filename,
     const std::string &contents,
     std::vector<const char *> &include_directories) const {
   auto local_include_directory = flatbuffers::StripFileName(filename);
   include_directories.push_back(local_include_directory.c_str());
   include_directories.push_back(nullptr);
-  if (!parser.Parse(contents.c_str(), &include_directories[0],
-                    filename.c_str())) {
+  auto ok = parser.Parse(contents.c_str(), &include_directories[0],
+                         filename.c_str());
+  include_directories.pop_back();
+  include_directories.pop_back();
+  if (!ok) {
     Error(parser.error_, false, false);
+    return false;
   }
   if (!parser.error_.empty()) { Warn(parser.error_, false); }
-  include_directories.pop_back();
-  include_directories.pop_back();
+  return true;
 }
 
-void FlatCompiler::LoadBinarySchema(flatbuffers::Parser &parser,
+bool FlatCompiler::LoadBinarySchema(flatbuffers::Parser &parser,
                                     const std::string &filename,
-                                    const std::string &contents) {
+                                    const std::string &contents) const {
   if (!parser.Deserialize(reinterpret_cast<const uint8_t *>(contents.c_str()),
       contents.size())) {
     Error("failed to load binary schema: " + filename, false, false);
+    return false;
   }
+  return true;
 }
 
 void FlatCompiler::Warn(const std::string &warn, bool show_exe_name) const {
+  if (messages_) {
+    messages_->push_back(Message(Message::kWarning, warn, false, show_exe_name));
+    return;
+  }
   params_.warn_fn(this, warn, show_exe_name);
 }
 
 void FlatCompiler::Error(const std::string &err, bool usage,
                          bool show_exe_name) const {
+  if (messages_) {
+    messages_->push_back(Message(Message::kError, err, usage, show_exe_name));
+    return;
+  }
   params_.error_fn(this, err, usage, show_exe_name);
 }
 
+void FlatCompiler::Print(const std::string &text) const {
+  if (messages_) {
+    messages_->push_back(Message(Message::kOutput, text, false, false));
+    return;
+  }
+  printf("%s", text.c_str());
+}
+
 std::string FlatCompiler::GetUsageString(const char *program_name) const {
   std::stringstream ss;
   ss << "Usage: " << program_name << " [OPTION]... FILE... [-- FILE...]\n";
@@ -74,6 +410,10 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "  -o PATH            Prefix PATH to all generated files.\n"
     "  -I PATH            Search for includes in the specified path.\n"
     "  -M                 Print make rules for generated files.\n"
+    "  --jobs N           Compile up to N schemas at the same time.\n"
+    "  --incremental FILE Skip schemas that didn't change since the last run,\n"
+    "                     and only write files whose contents changed. FILE\n"
+    "                     records what previous runs compiled.\n"
     "  --version          Print the version number of flatc and exit.\n"
     "  --strict-json      Strict JSON: field names must be / will be quoted,\n"
     "                     no trailing commas in tables/vectors.\n"
@@ -82,6 +422,9 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "                     non-UTF-8 input.)\n"
     "  --natural-utf8     Output strings with UTF-8 as human-readable strings.\n"
     "                     By default, UTF-8 characters are printed as \\uXXXX escapes.\n"
+    "  --fixed-precision-floats Output floats in JSON rounded to 6 digits after\n"
+    "                     the point (12 for doubles), as older versions did.\n"
+    "                     By default the shortest exact representation is used.\n"
     "  --defaults-json    Output fields whose value is the default when\n"
     "                     writing JSON\n"
     "  --unknown-json     Allow fields in JSON that are not defined in the\n"
@@ -96,10 +439,14 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "  --no-includes      Don\'t generate include statements for included\n"
     "                     schemas the generated file depends on (C++).\n"
     "  --gen-mutable      Generate accessors that can mutate buffers in-place.\n"
+    "  --gen-checked-accessors Generate C++ accessors that take a Verifier and\n"
+    "                     check only the data they read, instead of requiring\n"
+    "                     the whole buffer to be verified upfront.\n"
     "  --gen-onefile      Generate single output file for C# and Go.\n"
     "  --gen-name-strings Generate type name functions for C++.\n"
     "  --gen-object-api   Generate an additional object-based API.\n"
     "  --gen-compare      Generate operator== for object-based API types.\n"
+    "  --gen-json         Generate JSON serializers and parsers for C++.\n"
     "  --gen-nullable     Add Clang _Nullable for C++ pointer. or @Nullable for Java\n"
     "  --gen-generated    Add @Generated annotation for Java\n"
     "  --gen-all          Generate not just code for the current schema files,\n"
@@ -114,6 +461,8 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "                     (see the --cpp-str-flex-ctor option to change this behavior).\n"
     "  --cpp-str-flex-ctor Don't construct custom string types by passing std::string\n"
     "                     from Flatbuffers, but (char* + length).\n"
+    "  --cpp-arena        Allocate object API types from the current\n"
+    "                     flatbuffers::Arena, if any (C++ only).\n"
     "  --object-prefix    Customise class prefix for C++ object-based API.\n"
     "  --object-suffix    Customise class suffix for C++ object-based API.\n"
     "                     Default value is \"T\".\n"
@@ -126,6 +475,9 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "  --raw-binary       Allow binaries without file_indentifier to be read.\n"
     "                     This may crash flatc given a mismatched schema.\n"
     "  --size-prefixed    Input binaries are size prefixed buffers.\n"
+    "  --ndjson           JSON files hold one object per line. With -b, each\n"
+    "                     becomes a stream of size prefixed buffers. A file\n"
+    "                     named - is read from stdin and written to stdout.\n"
     "  --proto            Input is a .proto, translate to .fbs.\n"
     "  --oneof-union      Translate .proto oneofs to flatbuffer unions.\n"
     "  --grpc             Generate GRPC interfaces for the specified languages.\n"
@@ -170,17 +522,22 @@ int FlatCompiler::Compile(int argc, const char **argv) {
   bool raw_binary = false;
   bool schema_binary = false;
   bool grpc_enabled = false;
+  bool ndjson = false;
   std::vector<std::string> filenames;
   std::list<std::string> include_directories_storage;
   std::vector<const char *> include_directories;
   std::vector<const char *> conform_include_directories;
   std::vector<bool> generator_enabled(params_.num_generators, false);
   size_t binary_files_from = std::numeric_limits<size_t>::max();
+  size_t num_jobs = 1;
+  std::string manifest_filename;
+  // Arguments that are part of Settings::options_key.
+  std::vector<bool> key_args(static_cast<size_t>(argc), true);
   std::string conform_to_schema;
 
   for (int argi = 0; argi < argc; argi++) {
     std::string arg = argv[argi];
-    if (arg[0] == '-') {
+    if (arg[0] == '-' && arg != "-") {  // "-" is stdin.
       if (filenames.size() && arg[1] != '-')
         Error("invalid option location: " + arg, true);
       if (arg == "-o") {
@@ -214,6 +571,8 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         opts.allow_non_utf8 = true;
       } else if (arg == "--natural-utf8") {
         opts.natural_utf8 = true;
+      } else if (arg == "--fixed-precision-floats") {
+        opts.fixed_precision_floats = true;
       } else if (arg == "--no-js-exports") {
         opts.skip_js_exports = true;
       } else if (arg == "--goog-js-export") {
@@ -241,12 +600,16 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         opts.union_value_namespacing = false;
       } else if (arg == "--gen-mutable") {
         opts.mutable_buffer = true;
+      } else if (arg == "--gen-checked-accessors") {
+        opts.checked_accessors = true;
       } else if (arg == "--gen-name-strings") {
         opts.generate_name_strings = true;
       } else if (arg == "--gen-object-api") {
         opts.generate_object_based_api = true;
       } else if (arg == "--gen-compare") {
         opts.gen_compare = true;
+      } else if (arg == "--gen-json") {
+        opts.gen_json = true;
       } else if (arg == "--cpp-ptr-type") {
         if (++argi >= argc) Error("missing type following" + arg, true);
         opts.cpp_object_api_pointer_type = argv[argi];
@@ -255,6 +618,8 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         opts.cpp_object_api_string_type = argv[argi];
       } else if (arg == "--cpp-str-flex-ctor") {
         opts.cpp_object_api_string_flexible_constructor = true;
+      } else if (arg == "--cpp-arena") {
+        opts.cpp_object_api_arena = true;
       } else if (arg == "--gen-nullable") {
         opts.gen_nullable = true;
       } else if (arg == "--gen-generated") {
@@ -279,6 +644,8 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         raw_binary = true;
       } else if (arg == "--size-prefixed") {
         opts.size_prefixed = true;
+      } else if (arg == "--ndjson") {
+        ndjson = true;
       } else if (arg == "--") {  // Separator between text and binary inputs.
         binary_files_from = filenames.size();
       } else if (arg == "--proto") {
@@ -289,6 +656,18 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         schema_binary = true;
       } else if (arg == "-M") {
         print_make_rules = true;
+      } else if (arg == "--jobs") {
+        key_args[argi] = false;
+        if (++argi >= argc) Error("missing number following: " + arg, true);
+        key_args[argi] = false;
+        num_jobs = static_cast<size_t>(atoi(argv[argi]));
+        if (num_jobs < 1)
+          Error("invalid number of jobs: " + std::string(argv[argi]), true);
+      } else if (arg == "--incremental") {
+        key_args[argi] = false;
+        if (++argi >= argc) Error("missing path following: " + arg, true);
+        key_args[argi] = false;
+        manifest_filename = flatbuffers::PosixPath(argv[argi]);
       } else if (arg == "--version") {
         printf("flatc version %s\n", FLATC_VERSION);
         exit(0);
@@ -331,6 +710,7 @@ int FlatCompiler::Compile(int argc, const char **argv) {
       }
     } else {
       filenames.push_back(flatbuffers::PosixPath(argv[argi]));
+      key_args[argi] = false;
     }
   }
 
@@ -343,6 +723,17 @@ int FlatCompiler::Compile(int argc, const char **argv) {
     Error("no options: specify at least one generator.", true);
   }
 
+  if (ndjson) {
+    auto binary_enabled = false;
+    for (size_t i = 0; i < params_.num_generators; ++i) {
+      if (params_.generators[i].lang == IDLOptions::kBinary)
+        binary_enabled = generator_enabled[i];
+    }
+    if (!binary_enabled) Error("--ndjson requires --binary", true);
+    output_to_stdout_ =
+        std::find(filenames.begin(), filenames.end(), "-") != filenames.end();
+  }
+
   flatbuffers::Parser conform_parser;
   if (!conform_to_schema.empty()) {
     std::string contents;
@@ -358,128 +749,406 @@ int FlatCompiler::Compile(int argc, const char **argv) {
     }
   }
 
-  std::unique_ptr<flatbuffers::Parser> parser(new flatbuffers::Parser(opts));
+  Settings settings;
+  settings.opts = opts;
+  settings.output_path = output_path;
+  settings.include_directories = include_directories;
+  settings.generator_enabled = generator_enabled;
+  settings.print_make_rules = print_make_rules;
+  settings.raw_binary = raw_binary;
+  settings.schema_binary = schema_binary;
+  settings.grpc_enabled = grpc_enabled;
+  settings.ndjson = ndjson;
+  settings.binary_files_from = binary_files_from;
+  settings.conform_parser =
+      conform_to_schema.empty() ? nullptr : &conform_parser;
+  settings.options_key = FLATC_VERSION;
+  for (int argi = 0; argi < argc; argi++) {
+    if (key_args[argi])
+      settings.options_key += std::string("\0", 1) + argv[argi];
+  }
+  settings.manifest = nullptr;
 
-  for (auto file_it = filenames.begin(); file_it != filenames.end();
-       ++file_it) {
-    auto &filename = *file_it;
-    std::string contents;
-    if (!flatbuffers::LoadFile(filename.c_str(), true, &contents))
-      Error("unable to load file: " + filename);
+  IncludeCache::Scope include_cache;
+  Manifest manifest;
+  std::unique_ptr<Manifest::Scope> manifest_scope;
+  // Make rules don't depend on whether the generated files are up to date.
+  if (!manifest_filename.empty() && !print_make_rules) {
+    manifest.Load(manifest_filename);
+    manifest_scope.reset(new Manifest::Scope());
+    settings.manifest = &manifest;
+  }
+
+  auto units = SplitIntoUnits(filenames, binary_files_from);
+  std::vector<ManifestEntry> entries(units.size());
+  if (num_jobs > 1) {
+    if (!CompileParallel(settings, filenames, units, num_jobs, &entries))
+      return 1;
+  } else {
+    std::unique_ptr<flatbuffers::Parser> parser(new flatbuffers::Parser(opts));
+    for (size_t u = 0; u < units.size(); u++) {
+      if (!CompileUnit(settings, parser, filenames, units[u], &entries[u]))
+        return 1;
+    }
+  }
+
+  // The manifest is only updated after a successful run.
+  if (settings.manifest) {
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+      if (it->key) manifest.Update(*it);
+    }
+    manifest_scope.reset();
+    if (!manifest.Save(manifest_filename))
+      Error("unable to write manifest: " + manifest_filename, false);
+  }
+  return 0;
+}
 
-    bool is_binary =
-        static_cast<size_t>(file_it - filenames.begin()) >= binary_files_from;
-    auto ext = flatbuffers::GetExtension(filename);
-    auto is_schema = ext == "fbs" || ext == "proto";
-    auto is_binary_schema = ext == reflection::SchemaExtension();
+bool FlatCompiler::CompileUnit(const Settings &settings,
+                               std::unique_ptr<flatbuffers::Parser> &parser,
+                               const std::vector<std::string> &filenames,
+                               const std::vector<size_t> &unit,
+                               ManifestEntry *entry) const {
+  std::string key = settings.options_key;
+  for (auto it = unit.begin(); it != unit.end(); ++it) {
+    key += std::string("\0", 1) + filenames[*it];
+  }
+  auto unit_key = Manifest::Hash(key);
+  if (settings.manifest && settings.manifest->UpToDate(unit_key)) return true;
+
+  Manifest::Recorder recorder(settings.manifest ? entry : nullptr);
+  for (auto it = unit.begin(); it != unit.end(); ++it) {
+    const auto &filename = filenames[*it];
+    auto is_binary = *it >= settings.binary_files_from;
+    if (!CompileFile(settings, parser, filename, is_binary)) return false;
+    if (!settings.manifest) continue;
+    std::set<std::string> inputs;
     if (is_binary) {
-      parser->builder_.Clear();
-      parser->builder_.PushFlatBuffer(
-          reinterpret_cast<const uint8_t *>(contents.c_str()),
-          contents.length());
-      if (!raw_binary) {
-        // Generally reading binaries that do not correspond to the schema
-        // will crash, and sadly there's no way around that when the binary
-        // does not contain a file identifier.
-        // We'd expect that typically any binary used as a file would have
-        // such an identifier, so by default we require them to match.
-        if (!parser->file_identifier_.length()) {
-          Error("current schema has no file_identifier: cannot test if \"" +
-                filename +
-                "\" matches the schema, use --raw-binary to read this file"
-                " anyway.");
-        } else if (!flatbuffers::BufferHasIdentifier(
-                       contents.c_str(), parser->file_identifier_.c_str(), opts.size_prefixed)) {
-          Error("binary \"" + filename +
-                "\" does not have expected file_identifier \"" +
-                parser->file_identifier_ +
-                "\", use --raw-binary to read this file anyway.");
-        }
+      inputs.insert(filename);
+    } else {
+      inputs = parser->GetIncludedFilesRecursive(filename);
+    }
+    for (auto in = inputs.begin(); in != inputs.end(); ++in) {
+      flatbuffers::MappedFile file;
+      flatbuffers::MapFile(in->c_str(), &file);
+      entry->inputs[*in] = Manifest::Hash(file.data(), file.size());
+    }
+  }
+  if (settings.manifest) entry->key = unit_key;
+  return true;
+}
+
+bool FlatCompiler::CompileFile(const Settings &settings,
+                               std::unique_ptr<flatbuffers::Parser> &parser,
+                               const std::string &filename,
+                               bool is_binary) const {
+  const auto &opts = settings.opts;
+  const auto &output_path = settings.output_path;
+  auto ext = flatbuffers::GetExtension(filename);
+  auto is_schema = ext == "fbs" || ext == "proto";
+  auto is_binary_schema = ext == reflection::SchemaExtension();
+  if (settings.ndjson && !is_binary && !is_schema && !is_binary_schema) {
+    return ConvertRecords(settings, *parser.get(), filename);
+  }
+
+  std::string filebase =
+      flatbuffers::StripPath(flatbuffers::StripExtension(filename));
+  std::string contents;
+  flatbuffers::MappedFile binary;
+  if (is_binary ? !flatbuffers::MapFile(filename.c_str(), &binary)
+                : !IncludeCache::LoadInputFile(filename.c_str(), true,
+                                               &contents)) {
+    Error("unable to load file: " + filename);
+    return false;
+  }
+  if (is_binary) {
+    // Binaries are used in place, rather than copied into builder_. Unless
+    // -b writes the buffer back to the same file: truncating it would make
+    // the mapped pages inaccessible, so then it is copied after all.
+    if (flatbuffers::AbsolutePath(flatbuffers::BinaryFileName(
+            *parser.get(), output_path, filebase)) ==
+        flatbuffers::AbsolutePath(filename)) {
+      contents.assign(reinterpret_cast<const char *>(binary.data()),
+                      binary.size());
+      binary.Assign(&contents);
+    }
+    parser->builder_.Clear();
+    parser->SetExternalBuffer(binary.data(), binary.size());
+    if (!settings.raw_binary) {
+      // Generally reading binaries that do not correspond to the schema
+      // will crash, and sadly there's no way around that when the binary
+      // does not contain a file identifier.
+      // We'd expect that typically any binary used as a file would have
+      // such an identifier, so by default we require them to match.
+      if (!parser->file_identifier_.length()) {
+        Error("current schema has no file_identifier: cannot test if \"" +
+              filename +
+              "\" matches the schema, use --raw-binary to read this file"
+              " anyway.");
+        return false;
+      } else if (binary.size() < (opts.size_prefixed ? 2 : 1) *
+                                         sizeof(uoffset_t) +
+                                     FlatBufferBuilder::kFileIdentifierLength ||
+                 !flatbuffers::BufferHasIdentifier(
+                     binary.data(), parser->file_identifier_.c_str(),
+                     opts.size_prefixed)) {
+        Error("binary \"" + filename +
+              "\" does not have expected file_identifier \"" +
+              parser->file_identifier_ +
+              "\", use --raw-binary to read this file anyway.");
+        return false;
       }
+    }
+  } else {
+    // Check if file contains 0 bytes.
+    if (!is_binary_schema && contents.length() != strlen(contents.c_str())) {
+      Error("input file appears to be binary: " + filename, true);
+      return false;
+    }
+    if (is_schema) {
+      // If we're processing multiple schemas, make sure to start each
+      // one from scratch. If it depends on previous schemas it must do
+      // so explicitly using an include.
+      parser.reset(new flatbuffers::Parser(opts));
+    }
+    if (is_binary_schema) {
+      if (!LoadBinarySchema(*parser.get(), filename, contents)) return false;
     } else {
-      // Check if file contains 0 bytes.
-      if (!is_binary_schema && contents.length() != strlen(contents.c_str())) {
-        Error("input file appears to be binary: " + filename, true);
+      auto include_directories = settings.include_directories;
+      if (!ParseFile(*parser.get(), filename, contents, include_directories))
+        return false;
+      if (!is_schema && !parser->builder_.GetSize()) {
+        // If a file doesn't end in .fbs, it must be json/binary. Ensure we
+        // didn't just parse a schema with a different extension.
+        Error("input file is neither json nor a .fbs (schema) file: " +
+                  filename,
+              true);
+        return false;
       }
-      if (is_schema) {
-        // If we're processing multiple schemas, make sure to start each
-        // one from scratch. If it depends on previous schemas it must do
-        // so explicitly using an include.
-        parser.reset(new flatbuffers::Parser(opts));
+    }
+    if ((is_schema || is_binary_schema) && settings.conform_parser) {
+      auto err = parser->ConformTo(*settings.conform_parser);
+      if (!err.empty()) {
+        Error("schemas don\'t conform: " + err);
+        return false;
       }
-      if (is_binary_schema) {
-        LoadBinarySchema(*parser.get(), filename, contents);
+    }
+    if (settings.schema_binary) {
+      parser->Serialize();
+      parser->file_extension_ = reflection::SchemaExtension();
+    }
+  }
+
+  for (size_t i = 0; i < params_.num_generators; ++i) {
+    parser->opts.lang = params_.generators[i].lang;
+    if (settings.generator_enabled[i]) {
+      if (!settings.print_make_rules) {
+        flatbuffers::EnsureDirExists(output_path);
+        if ((!params_.generators[i].schema_only ||
+             (is_schema || is_binary_schema)) &&
+            !params_.generators[i].generate(*parser.get(), output_path,
+                                            filebase)) {
+          Error(std::string("Unable to generate ") +
+                params_.generators[i].lang_name + " for " + filebase);
+          return false;
+        }
       } else {
-        ParseFile(*parser.get(), filename, contents, include_directories);
-        if (!is_schema && !parser->builder_.GetSize()) {
-          // If a file doesn't end in .fbs, it must be json/binary. Ensure we
-          // didn't just parse a schema with a different extension.
-          Error("input file is neither json nor a .fbs (schema) file: " +
-                    filename,
-                true);
+        std::string make_rule = params_.generators[i].make_rule(
+            *parser.get(), output_path, filename);
+        if (!make_rule.empty())
+          Print(flatbuffers::WordWrap(make_rule, 80, " ", " \\") + "\n");
+      }
+      if (settings.grpc_enabled) {
+        if (params_.generators[i].generateGRPC != nullptr) {
+          if (!params_.generators[i].generateGRPC(*parser.get(), output_path,
+                                                  filebase)) {
+            Error(std::string("Unable to generate GRPC interface for") +
+                  params_.generators[i].lang_name);
+            return false;
+          }
+        } else {
+          Warn(std::string("GRPC interface generator not implemented for ") +
+               params_.generators[i].lang_name);
         }
       }
-      if ((is_schema || is_binary_schema) && !conform_to_schema.empty()) {
-        auto err = parser->ConformTo(conform_parser);
-        if (!err.empty()) Error("schemas don\'t conform: " + err);
+    }
+  }
+
+  if (!opts.root_type.empty()) {
+    if (!parser->SetRootType(opts.root_type.c_str())) {
+      Error("unknown root type: " + opts.root_type);
+      return false;
+    } else if (parser->root_struct_def_->fixed) {
+      Error("root type must be a table");
+      return false;
+    }
+  }
+
+  if (opts.proto_mode) GenerateFBS(*parser.get(), output_path, filebase);
+
+  parser->SetExternalBuffer(nullptr, 0);
+
+  // We do not want to generate code for the definitions in this file
+  // in any files coming up next.
+  parser->MarkGenerated();
+  return true;
+}
+
+// Converts newline-delimited JSON from a file, or stdin for "-", into a
+// stream of size-prefixed binaries in a file, or on stdout for stdin. The
+// records are converted as they are read, so the input can be of any size.
+bool FlatCompiler::ConvertRecords(const Settings &settings,
+                                  const Parser &parser,
+                                  const std::string &filename) const {
+  auto is_stdin = filename == "-";
+  auto filebase =
+      flatbuffers::StripPath(flatbuffers::StripExtension(filename));
+  auto binary_file =
+      flatbuffers::BinaryFileName(parser, settings.output_path, filebase);
+  if (settings.print_make_rules) {
+    if (is_stdin || !parser.root_struct_def_) return true;
+    std::string make_rule = binary_file + ": " + filename;
+    auto included_files =
+        parser.GetIncludedFilesRecursive(parser.root_struct_def_->file);
+    for (auto it = included_files.begin(); it != included_files.end(); ++it) {
+      make_rule += " " + *it;
+    }
+    Print(flatbuffers::WordWrap(make_rule, 80, " ", " \\") + "\n");
+    return true;
+  }
+
+  std::ifstream ifs;
+  std::ofstream ofs;
+  if (is_stdin) {
+    // clang-format off
+    #ifdef _WIN32
+      _setmode(_fileno(stdin), _O_BINARY);
+      _setmode(_fileno(stdout), _O_BINARY);
+    #endif
+    // clang-format on
+  } else {
+    ifs.open(filename.c_str(), std::ifstream::binary);
+    if (!ifs.is_open()) {
+      Error("unable to load file: " + filename);
+      return false;
+    }
+    flatbuffers::EnsureDirExists(settings.output_path);
+    ofs.open(binary_file.c_str(), std::ofstream::binary);
+    if (!ofs.is_open()) {
+      Error("unable to write file: " + binary_file, false);
+      return false;
+    }
+  }
+  std::istream &in = is_stdin ? std::cin : ifs;
+  std::ostream &out = is_stdin ? std::cout : ofs;
+
+  flatbuffers::JsonConverter converter(parser);
+  if (!converter.ConvertStream(in, out,
+                               is_stdin ? nullptr : filename.c_str()) ||
+      !out.flush()) {
+    Error(converter.error().empty() ? "error writing output"
+                                    : converter.error(),
+          false, false);
+    return false;
+  }
+  if (!is_stdin) {
+    ofs.close();
+    Manifest::RecordOutput(binary_file);
+  }
+  return true;
+}
+
+bool FlatCompiler::CompileParallel(
+    const Settings &settings, const std::vector<std::string> &filenames,
+    const std::vector<std::vector<size_t>> &units, size_t num_jobs,
+    std::vector<ManifestEntry> *entries) const {
+  // Units that write output files of the same name are compiled one after
+  // another, in order, so the file that ends up on disk is the same as
+  // without --jobs. This groups them into chains.
+  std::vector<std::vector<size_t>> chains;
+  std::map<std::string, size_t> chain_of_filebase;
+  for (size_t u = 0; u < units.size(); u++) {
+    auto chain = chains.size();
+    for (auto it = units[u].begin(); it != units[u].end(); ++it) {
+      auto found = chain_of_filebase.find(
+          flatbuffers::StripPath(flatbuffers::StripExtension(filenames[*it])));
+      if (found == chain_of_filebase.end() || found->second == chain) continue;
+      if (chain == chains.size()) {
+        chain = found->second;
+        continue;
       }
-      if (schema_binary) {
-        parser->Serialize();
-        parser->file_extension_ = reflection::SchemaExtension();
+      // The unit links two chains: merge the later one into the earlier.
+      auto from = (std::max)(chain, found->second);
+      auto into = (std::min)(chain, found->second);
+      chains[into].insert(chains[into].end(), chains[from].begin(),
+                          chains[from].end());
+      std::sort(chains[into].begin(), chains[into].end());
+      chains[from].clear();
+      for (auto c = chain_of_filebase.begin(); c != chain_of_filebase.end();
+           ++c) {
+        if (c->second == from) c->second = into;
       }
+      chain = into;
     }
+    if (chain == chains.size()) chains.push_back(std::vector<size_t>());
+    chains[chain].push_back(u);
+    for (auto it = units[u].begin(); it != units[u].end(); ++it) {
+      chain_of_filebase[flatbuffers::StripPath(
+          flatbuffers::StripExtension(filenames[*it]))] = chain;
+    }
+  }
 
-    std::string filebase =
-        flatbuffers::StripPath(flatbuffers::StripExtension(filename));
-
-    for (size_t i = 0; i < params_.num_generators; ++i) {
-      parser->opts.lang = params_.generators[i].lang;
-      if (generator_enabled[i]) {
-        if (!print_make_rules) {
-          flatbuffers::EnsureDirExists(output_path);
-          if ((!params_.generators[i].schema_only ||
-               (is_schema || is_binary_schema)) &&
-              !params_.generators[i].generate(*parser.get(), output_path,
-                                              filebase)) {
-            Error(std::string("Unable to generate ") +
-                  params_.generators[i].lang_name + " for " + filebase);
-          }
-        } else {
-          std::string make_rule = params_.generators[i].make_rule(
-              *parser.get(), output_path, filename);
-          if (!make_rule.empty())
-            printf("%s\n",
-                   flatbuffers::WordWrap(make_rule, 80, " ", " \\").c_str());
+  // Each unit records its messages, rather than printing them (or exiting on
+  // an error) right away. They're replayed below in the order of the inputs.
+  // Like the serial loop, which stops at the first error, units following
+  // the first one that failed are not started. Those before it still are,
+  // in case one of them fails too, and its error comes first.
+  std::vector<std::vector<Message>> messages(units.size());
+  std::atomic<size_t> next_chain(0);
+  std::atomic<size_t> first_failure(units.size());
+  auto worker = [&]() {
+    for (;;) {
+      auto c = next_chain++;
+      if (c >= chains.size()) break;
+      // A chain's units are in order, and so are the chains' first units.
+      if (!chains[c].empty() && chains[c].front() > first_failure) break;
+      for (auto u = chains[c].begin(); u != chains[c].end(); ++u) {
+        if (*u > first_failure) break;
+        FlatCompiler unit_compiler(params_);
+        unit_compiler.messages_ = &messages[*u];
+        std::unique_ptr<flatbuffers::Parser> parser(
+            new flatbuffers::Parser(settings.opts));
+        if (unit_compiler.CompileUnit(settings, parser, filenames, units[*u],
+                                      &(*entries)[*u])) {
+          continue;
         }
-        if (grpc_enabled) {
-          if (params_.generators[i].generateGRPC != nullptr) {
-            if (!params_.generators[i].generateGRPC(*parser.get(), output_path,
-                                                    filebase)) {
-              Error(std::string("Unable to generate GRPC interface for") +
-                    params_.generators[i].lang_name);
-            }
-          } else {
-            Warn(std::string("GRPC interface generator not implemented for ") +
-                 params_.generators[i].lang_name);
-          }
+        auto failure = first_failure.load();
+        while (*u < failure &&
+               !first_failure.compare_exchange_weak(failure, *u)) {
         }
+        break;
       }
     }
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < (std::min)(num_jobs, chains.size()); i++) {
+    threads.push_back(std::thread(worker));
+  }
+  worker();
+  for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
 
-    if (!opts.root_type.empty()) {
-      if (!parser->SetRootType(opts.root_type.c_str()))
-        Error("unknown root type: " + opts.root_type);
-      else if (parser->root_struct_def_->fixed)
-        Error("root type must be a table");
+  for (auto unit = messages.begin(); unit != messages.end(); ++unit) {
+    for (auto m = unit->begin(); m != unit->end(); ++m) {
+      switch (m->kind) {
+        case Message::kOutput: Print(m->text); break;
+        case Message::kWarning: Warn(m->text, m->show_exe_name); break;
+        case Message::kError:
+          Error(m->text, m->usage, m->show_exe_name);
+          return false;
+      }
     }
-
-    if (opts.proto_mode) GenerateFBS(*parser.get(), output_path, filebase);
-
-    // We do not want to generate code for the definitions in this file
-    // in any files coming up next.
-    parser->MarkGenerated();
   }
-  return 0;
+  return true;
 }
 
 }  // namespace flatbuffers
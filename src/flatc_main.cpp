@@ -18,18 +18,26 @@
 
 static const char *g_program_name = nullptr;
 
+// Messages go to stdout, unless that is where the output goes.
+static FILE *MessageFile(const flatbuffers::FlatCompiler *flatc) {
+  return flatc->OutputToStdout() ? stderr : stdout;
+}
+
 static void Warn(const flatbuffers::FlatCompiler *flatc,
                  const std::string &warn, bool show_exe_name) {
-  (void)flatc;
-  if (show_exe_name) { printf("%s: ", g_program_name); }
-  printf("warning: %s\n", warn.c_str());
+  auto out = MessageFile(flatc);
+  if (show_exe_name) { fprintf(out, "%s: ", g_program_name); }
+  fprintf(out, "warning: %s\n", warn.c_str());
 }
 
 static void Error(const flatbuffers::FlatCompiler *flatc,
                   const std::string &err, bool usage, bool show_exe_name) {
-  if (show_exe_name) { printf("%s: ", g_program_name); }
-  printf("error: %s\n", err.c_str());
-  if (usage) { printf("%s", flatc->GetUsageString(g_program_name).c_str()); }
+  auto out = MessageFile(flatc);
+  if (show_exe_name) { fprintf(out, "%s: ", g_program_name); }
+  fprintf(out, "error: %s\n", err.c_str());
+  if (usage) {
+    fprintf(out, "%s", flatc->GetUsageString(g_program_name).c_str());
+  }
   exit(1);
 }
 
@@ -233,6 +233,13 @@ class CppGenerator : public BaseGenerator {
     if (parser_.uses_flexbuffers_) {
       code_ += "#include \"flatbuffers/flexbuffers.h\"";
     }
+    if (parser_.opts.generate_object_based_api &&
+        parser_.opts.cpp_object_api_arena) {
+      code_ += "#include \"flatbuffers/arena.h\"";
+    }
+    if (parser_.opts.gen_json) {
+      code_ += "#include \"flatbuffers/json.h\"";
+    }
     code_ += "";
 
     if (parser_.opts.include_dependence_headers) { GenIncludeDependencies(); }
@@ -333,6 +340,48 @@ class CppGenerator : public BaseGenerator {
       }
     }
 
+    // Generate JSON serializers and parsers.
+    if (parser_.opts.gen_json) {
+      // Enums and union types first, then declarations of all structs/tables,
+      // since they may have circular references.
+      for (auto it = parser_.enums_.vec.begin();
+           it != parser_.enums_.vec.end(); ++it) {
+        const auto &enum_def = **it;
+        if (!enum_def.generated) {
+          SetNameSpace(enum_def.defined_namespace);
+          GenEnumJson(enum_def);
+        }
+      }
+      for (auto it = parser_.structs_.vec.begin();
+           it != parser_.structs_.vec.end(); ++it) {
+        const auto &struct_def = **it;
+        if (!struct_def.generated) {
+          SetNameSpace(struct_def.defined_namespace);
+          GenJsonPre(struct_def);
+        }
+      }
+      code_ += "";
+      // Then the union values, which may be any of them.
+      for (auto it = parser_.enums_.vec.begin();
+           it != parser_.enums_.vec.end(); ++it) {
+        const auto &enum_def = **it;
+        if (enum_def.is_union && !enum_def.generated) {
+          SetNameSpace(enum_def.defined_namespace);
+          GenUnionJson(enum_def);
+        }
+      }
+      // Then the full tables/structs.
+      for (auto it = parser_.structs_.vec.begin();
+           it != parser_.structs_.vec.end(); ++it) {
+        const auto &struct_def = **it;
+        if (!struct_def.generated) {
+          SetNameSpace(struct_def.defined_namespace);
+          GenToJson(struct_def);
+          GenFromJson(struct_def);
+        }
+      }
+    }
+
     // Generate code for mini reflection.
     if (parser_.opts.mini_reflect != IDLOptions::kNone) {
       // Then the unions/enums that may refer to them.
@@ -474,6 +523,42 @@ class CppGenerator : public BaseGenerator {
         code_ += "(Get{{STRUCT_NAME}}(buf)->UnPack(res));";
         code_ += "}";
         code_ += "";
+
+        if (parser_.opts.cpp_object_api_arena) {
+          // Unpacks the entire tree into an arena.
+          code_ += "inline {{UNPACK_RETURN}} UnPack{{STRUCT_NAME}}(";
+          code_ += "    const void *buf,";
+          code_ += "    flatbuffers::Arena &arena,";
+          code_ += "    const flatbuffers::resolver_function_t *res = nullptr) {";
+          code_ += "  flatbuffers::Arena::Scope scope(&arena);";
+          code_ += "  return UnPack{{STRUCT_NAME}}(buf, res);";
+          code_ += "}";
+          code_ += "";
+        }
+      }
+
+      if (parser_.opts.gen_json) {
+        // Convenient root JSON conversion functions.
+        code_ += "inline bool {{STRUCT_NAME}}ToJson(const void *buf, "
+                 "std::string *json) {";
+        code_ += "  flatbuffers::JsonWriter writer(json);";
+        code_ += "  return ToJson(Get{{STRUCT_NAME}}(buf), writer);";
+        code_ += "}";
+        code_ += "";
+
+        code_ += "inline bool {{STRUCT_NAME}}FromJson(";
+        code_ += "    const char *json, flatbuffers::FlatBufferBuilder &fbb,";
+        code_ += "    std::string *error = nullptr) {";
+        code_ += "  flatbuffers::JsonReader reader(json);";
+        code_ += "  flatbuffers::Offset<{{CPP_NAME}}> root;";
+        code_ += "  if (FromJson(reader, fbb, &root) && reader.ExpectEnd()) {";
+        code_ += "    Finish{{STRUCT_NAME}}Buffer(fbb, root);";
+        code_ += "    return true;";
+        code_ += "  }";
+        code_ += "  if (error) *error = reader.error();";
+        code_ += "  return false;";
+        code_ += "}";
+        code_ += "";
       }
     }
 
@@ -596,7 +681,10 @@ class CppGenerator : public BaseGenerator {
   const std::string NativeString(const FieldDef *field) {
     auto attr = field ? field->attributes.Lookup("cpp_str_type") : nullptr;
     auto &ret = attr ? attr->constant : parser_.opts.cpp_object_api_string_type;
-    if (ret.empty()) { return "std::string"; }
+    if (ret.empty()) {
+      return parser_.opts.cpp_object_api_arena ? "flatbuffers::arena_string"
+                                               : "std::string";
+    }
     return ret;
   }
 
@@ -604,8 +692,9 @@ class CppGenerator : public BaseGenerator {
     auto attr = field
                     ? (field->attributes.Lookup("cpp_str_flex_ctor") != nullptr)
                     : false;
-    auto ret =
-        attr ? attr : parser_.opts.cpp_object_api_string_flexible_constructor;
+    // Arena strings can't be constructed from a std::string either.
+    auto ret = attr || parser_.opts.cpp_object_api_string_flexible_constructor ||
+               parser_.opts.cpp_object_api_arena;
     return ret && NativeString(field) !=
                       "std::string";  // Only for custom string types.
   }
@@ -646,6 +735,9 @@ class CppGenerator : public BaseGenerator {
               type.struct_def->attributes.Lookup("native_custom_alloc");
           return "std::vector<" + type_name + "," +
                  native_custom_alloc->constant + "<" + type_name + ">>";
+        } else if (parser_.opts.cpp_object_api_arena) {
+          return "std::vector<" + type_name +
+                 ", flatbuffers::ArenaAllocator<" + type_name + ">>";
         } else
           return "std::vector<" + type_name + ">";
       }
@@ -719,8 +811,10 @@ class CppGenerator : public BaseGenerator {
                                     name)
                   : name;
     } else if (ev.union_type.base_type == BASE_TYPE_STRING) {
-      return actual_type ? (native_type ? "std::string" : "flatbuffers::String")
-                         : Name(ev);
+      if (!actual_type) return Name(ev);
+      if (!native_type) return "flatbuffers::String";
+      return parser_.opts.cpp_object_api_arena ? "flatbuffers::ArenaUnionString"
+                                               : "std::string";
     } else {
       FLATBUFFERS_ASSERT(false);
       return Name(ev);
@@ -747,6 +841,14 @@ class CppGenerator : public BaseGenerator {
            " type, const flatbuffers::resolver_function_t *resolver)";
   }
 
+  std::string UnionUnPackFromSignature(const EnumDef &enum_def,
+                                       bool inclass) {
+    return std::string("void ") +
+           (inclass ? "" : Name(enum_def) + "Union::") +
+           "UnPackFrom(const void *obj, " + Name(enum_def) +
+           " _type, const flatbuffers::resolver_function_t *resolver)";
+  }
+
   std::string UnionPackSignature(const EnumDef &enum_def, bool inclass) {
     return "flatbuffers::Offset<void> " +
            (inclass ? "" : Name(enum_def) + "Union::") +
@@ -1138,6 +1240,7 @@ class CppGenerator : public BaseGenerator {
         code_ += "";
       }
       code_ += "  " + UnionUnPackSignature(enum_def, true) + ";";
+      code_ += "  " + UnionUnPackFromSignature(enum_def, true) + ";";
       code_ += "  " + UnionPackSignature(enum_def, true) + ";";
       code_ += "";
 
@@ -1301,7 +1404,9 @@ class CppGenerator : public BaseGenerator {
             code_ += "      return ptr->UnPack(resolver);";
           }
         } else if (ev.union_type.base_type == BASE_TYPE_STRING) {
-          code_ += "      return new std::string(ptr->c_str(), ptr->size());";
+          code_.SetValue("NATIVE_TYPE",
+                         GetUnionElement(ev, true, true, true));
+          code_ += "      return new {{NATIVE_TYPE}}(ptr->c_str(), ptr->size());";
         } else {
           FLATBUFFERS_ASSERT(false);
         }
@@ -1312,6 +1417,47 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      // Unpacks into the union, reusing the current value (and its
+      // allocations) if it has the same type.
+      code_ += "inline " + UnionUnPackFromSignature(enum_def, false) + " {";
+      code_ += "  if (obj && value && _type == type) {";
+      code_ += "    switch (type) {";
+      for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end();
+           ++it) {
+        const auto &ev = **it;
+        if (ev.IsZero()) { continue; }
+
+        code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+        code_.SetValue("TYPE", GetUnionElement(ev, true, true));
+        code_.SetValue("NATIVE_TYPE",
+                       NativeName(GetUnionElement(ev, true, true, true),
+                                  ev.union_type.struct_def, parser_.opts));
+        code_ += "      case {{LABEL}}: {";
+        code_ += "        auto ptr = reinterpret_cast<const {{TYPE}} *>(obj);";
+        code_ += "        auto _o = reinterpret_cast<{{NATIVE_TYPE}} *>(value);";
+        if (ev.union_type.base_type == BASE_TYPE_STRUCT) {
+          if (ev.union_type.struct_def->fixed) {
+            code_ += "        *_o = *ptr;";
+          } else {
+            code_ += "        ptr->UnPackTo(_o, resolver);";
+          }
+        } else if (ev.union_type.base_type == BASE_TYPE_STRING) {
+          code_ += "        _o->assign(ptr->c_str(), ptr->size());";
+        } else {
+          FLATBUFFERS_ASSERT(false);
+        }
+        code_ += "        return;";
+        code_ += "      }";
+      }
+      code_ += "      default: break;";
+      code_ += "    }";
+      code_ += "  }";
+      code_ += "  Reset();";
+      code_ += "  type = _type;";
+      code_ += "  if (obj) value = UnPack(obj, _type, resolver);";
+      code_ += "}";
+      code_ += "";
+
       code_ += "inline " + UnionPackSignature(enum_def, false) + " {";
       code_ += "  switch (type) {";
       for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end();
@@ -1643,6 +1789,14 @@ class CppGenerator : public BaseGenerator {
                "<{{NATIVE_NAME}}>().deallocate(static_cast<{{NATIVE_NAME}}*>("
                "ptr),1);";
       code_ += "  }";
+    } else if (parser_.opts.generate_object_based_api &&
+               parser_.opts.cpp_object_api_arena) {
+      code_ += "  void *operator new(std::size_t count) {";
+      code_ += "    return flatbuffers::Arena::New(count);";
+      code_ += "  }";
+      code_ += "  void operator delete(void *ptr) {";
+      code_ += "    flatbuffers::Arena::Delete(ptr);";
+      code_ += "  }";
     }
   }
 
@@ -1729,6 +1883,24 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
+  // The type of the value key lookups compare a key field with.
+  std::string GenKeyType(const FieldDef &field) {
+    if (field.value.type.base_type == BASE_TYPE_STRING) return "const char *";
+    FLATBUFFERS_ASSERT(IsScalar(field.value.type.base_type));
+    if (parser_.opts.scoped_enums && field.value.type.enum_def) {
+      return GenTypeGet(field.value.type, " ", "const ", " *", true);
+    }
+    return GenTypeBasic(field.value.type, false);
+  }
+
+  static const FieldDef *GetKeyField(const StructDef &struct_def) {
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      if ((*it)->key) return *it;
+    }
+    return nullptr;
+  }
+
   // Generate CompareWithValue method for a key field.
   void GenKeyFieldMethods(const FieldDef &field) {
     FLATBUFFERS_ASSERT(field.key);
@@ -1748,14 +1920,8 @@ class CppGenerator : public BaseGenerator {
       code_ += "    return strcmp({{FIELD_NAME}}()->c_str(), val);";
       code_ += "  }";
     } else {
-      FLATBUFFERS_ASSERT(IsScalar(field.value.type.base_type));
-      auto type = GenTypeBasic(field.value.type, false);
-      if (parser_.opts.scoped_enums && field.value.type.enum_def &&
-          IsScalar(field.value.type.base_type)) {
-        type = GenTypeGet(field.value.type, " ", "const ", " *", true);
-      }
       // Returns {field<val: -1, field==val: 0, field>val: +1}.
-      code_.SetValue("KEY_TYPE", type);
+      code_.SetValue("KEY_TYPE", GenKeyType(field));
       code_ += "  int KeyCompareWithValue({{KEY_TYPE}} val) const {";
       code_ +=
           "    return static_cast<int>({{FIELD_NAME}}() > val) - "
@@ -1854,6 +2020,23 @@ class CppGenerator : public BaseGenerator {
       code_ += "    return {{FIELD_VALUE}};";
       code_ += "  }";
 
+      if (parser_.opts.checked_accessors) {
+        // Same accessor, but only checking the data it reads against the
+        // verifier instead of relying on the whole buffer being verified.
+        auto checked_call = accessor.substr(0, accessor.size() - 1) +
+                            "Checked<" + offset_type + ">(verifier, " +
+                            offset_str;
+        if (is_scalar) { checked_call += ", " + GenDefaultConstant(field); }
+        checked_call += ")";
+        code_.SetValue("FIELD_VALUE",
+                       GenUnderlyingCast(field, true, checked_call));
+        code_ +=
+            "  {{FIELD_TYPE}}{{FIELD_NAME}}("
+            "const flatbuffers::Verifier &verifier) const {";
+        code_ += "    return {{FIELD_VALUE}};";
+        code_ += "  }";
+      }
+
       if (field.value.type.base_type == BASE_TYPE_UNION) {
         auto u = field.value.type.enum_def;
 
@@ -1884,6 +2067,17 @@ class CppGenerator : public BaseGenerator {
               "static_cast<{{U_FIELD_TYPE}}>({{FIELD_NAME}}()) "
               ": nullptr;";
           code_ += "  }";
+          if (parser_.opts.checked_accessors) {
+            code_ +=
+                "  {{U_FIELD_TYPE}}{{U_NULLABLE}}{{U_FIELD_NAME}}("
+                "const flatbuffers::Verifier &verifier) const {";
+            code_ +=
+                "    auto p = {{U_GET_TYPE}}(verifier) == {{U_ELEMENT_TYPE}} ? "
+                "static_cast<{{U_FIELD_TYPE}}>({{FIELD_NAME}}(verifier)) "
+                ": nullptr;";
+            code_ += "    return verifier.VerifyShallow(p) ? p : nullptr;";
+            code_ += "  }";
+          }
         }
       }
 
@@ -1939,6 +2133,25 @@ class CppGenerator : public BaseGenerator {
         code_ += "  }";
       }
 
+      auto hash_index = field.attributes.Lookup("hash_index");
+      if (hash_index) {
+        auto vec = struct_def.fields.Lookup(hash_index->constant);
+        FLATBUFFERS_ASSERT(vec);  // Guaranteed to exist by parser.
+        code_.SetValue("VEC_NAME", Name(*vec));
+        code_.SetValue("CPP_NAME", WrapInNameSpace(*vec->value.type.struct_def));
+        auto key_type = GenKeyType(*GetKeyField(*vec->value.type.struct_def));
+        if (key_type.back() != '*' && key_type.back() != ' ') key_type += " ";
+        code_.SetValue("KEY_TYPE", key_type);
+        code_ +=
+            "  const {{CPP_NAME}} *{{VEC_NAME}}_by_key({{KEY_TYPE}}key) "
+            "const {";
+        code_ += "    auto vec = {{VEC_NAME}}();";
+        code_ +=
+            "    return vec ? vec->LookupByKeyHashed({{FIELD_NAME}}(), key) : "
+            "nullptr;";
+        code_ += "  }";
+      }
+
       if (field.flexbuffer) {
         code_ +=
             "  flexbuffers::Reference {{FIELD_NAME}}_flexbuffer_root()"
@@ -2124,6 +2337,7 @@ class CppGenerator : public BaseGenerator {
     }
     code_ += ") {";
 
+    GenCreateFixedLayout(struct_def);
     code_ += "  {{STRUCT_NAME}}Builder builder_(_fbb);";
     for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
          size; size /= 2) {
@@ -2205,6 +2419,142 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
+  // Computes where each field goes in a table that has all its fields
+  // present: the vtable offset comes first, then the fields in order of
+  // decreasing alignment, using padding holes for smaller fields where
+  // possible. Returns false if the table is empty or too large.
+  bool FixedTableLayout(const StructDef &struct_def,
+                        std::vector<size_t> *offsets, size_t *size,
+                        size_t *alignment) {
+    const auto &fields = struct_def.fields.vec;
+    std::vector<size_t> sizes(fields.size(), 0);
+    std::vector<size_t> aligns(fields.size(), 0);
+    *alignment = sizeof(soffset_t);
+    for (size_t i = 0; i < fields.size(); i++) {
+      const auto &type = fields[i]->value.type;
+      if (fields[i]->deprecated) continue;
+      if (IsStruct(type)) {
+        sizes[i] = type.struct_def->bytesize;
+        aligns[i] = type.struct_def->minalign;
+      } else if (IsScalar(type.base_type)) {
+        sizes[i] = aligns[i] = SizeOf(type.base_type);
+      } else {
+        sizes[i] = aligns[i] = sizeof(uoffset_t);
+      }
+      *alignment = std::max(*alignment, aligns[i]);
+    }
+    std::vector<size_t> order;
+    for (size_t align = *alignment; align; align /= 2) {
+      for (size_t i = 0; i < fields.size(); i++) {
+        if (aligns[i] == align) order.push_back(i);
+      }
+    }
+    if (order.empty()) return false;
+    std::vector<std::pair<size_t, size_t>> holes;
+    size_t end = sizeof(soffset_t);
+    offsets->assign(fields.size(), 0);
+    for (auto it = order.begin(); it != order.end(); ++it) {
+      const auto fsize = sizes[*it];
+      const auto falign = aligns[*it];
+      size_t offset = 0;
+      for (auto h = holes.begin(); h != holes.end(); ++h) {
+        const auto start = (h->first + falign - 1) / falign * falign;
+        if (start + fsize > h->second) continue;
+        const auto hole_end = h->second;
+        h->second = start;
+        if (start + fsize < hole_end) {
+          holes.push_back(std::make_pair(start + fsize, hole_end));
+        }
+        offset = start;
+        break;
+      }
+      if (!offset) {
+        offset = (end + falign - 1) / falign * falign;
+        if (offset > end) holes.push_back(std::make_pair(end, offset));
+        end = offset + fsize;
+      }
+      (*offsets)[*it] = offset;
+    }
+    *size = end;
+    return end < 0x10000;
+  }
+
+  // Generates the fast path of CreateX(), used when all fields are present.
+  // The layout of the table and its vtable are then known at compile time,
+  // so the fields can be stored directly, and the vtable needs no
+  // comparing against earlier ones.
+  void GenCreateFixedLayout(const StructDef &struct_def) {
+    std::vector<size_t> offsets;
+    size_t size = 0;
+    size_t alignment = 0;
+    if (!FixedTableLayout(struct_def, &offsets, &size, &alignment)) return;
+    const auto &fields = struct_def.fields.vec;
+    std::string cond;
+    std::vector<voffset_t> vtable;
+    for (size_t i = 0; i < fields.size(); i++) {
+      const auto &field = *fields[i];
+      if (field.deprecated) continue;
+      const auto slot = field.value.offset / sizeof(voffset_t);
+      if (vtable.size() <= slot) vtable.resize(slot + 1, 0);
+      vtable[slot] = static_cast<voffset_t>(offsets[i]);
+      if (!cond.empty()) cond += " &&\n      ";
+      if (IsScalar(field.value.type.base_type)) {
+        cond += "!flatbuffers::IsTheSameAs<" +
+                GenTypeWire(field.value.type, "", false) + ">(" +
+                GenUnderlyingCast(field, false, Name(field)) + ", " +
+                GenDefaultConstant(field) + ")";
+      } else if (IsStruct(field.value.type)) {
+        cond += Name(field);
+      } else {
+        cond += Name(field) + ".o";
+      }
+    }
+    vtable[0] = static_cast<voffset_t>(vtable.size() * sizeof(voffset_t));
+    vtable[1] = static_cast<voffset_t>(size);
+    std::string vtable_init;
+    for (auto it = vtable.begin(); it != vtable.end(); ++it) {
+      if (!vtable_init.empty()) vtable_init += ", ";
+      vtable_init += NumToString(*it);
+    }
+    code_.SetValue("FIXED_COND", cond);
+    code_.SetValue("FIXED_VTABLE", vtable_init);
+    code_.SetValue("FIXED_SIZE", NumToString(size));
+    code_.SetValue("FIXED_ALIGN", NumToString(alignment));
+    code_ += "  if ({{FIXED_COND}}) {";
+    code_ +=
+        "    static const flatbuffers::voffset_t vtable_[] = { "
+        "{{FIXED_VTABLE}} };";
+    code_ +=
+        "    auto table_ = _fbb.StartFixedTable({{FIXED_SIZE}}, "
+        "{{FIXED_ALIGN}});";
+    for (size_t i = 0; i < fields.size(); i++) {
+      const auto &field = *fields[i];
+      if (field.deprecated) continue;
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("FIELD_OFFSET", NumToString(offsets[i]));
+      if (IsScalar(field.value.type.base_type)) {
+        code_.SetValue("FIELD_TYPE", GenTypeWire(field.value.type, "", false));
+        code_.SetValue("FIELD_VALUE",
+                       GenUnderlyingCast(field, false, Name(field)));
+        code_ +=
+            "    flatbuffers::WriteScalar<{{FIELD_TYPE}}>(table_ + "
+            "{{FIELD_OFFSET}}, {{FIELD_VALUE}});";
+      } else if (IsStruct(field.value.type)) {
+        code_ +=
+            "    memcpy(table_ + {{FIELD_OFFSET}}, {{FIELD_NAME}}, "
+            "sizeof(*{{FIELD_NAME}}));";
+      } else {
+        code_ +=
+            "    _fbb.AddFixedOffset(table_, {{FIELD_OFFSET}}, "
+            "{{FIELD_NAME}});";
+      }
+    }
+    code_ +=
+        "    return flatbuffers::Offset<{{STRUCT_NAME}}>("
+        "_fbb.EndFixedTable(vtable_));";
+    code_ += "  }";
+  }
+
   std::string GenUnionUnpackVal(const FieldDef &afield,
                                 const char *vec_elem_access,
                                 const char *vec_type_access) {
@@ -2256,8 +2606,61 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
-  std::string GenUnpackFieldStatement(const FieldDef &field,
-                                      const FieldDef *union_field) {
+  // Whether the native string of a field can be assigned in place, keeping
+  // its capacity.
+  bool IsAssignableString(const FieldDef &field) {
+    const auto type = NativeString(&field);
+    return type == "std::string" || type == "flatbuffers::arena_string";
+  }
+
+  // Whether an object owned through the native pointer of a field can be
+  // unpacked into again, instead of being replaced.
+  bool IsReusablePtr(const FieldDef &field) {
+    if (field.attributes.Lookup("cpp_ptr_type_get")) return false;
+    auto ptr_type = PtrType(&field);
+    if (ptr_type == "default_ptr_type") {
+      ptr_type = parser_.opts.cpp_object_api_pointer_type;
+    }
+    return ptr_type == "std::unique_ptr" || ptr_type == "flatbuffers::unique_ptr";
+  }
+
+  // Generates code that unpacks into the existing object pointed to by a
+  // field, if any, of the form:
+  //   if (_o->field) _e->UnPackTo(_o->field.get(), _resolver); else
+  std::string GenUnpackReuse(const Type &type, const std::string &val,
+                             const std::string &dest, const FieldDef &field) {
+    if (type.base_type != BASE_TYPE_STRUCT || field.native_inline ||
+        type.struct_def->attributes.Lookup("native_type") ||
+        !IsReusablePtr(field)) {
+      return "";
+    }
+    std::string code = "if (" + dest + ") ";
+    if (IsStruct(type)) {
+      code += "*" + dest + " = *" + val + ";";
+    } else {
+      code += val + "->UnPackTo(" + dest + GenPtrGet(field) + ", _resolver);";
+    }
+    return code + " else ";
+  }
+
+  // Generates code that resets a field whose value is absent from the
+  // buffer, for when UnPackTo() reuses an object.
+  std::string GenUnpackFieldReset(const FieldDef &field) {
+    const auto &type = field.value.type;
+    const auto dest = "_o->" + Name(field);
+    switch (type.base_type) {
+      case BASE_TYPE_VECTOR: return dest + ".clear();";
+      case BASE_TYPE_STRING:
+        return IsAssignableString(field) ? dest + ".clear();" : "";
+      case BASE_TYPE_STRUCT:
+        return GenUnpackReuse(type, "_e", dest, field).empty()
+                   ? ""
+                   : dest + ".reset();";
+      default: return "";
+    }
+  }
+
+  std::string GenUnpackFieldStatement(const FieldDef &field) {
     std::string code;
     switch (field.value.type.base_type) {
       case BASE_TYPE_VECTOR: {
@@ -2307,28 +2710,37 @@ class CppGenerator : public BaseGenerator {
             // GenTypeNativePtr(cpp_type->constant, &field, true) + "();";
             code += "/* else do nothing */";
           }
+        } else if (field.value.type.element == BASE_TYPE_UNION) {
+          // Unions set both their type and value, of the form:
+          //   _o->field[_i].UnPackFrom(_e->Get(_i), field_type()->...(_i),
+          //                            _resolver);
+          code += "_o->" + name + "[_i].UnPackFrom(_e->Get(_i), " +
+                  EscapeKeyword(field.name + UnionTypeFieldSuffix()) +
+                  "()->GetEnum<" + field.value.type.enum_def->name +
+                  ">(_i), _resolver)";
+        } else if (field.value.type.element == BASE_TYPE_STRING &&
+                   IsAssignableString(field)) {
+          code += "_o->" + name + "[_i].assign(_e->Get(_i)->c_str(), " +
+                  "_e->Get(_i)->size())";
         } else {
+          // Structs are stored by value in vectors.
+          const auto vector_type = field.value.type.VectorType();
+          if (!IsStruct(vector_type)) {
+            code += GenUnpackReuse(vector_type, "_e->Get(_i)",
+                                   "_o->" + name + "[_i]", field);
+          }
           code += "_o->" + name + "[_i]" + access + " = ";
-          code += GenUnpackVal(field.value.type.VectorType(), indexing, true,
-                               field);
+          code += GenUnpackVal(vector_type, indexing, true, field);
         }
         code += "; } }";
         break;
       }
-      case BASE_TYPE_UTYPE: {
-        FLATBUFFERS_ASSERT(union_field->value.type.base_type ==
-                           BASE_TYPE_UNION);
-        // Generate code that sets the union type, of the form:
-        //   _o->field.type = _e;
-        code += "_o->" + union_field->name + ".type = _e;";
-        break;
-      }
       case BASE_TYPE_UNION: {
-        // Generate code that sets the union value, of the form:
-        //   _o->field.value = Union::Unpack(_e, field_type(), resolver);
-        code += "_o->" + Name(field) + ".value = ";
-        code += GenUnionUnpackVal(field, "", "");
-        code += ";";
+        // Generate code that sets the union type and value, of the form:
+        //   _o->field.UnPackFrom(_e, field_type(), _resolver);
+        code += "_o->" + Name(field) + ".UnPackFrom(_e, " +
+                EscapeKeyword(field.name + UnionTypeFieldSuffix()) +
+                "(), _resolver);";
         break;
       }
       default: {
@@ -2356,8 +2768,16 @@ class CppGenerator : public BaseGenerator {
         } else {
           // Generate code for assigning the value, of the form:
           //  _o->field = value;
-          code += "_o->" + Name(field) + " = ";
-          code += GenUnpackVal(field.value.type, "_e", false, field) + ";";
+          // Strings and objects reuse their existing allocations, if any.
+          if (field.value.type.base_type == BASE_TYPE_STRING &&
+              IsAssignableString(field)) {
+            code += "_o->" + Name(field) + ".assign(_e->c_str(), _e->size());";
+          } else {
+            code += GenUnpackReuse(field.value.type, "_e", "_o->" + Name(field),
+                                   field);
+            code += "_o->" + Name(field) + " = ";
+            code += GenUnpackVal(field.value.type, "_e", false, field) + ";";
+          }
         }
         break;
       }
@@ -2461,7 +2881,15 @@ class CppGenerator : public BaseGenerator {
             break;
           }
           case BASE_TYPE_BOOL: {
-            code += "_fbb.CreateVector(" + value + ")";
+            if (opts.cpp_object_api_arena) {
+              // Only std::vector<bool> has a CreateVector() overload.
+              code += "_fbb.CreateVector<uint8_t>(" + value +
+                      ".size(), [](size_t i, _VectorArgs *__va) { "
+                      "return static_cast<uint8_t>(__va->_" +
+                      value + "[i]); }, &_va)";
+            } else {
+              code += "_fbb.CreateVector(" + value + ")";
+            }
             break;
           }
           case BASE_TYPE_UNION: {
@@ -2553,6 +2981,40 @@ class CppGenerator : public BaseGenerator {
     code_.SetValue("NATIVE_NAME",
                    NativeName(Name(struct_def), &struct_def, parser_.opts));
 
+    // Generate a function to create the hash index of a vector of tables,
+    // which needs the table type to be complete.
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      auto hash_index = field.attributes.Lookup("hash_index");
+      if (field.deprecated || !hash_index) continue;
+      auto vec = struct_def.fields.Lookup(hash_index->constant);
+      auto key_field = GetKeyField(*vec->value.type.struct_def);
+      code_.SetValue("INDEX_NAME", MakeCamel(Name(field)));
+      code_.SetValue("VEC_NAME", Name(*vec));
+      code_.SetValue("VEC_TYPE", GenTypeWire(vec->value.type, "", true));
+      auto key_value = "vec->Get(i)->" + Name(*key_field) + "()";
+      if (key_field->value.type.base_type != BASE_TYPE_STRING) {
+        key_value = "static_cast<" + GenKeyType(*key_field) + ">(" +
+                    key_value + ")";
+      }
+      code_.SetValue("KEY_VALUE", key_value);
+      code_ +=
+          "inline flatbuffers::Offset<flatbuffers::Vector<uint32_t>> "
+          "Create{{STRUCT_NAME}}{{INDEX_NAME}}(";
+      code_ += "    flatbuffers::FlatBufferBuilder &_fbb,";
+      code_ += "    {{VEC_TYPE}} {{VEC_NAME}}) {";
+      code_ +=
+          "  auto vec = flatbuffers::GetTemporaryPointer(_fbb, {{VEC_NAME}});";
+      code_ += "  std::vector<uint32_t> hashes(vec->size());";
+      code_ += "  for (flatbuffers::uoffset_t i = 0; i < vec->size(); i++) {";
+      code_ += "    hashes[i] = flatbuffers::HashKey({{KEY_VALUE}});";
+      code_ += "  }";
+      code_ += "  return _fbb.CreateHashIndex(hashes);";
+      code_ += "}";
+      code_ += "";
+    }
+
     if (parser_.opts.generate_object_based_api) {
       // Generate the X::UnPack() method.
       code_ += "inline " +
@@ -2573,16 +3035,32 @@ class CppGenerator : public BaseGenerator {
         const auto &field = **it;
         if (field.deprecated) { continue; }
 
+        // Union types are unpacked together with their union.
+        if (field.value.type.base_type == BASE_TYPE_UTYPE ||
+            (field.value.type.base_type == BASE_TYPE_VECTOR &&
+             field.value.type.element == BASE_TYPE_UTYPE)) {
+          continue;
+        }
+
         // Assign a value from |this| to |_o|.   Values from |this| are stored
         // in a variable |_e| by calling this->field_type().  The value is then
         // assigned to |_o| using the GenUnpackFieldStatement.
-        const bool is_union = field.value.type.base_type == BASE_TYPE_UTYPE;
-        const auto statement =
-            GenUnpackFieldStatement(field, is_union ? *(it + 1) : nullptr);
+        auto statement = GenUnpackFieldStatement(field);
+
+        // Values absent from the buffer reset the field, in case |_o| is
+        // being reused.
+        const auto reset = GenUnpackFieldReset(field);
+        if (!reset.empty()) {
+          if (statement[0] != '{') statement = "{ " + statement + " }";
+          statement += " else " + reset;
+        }
 
         code_.SetValue("FIELD_NAME", Name(field));
         auto prefix = "  { auto _e = {{FIELD_NAME}}(); ";
-        auto check = IsScalar(field.value.type.base_type) ? "" : "if (_e) ";
+        auto check = IsScalar(field.value.type.base_type) ||
+                             field.value.type.base_type == BASE_TYPE_UNION
+                         ? ""
+                         : "if (_e) ";
         auto postfix = " };";
         code_ += std::string(prefix) + check + statement + postfix;
       }
@@ -2833,6 +3311,567 @@ class CppGenerator : public BaseGenerator {
     code_ += "";
   }
 
+  // Generate the JSON conversion functions of an enum, which use names where
+  // possible, like GenerateText() and the Parser do.
+  void GenEnumJson(const EnumDef &enum_def) {
+    code_.SetValue("ENUM_NAME", Name(enum_def));
+    code_.SetValue("BASE_TYPE", GenTypeBasic(enum_def.underlying_type, false));
+    code_.SetValue("NUM_VALUES", NumToString(enum_def.size()));
+
+    code_ += "inline void ToJson({{ENUM_NAME}} _e, "
+             "flatbuffers::JsonWriter &_writer) {";
+    code_ += "  switch (_e) {";
+    for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end(); ++it) {
+      const auto &ev = **it;
+      code_ += "    case " + GetEnumValUse(enum_def, ev) + ": _writer.Enum(\"" +
+               ev.name + "\"); break;";
+    }
+    code_ += "    default: _writer.Number(static_cast<{{BASE_TYPE}}>(_e)); "
+             "break;";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+
+    code_ += "inline bool FromJson(flatbuffers::JsonReader &_reader, "
+             "{{ENUM_NAME}} *_e) {";
+    code_ += "  static const char * const names[] = {";
+    for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end(); ++it) {
+      auto suffix = *it != enum_def.Vals().back() ? "," : "";
+      code_ += "    \"" + (*it)->name + "\"" + suffix;
+    }
+    code_ += "  };";
+    code_ += "  static const {{BASE_TYPE}} values[] = {";
+    for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end(); ++it) {
+      auto suffix = *it != enum_def.Vals().back() ? "," : "";
+      code_ += "    " +
+               NumToStringCpp(enum_def.ToString(**it),
+                              enum_def.underlying_type.base_type) +
+               suffix;
+    }
+    code_ += "  };";
+    code_ += "  {{BASE_TYPE}} _v = 0;";
+    code_ += "  if (!_reader.Enum(&_v, names, values, {{NUM_VALUES}})) "
+             "return false;";
+    code_ += "  *_e = static_cast<{{ENUM_NAME}}>(_v);";
+    code_ += "  return true;";
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Generate the functions that convert union values, dispatching on the
+  // union type.
+  void GenUnionJson(const EnumDef &enum_def) {
+    code_.SetValue("ENUM_NAME", Name(enum_def));
+
+    code_ += "inline bool ToJson({{ENUM_NAME}} _type, const void *_obj, "
+             "flatbuffers::JsonWriter &_writer) {";
+    code_ += "  switch (_type) {";
+    for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end(); ++it) {
+      const auto &ev = **it;
+      if (!ev.IsNonZero()) continue;
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+      if (ev.union_type.base_type == BASE_TYPE_STRING) {
+        code_.SetValue("TYPE", "flatbuffers::String");
+        code_ += "    case {{LABEL}}:";
+        code_ += "      return _writer.String(reinterpret_cast<const "
+                 "{{TYPE}} *>(_obj));";
+      } else {
+        code_.SetValue("TYPE", WrapInNameSpace(*ev.union_type.struct_def));
+        code_ += "    case {{LABEL}}:";
+        code_ += "      return ToJson(reinterpret_cast<const {{TYPE}} *>(_obj), "
+                 "_writer);";
+      }
+    }
+    code_ += "    default: return false;";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+
+    code_ += "inline bool FromJson(flatbuffers::JsonReader &_reader, "
+             "flatbuffers::FlatBufferBuilder &_fbb, {{ENUM_NAME}} _type, "
+             "flatbuffers::Offset<void> *_o) {";
+    code_ += "  switch (_type) {";
+    for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end(); ++it) {
+      const auto &ev = **it;
+      if (!ev.IsNonZero()) continue;
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+      code_ += "    case {{LABEL}}: {";
+      if (ev.union_type.base_type == BASE_TYPE_STRING) {
+        code_ += "      if (!_reader.String()) return false;";
+        code_ += "      *_o = _fbb.CreateString(_reader.str()).Union();";
+      } else if (ev.union_type.struct_def->fixed) {
+        code_.SetValue("TYPE", WrapInNameSpace(*ev.union_type.struct_def));
+        code_ += "      {{TYPE}} _u;";
+        code_ += "      if (!FromJson(_reader, &_u)) return false;";
+        code_ += "      *_o = _fbb.CreateStruct(_u).Union();";
+      } else {
+        code_.SetValue("TYPE", WrapInNameSpace(*ev.union_type.struct_def));
+        code_ += "      flatbuffers::Offset<{{TYPE}}> _u;";
+        code_ += "      if (!FromJson(_reader, _fbb, &_u)) return false;";
+        code_ += "      *_o = _u.Union();";
+      }
+      code_ += "      return true;";
+      code_ += "    }";
+    }
+    code_ += "    default:";
+    code_ += "      return _reader.Error(\"illegal type id for union: "
+             "{{ENUM_NAME}}\");";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Declare the JSON conversion functions of a struct or table, so they can
+  // be used before their definition.
+  void GenJsonPre(const StructDef &struct_def) {
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    code_ += "inline bool ToJson(const {{STRUCT_NAME}} *_o, "
+             "flatbuffers::JsonWriter &_writer);";
+    if (struct_def.fixed) {
+      code_ += "inline bool FromJson(flatbuffers::JsonReader &_reader, "
+               "{{STRUCT_NAME}} *_o);";
+    } else {
+      code_ += "inline bool FromJson(flatbuffers::JsonReader &_reader, "
+               "flatbuffers::FlatBufferBuilder &_fbb, "
+               "flatbuffers::Offset<{{STRUCT_NAME}}> *_o);";
+    }
+  }
+
+  static bool IsVectorOfUnions(const Type &type) {
+    return type.base_type == BASE_TYPE_VECTOR &&
+           (type.element == BASE_TYPE_UNION || type.element == BASE_TYPE_UTYPE);
+  }
+
+  // Generates a statement that writes a scalar value as JSON.
+  std::string GenJsonWriteScalar(const Type &type, const std::string &val) {
+    if (type.enum_def) {
+      return "ToJson(static_cast<" + GenTypeBasic(type, true) + ">(" + val +
+             "), _writer);";
+    } else if (type.base_type == BASE_TYPE_BOOL) {
+      return "_writer.Bool(" + val + " != 0);";
+    } else {
+      return "_writer.Number(" + val + ");";
+    }
+  }
+
+  // Generates an expression that reads a scalar value from JSON into var.
+  std::string GenJsonReadScalar(const FieldDef &field, const Type &type,
+                                const std::string &var) {
+    auto hash_name = field.attributes.Lookup("hash");
+    if (type.enum_def) {
+      return "FromJson(_reader, &" + var + ")";
+    } else if (type.base_type == BASE_TYPE_BOOL) {
+      return "_reader.Bool(&" + var + ")";
+    } else if (hash_name) {
+      auto bits = NumToString(SizeOf(type.base_type) * 8);
+      return "_reader.HashedNumber(&" + var +
+             ", flatbuffers::FindHashFunction" + bits + "(\"" +
+             hash_name->constant + "\"))";
+    } else {
+      return "_reader.Number(&" + var + ")";
+    }
+  }
+
+  // Generate the function that writes a struct or table as JSON, in the same
+  // format and field order as GenerateText().
+  void GenToJson(const StructDef &struct_def) {
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    code_ += "inline bool ToJson(const {{STRUCT_NAME}} *_o, "
+             "flatbuffers::JsonWriter &_writer) {";
+    // Deprecated fields have no accessors, so they are never written.
+    bool has_fields = false;
+    bool has_scalars = false;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) continue;
+      has_fields = true;
+      has_scalars |= IsScalar(field.value.type.base_type);
+    }
+    if (!has_fields) {
+      code_ += "  (void)_o;";
+    } else if (has_scalars && !struct_def.fixed) {
+      code_ += "  auto _t = reinterpret_cast<const flatbuffers::Table *>(_o);";
+    }
+    code_ += "  _writer.StartObject();";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      const auto &type = field.value.type;
+      if (field.deprecated) continue;
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("JSON_NAME", field.name);
+      code_.SetValue("OFFSET_NAME", GenFieldOffsetName(field));
+      if (struct_def.fixed) {
+        // All fields of a struct are always present.
+        code_ += "  _writer.Key(\"{{JSON_NAME}}\");";
+        if (IsStruct(type)) {
+          code_ += "  if (!ToJson(&_o->{{FIELD_NAME}}(), _writer)) "
+                   "return false;";
+        } else {
+          code_ += "  " + GenJsonWriteScalar(type, "_o->{{FIELD_NAME}}()");
+        }
+        continue;
+      }
+      if (IsScalar(type.base_type)) {
+        code_ += "  if (_t->CheckField({{STRUCT_NAME}}::{{OFFSET_NAME}})) {";
+      } else {
+        code_ += "  if (_o->{{FIELD_NAME}}()) {";
+      }
+      code_ += "    _writer.Key(\"{{JSON_NAME}}\");";
+      switch (type.base_type) {
+        case BASE_TYPE_STRUCT:
+          code_ += "    if (!ToJson(_o->{{FIELD_NAME}}(), _writer)) "
+                   "return false;";
+          break;
+        case BASE_TYPE_STRING:
+          code_ += "    if (!_writer.String(_o->{{FIELD_NAME}}())) "
+                   "return false;";
+          break;
+        case BASE_TYPE_UNION:
+          code_.SetValue("TYPE_NAME",
+                         EscapeKeyword(field.name + UnionTypeFieldSuffix()));
+          code_ += "    if (!ToJson(_o->{{TYPE_NAME}}(), _o->{{FIELD_NAME}}(), "
+                   "_writer)) {";
+          code_ += "      return false;";
+          code_ += "    }";
+          break;
+        case BASE_TYPE_VECTOR: {
+          if (field.flexbuffer) {
+            code_ += "    _writer.FlexBuffer(_o->{{FIELD_NAME}}());";
+            break;
+          }
+          if (field.nested_flatbuffer) {
+            code_ += "    if (!ToJson(_o->{{FIELD_NAME}}_nested_root(), "
+                     "_writer)) {";
+            code_ += "      return false;";
+            code_ += "    }";
+            break;
+          }
+          const auto vtype = type.VectorType();
+          code_ += "    auto _vec = _o->{{FIELD_NAME}}();";
+          if (vtype.base_type == BASE_TYPE_UNION) {
+            // Each value is written according to its entry in the type
+            // vector, which must be of the same length.
+            code_.SetValue("TYPE_NAME",
+                           EscapeKeyword(field.name + UnionTypeFieldSuffix()));
+            code_ += "    auto _types = _o->{{TYPE_NAME}}();";
+            code_ += "    if (!_types || _types->size() != _vec->size()) "
+                     "return false;";
+          }
+          code_ += "    _writer.StartArray();";
+          code_ += "    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); "
+                   "_i++) {";
+          code_ += "      _writer.Element();";
+          if (IsScalar(vtype.base_type)) {
+            code_ += "      " + GenJsonWriteScalar(vtype, "_vec->Get(_i)");
+          } else if (vtype.base_type == BASE_TYPE_STRING) {
+            code_ += "      if (!_writer.String(_vec->Get(_i))) return false;";
+          } else if (vtype.base_type == BASE_TYPE_UNION) {
+            code_.SetValue("ENUM_NAME", WrapInNameSpace(*vtype.enum_def));
+            code_ += "      auto _type = static_cast<{{ENUM_NAME}}>("
+                     "_types->Get(_i));";
+            code_ += "      if (!ToJson(_type, _vec->Get(_i), _writer)) "
+                     "return false;";
+          } else {
+            code_ += "      if (!ToJson(_vec->Get(_i), _writer)) return false;";
+          }
+          code_ += "    }";
+          code_ += "    _writer.EndArray();";
+          break;
+        }
+        default:
+          code_ += "    " + GenJsonWriteScalar(type, "_o->{{FIELD_NAME}}()");
+          break;
+      }
+      code_ += "  }";
+    }
+    code_ += "  _writer.EndObject();";
+    code_ += "  return true;";
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Generate the statements that read a JSON array into the vector field
+  // whose local variable is given.
+  void GenFromJsonVector(const FieldDef &field, const std::string &var) {
+    const auto vtype = field.value.type.VectorType();
+    std::string elem_type;
+    if (IsStruct(vtype)) {
+      elem_type = WrapInNameSpace(*vtype.struct_def);
+    } else {
+      elem_type = GenTypeWire(vtype, "", false);
+    }
+    code_.SetValue("ELEM_TYPE", elem_type);
+    code_.SetValue("VAR", var);
+    code_ += "      std::vector<{{ELEM_TYPE}}> _vec;";
+    code_ += "      if (!_reader.StartArray()) return false;";
+    code_ += "      while (_reader.NextElement()) {";
+    if (IsScalar(vtype.base_type)) {
+      if (vtype.enum_def) {
+        code_.SetValue("USER_TYPE", GenTypeBasic(vtype, true));
+        code_ += "        auto _elem = static_cast<{{USER_TYPE}}>(0);";
+      } else if (vtype.base_type == BASE_TYPE_BOOL) {
+        code_ += "        bool _elem = false;";
+      } else {
+        code_ += "        {{ELEM_TYPE}} _elem = 0;";
+      }
+      code_ += "        if (!" + GenJsonReadScalar(field, vtype, "_elem") +
+               ") return false;";
+      if (vtype.enum_def) {
+        code_ += "        _vec.push_back(static_cast<{{ELEM_TYPE}}>(_elem));";
+      } else {
+        code_ += "        _vec.push_back(_elem);";
+      }
+    } else if (vtype.base_type == BASE_TYPE_STRING) {
+      code_ += "        if (!_reader.String()) return false;";
+      code_ += "        _vec.push_back(_fbb.CreateString(_reader.str()));";
+    } else if (IsStruct(vtype)) {
+      code_ += "        {{ELEM_TYPE}} _elem;";
+      code_ += "        if (!FromJson(_reader, &_elem)) return false;";
+      code_ += "        _vec.push_back(_elem);";
+    } else {
+      code_ += "        {{ELEM_TYPE}} _elem;";
+      code_ += "        if (!FromJson(_reader, _fbb, &_elem)) return false;";
+      code_ += "        _vec.push_back(_elem);";
+    }
+    code_ += "      }";
+    code_ += "      if (!_reader.ok()) return false;";
+    if (IsStruct(vtype)) {
+      code_ += "      {{VAR}} = _fbb.CreateVectorOfStructs(_vec);";
+    } else {
+      code_ += "      {{VAR}} = _fbb.CreateVector(_vec);";
+    }
+  }
+
+  // Generate the function that reads a struct or table from JSON. Tables
+  // collect the values of their fields, and build the table with CreateX()
+  // once the whole object has been read.
+  void GenFromJson(const StructDef &struct_def) {
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    if (struct_def.fixed) {
+      code_ += "inline bool FromJson(flatbuffers::JsonReader &_reader, "
+               "{{STRUCT_NAME}} *_o) {";
+    } else {
+      code_ += "inline bool FromJson(flatbuffers::JsonReader &_reader, "
+               "flatbuffers::FlatBufferBuilder &_fbb, "
+               "flatbuffers::Offset<{{STRUCT_NAME}}> *_o) {";
+    }
+
+    // The local variables holding the field values.
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      const auto &type = field.value.type;
+      if (field.deprecated) continue;
+      code_.SetValue("FIELD_NAME", Name(field));
+      if (IsStruct(type)) {
+        code_.SetValue("FIELD_TYPE", WrapInNameSpace(*type.struct_def));
+        code_ += "  {{FIELD_TYPE}} _{{FIELD_NAME}};";
+        if (!struct_def.fixed) {
+          code_ += "  bool _{{FIELD_NAME}}_set = false;";
+        }
+      } else if (struct_def.fixed) {
+        code_.SetValue("FIELD_TYPE", GenTypeBasic(type, true));
+        if (type.enum_def) {
+          code_ += "  auto _{{FIELD_NAME}} = static_cast<{{FIELD_TYPE}}>(0);";
+        } else if (type.base_type == BASE_TYPE_BOOL) {
+          code_ += "  bool _{{FIELD_NAME}} = false;";
+        } else {
+          code_ += "  {{FIELD_TYPE}} _{{FIELD_NAME}} = 0;";
+        }
+      } else if (IsScalar(type.base_type)) {
+        code_.SetValue("FIELD_TYPE", GenTypeWire(type, " ", true));
+        code_.SetValue("FIELD_VALUE", GetDefaultScalarValue(field, false));
+        code_ += "  {{FIELD_TYPE}}_{{FIELD_NAME}} = {{FIELD_VALUE}};";
+      } else {
+        code_.SetValue("FIELD_TYPE", GenTypeWire(type, " ", true));
+        code_ += "  {{FIELD_TYPE}}_{{FIELD_NAME}};";
+        if (type.base_type == BASE_TYPE_UNION) {
+          code_ += "  const char *_{{FIELD_NAME}}_mark = nullptr;";
+        }
+      }
+    }
+    if (struct_def.fixed) code_ += "  size_t _fields = 0;";
+
+    code_ += "  if (!_reader.StartObject()) return false;";
+    code_ += "  while (_reader.NextKey()) {";
+    code_.SetValue("ELSE", "");
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      const auto &type = field.value.type;
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("JSON_NAME", field.name);
+      code_ += "    {{ELSE}}if (_reader.KeyIs(\"{{JSON_NAME}}\")) {";
+      code_.SetValue("ELSE", "} else ");
+      if (field.deprecated) {
+        code_ += "      if (!_reader.SkipValue()) return false;";
+        continue;
+      }
+      if (IsScalar(type.base_type)) {
+        code_ += "      if (!" +
+                 GenJsonReadScalar(field, type, "_{{FIELD_NAME}}") +
+                 ") return false;";
+        continue;
+      }
+      if (!struct_def.fixed) code_ += "      if (_reader.Null()) continue;";
+      switch (type.base_type) {
+        case BASE_TYPE_STRUCT:
+          if (type.struct_def->fixed) {
+            code_ += "      if (!FromJson(_reader, &_{{FIELD_NAME}})) "
+                     "return false;";
+            if (!struct_def.fixed) code_ += "      _{{FIELD_NAME}}_set = true;";
+          } else {
+            code_ += "      if (!FromJson(_reader, _fbb, &_{{FIELD_NAME}})) "
+                     "return false;";
+          }
+          break;
+        case BASE_TYPE_STRING:
+          code_ += "      if (!_reader.String()) return false;";
+          code_ += "      _{{FIELD_NAME}} = _fbb.CreateString(_reader.str());";
+          break;
+        case BASE_TYPE_UNION: {
+          auto type_field =
+              struct_def.fields.Lookup(field.name + UnionTypeFieldSuffix());
+          FLATBUFFERS_ASSERT(type_field);
+          code_.SetValue("TYPE_NAME", Name(*type_field));
+          code_.SetValue("NONE", GetDefaultScalarValue(*type_field, false));
+          code_ += "      if (_{{TYPE_NAME}} == {{NONE}}) {";
+          code_ += "        // The type comes after the value, so read the "
+                   "value at the end.";
+          code_ += "        _{{FIELD_NAME}}_mark = _reader.Mark();";
+          code_ += "        if (!_reader.SkipValue()) return false;";
+          code_ += "      } else if (!FromJson(_reader, _fbb, _{{TYPE_NAME}}, "
+                   "&_{{FIELD_NAME}})) {";
+          code_ += "        return false;";
+          code_ += "      }";
+          break;
+        }
+        case BASE_TYPE_VECTOR:
+          if (IsVectorOfUnions(type)) {
+            code_ += "      return _reader.Error(\"vectors of unions are not "
+                     "supported: {{JSON_NAME}}\");";
+          } else if (field.flexbuffer) {
+            code_ += "      if (!_reader.FlexBuffer(_fbb, &_{{FIELD_NAME}})) "
+                     "return false;";
+          } else {
+            if (field.nested_flatbuffer) {
+              // Either a table of the nested type, or its bytes.
+              code_.SetValue("NESTED_TYPE",
+                             WrapInNameSpace(*field.nested_flatbuffer));
+              code_ += "      if (_reader.Peek() != '[') {";
+              code_ += "        flatbuffers::FlatBufferBuilder _nested;";
+              code_ += "        flatbuffers::Offset<{{NESTED_TYPE}}> _root;";
+              code_ += "        if (!FromJson(_reader, _nested, &_root)) "
+                       "return false;";
+              code_ += "        _nested.Finish(_root);";
+              code_ += "        _fbb.ForceVectorAlignment(_nested.GetSize(), "
+                       "sizeof(uint8_t),";
+              code_ += "                                  "
+                       "_nested.GetBufferMinAlignment());";
+              code_ += "        _{{FIELD_NAME}} = _fbb.CreateVector(";
+              code_ += "            _nested.GetBufferPointer(), "
+                       "_nested.GetSize());";
+              code_ += "        continue;";
+              code_ += "      }";
+            }
+            GenFromJsonVector(field, "_" + Name(field));
+          }
+          break;
+        default: FLATBUFFERS_ASSERT(0);
+      }
+    }
+    if (struct_def.fields.vec.empty()) {
+      code_ += "    if (!_reader.SkipUnknownField()) return false;";
+    } else if (struct_def.fixed) {
+      code_ += "    } else {";
+      code_ += "      if (!_reader.SkipUnknownField()) return false;";
+      code_ += "      continue;";
+      code_ += "    }";
+      code_ += "    _fields++;";
+    } else {
+      code_ += "    } else if (!_reader.SkipUnknownField()) {";
+      code_ += "      return false;";
+      code_ += "    }";
+    }
+    code_ += "  }";
+    code_ += "  if (!_reader.ok()) return false;";
+
+    if (struct_def.fixed) {
+      code_.SetValue("NUM_FIELDS", NumToString(struct_def.fields.vec.size()));
+      code_ += "  if (_fields != {{NUM_FIELDS}}) {";
+      code_ += "    return _reader.Error(\"wrong number of fields in struct: "
+               "{{STRUCT_NAME}}\");";
+      code_ += "  }";
+      code_ += "  *_o = {{STRUCT_NAME}}(\\";
+      for (auto it = struct_def.fields.vec.begin();
+           it != struct_def.fields.vec.end(); ++it) {
+        auto sep = it != struct_def.fields.vec.begin() ? ", " : "";
+        code_ += std::string(sep) + "_" + Name(**it) + "\\";
+      }
+      code_ += ");";
+      code_ += "  return true;";
+      code_ += "}";
+      code_ += "";
+      return;
+    }
+
+    // Union values that came before their type.
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated || field.value.type.base_type != BASE_TYPE_UNION) {
+        continue;
+      }
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("TYPE_NAME",
+                     EscapeKeyword(field.name + UnionTypeFieldSuffix()));
+      code_ += "  if (_{{FIELD_NAME}}_mark) {";
+      code_ += "    auto _end = _reader.Mark();";
+      code_ += "    _reader.Rewind(_{{FIELD_NAME}}_mark);";
+      code_ += "    if (!FromJson(_reader, _fbb, _{{TYPE_NAME}}, "
+               "&_{{FIELD_NAME}})) {";
+      code_ += "      return false;";
+      code_ += "    }";
+      code_ += "    _reader.Rewind(_end);";
+      code_ += "  }";
+    }
+
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated || !field.required) continue;
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("JSON_NAME", field.name);
+      if (IsStruct(field.value.type)) {
+        code_ += "  if (!_{{FIELD_NAME}}_set) {";
+      } else {
+        code_ += "  if (_{{FIELD_NAME}}.IsNull()) {";
+      }
+      code_ += "    return _reader.Error(\"required field is missing: "
+               "{{JSON_NAME}}\");";
+      code_ += "  }";
+    }
+
+    code_ += "  *_o = Create{{STRUCT_NAME}}(_fbb\\";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) continue;
+      code_.SetValue("FIELD_NAME", Name(field));
+      if (IsStruct(field.value.type)) {
+        code_ += ",\n      _{{FIELD_NAME}}_set ? &_{{FIELD_NAME}} : nullptr\\";
+      } else {
+        code_ += ",\n      _{{FIELD_NAME}}\\";
+      }
+    }
+    code_ += ");";
+    code_ += "  return true;";
+    code_ += "}";
+    code_ += "";
+  }
+
   // Set up the correct namespace. Only open a namespace if the existing one is
   // different (closing/opening only what is necessary).
   //
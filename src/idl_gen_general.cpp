@@ -1559,16 +1559,16 @@ std::string BinaryFileName(const Parser &parser, const std::string &path,
 
 bool GenerateBinary(const Parser &parser, const std::string &path,
                     const std::string &file_name) {
-  return !parser.builder_.GetSize() ||
+  return !parser.GetBufferSize() ||
          flatbuffers::SaveFile(
              BinaryFileName(parser, path, file_name).c_str(),
-             reinterpret_cast<char *>(parser.builder_.GetBufferPointer()),
-             parser.builder_.GetSize(), true);
+             reinterpret_cast<const char *>(parser.GetBufferPointer()),
+             parser.GetBufferSize(), true);
 }
 
 std::string BinaryMakeRule(const Parser &parser, const std::string &path,
                            const std::string &file_name) {
-  if (!parser.builder_.GetSize()) return "";
+  if (!parser.GetBufferSize()) return "";
   std::string filebase =
       flatbuffers::StripPath(flatbuffers::StripExtension(file_name));
   std::string make_rule =
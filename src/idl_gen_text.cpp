@@ -21,246 +21,269 @@
 #include "flatbuffers/idl.h"
 #include "flatbuffers/util.h"
 
-namespace flatbuffers {
+#include <cstdio>
+#include <fstream>
 
-static bool GenStruct(const StructDef &struct_def, const Table *table,
-                      int indent, const IDLOptions &opts, std::string *_text);
+namespace flatbuffers {
 
-// If indentation is less than 0, that indicates we don't want any newlines
-// either.
-const char *NewLine(const IDLOptions &opts) {
-  return opts.indent_step >= 0 ? "\n" : "";
+// Converts a scalar to JSON text. Floats use the shortest representation that
+// converts back to the same value, unless fixed precision is asked for.
+template<typename T>
+std::string ScalarToString(T val, const IDLOptions & /*opts*/) {
+  return NumToString(val);
 }
 
-int Indent(const IDLOptions &opts) { return std::max(opts.indent_step, 0); }
+std::string ScalarToString(float val, const IDLOptions &opts) {
+  return opts.fixed_precision_floats ? NumToString(val)
+                                     : FloatToShortestString(val);
+}
 
-// Output an identifier with or without quotes depending on strictness.
-void OutputIdentifier(const std::string &name, const IDLOptions &opts,
-                      std::string *_text) {
-  std::string &text = *_text;
-  if (opts.strict_json) text += "\"";
-  text += name;
-  if (opts.strict_json) text += "\"";
+std::string ScalarToString(double val, const IDLOptions &opts) {
+  return opts.fixed_precision_floats ? NumToString(val)
+                                     : FloatToShortestString(val);
 }
 
-// Print (and its template specialization below for pointers) generate text
-// for a single FlatBuffer value into JSON format.
-// The general case for scalars:
-template<typename T>
-bool Print(T val, Type type, int /*indent*/, Type * /*union_type*/,
-           const IDLOptions &opts, std::string *_text) {
-  std::string &text = *_text;
-  if (type.enum_def && opts.output_enum_identifiers) {
-    auto ev = type.enum_def->ReverseLookup(static_cast<int64_t>(val));
-    if (ev) {
-      text += "\"";
-      text += ev->name;
-      text += "\"";
-      return true;
-    }
-  }
+// Generates the text of a FlatBuffer into text. If a sink is given, text is
+// passed on to it in chunks while generating, so it never holds more than
+// about one chunk (and the largest single value).
+struct JsonPrinter {
+  JsonPrinter(const IDLOptions &_opts, std::string &_text, TextSink *_sink,
+              size_t _chunk_size)
+      : opts(_opts), text(_text), sink(_sink), chunk_size(_chunk_size) {}
+
+  // If indentation is less than 0, that indicates we don't want any newlines
+  // either.
+  const char *NewLine() const { return opts.indent_step >= 0 ? "\n" : ""; }
 
-  if (type.base_type == BASE_TYPE_BOOL) {
-    text += val != 0 ? "true" : "false";
-  } else {
-    text += NumToString(val);
+  int Indent() const { return std::max(opts.indent_step, 0); }
+
+  // Output an identifier with or without quotes depending on strictness.
+  void OutputIdentifier(const std::string &name) {
+    if (opts.strict_json) text += "\"";
+    text += name;
+    if (opts.strict_json) text += "\"";
   }
 
-  return true;
-}
+  // Passes the text on to the sink, if any, once a chunk is full.
+  bool MaybeFlush() { return !sink || text.size() < chunk_size || Flush(); }
 
-// Print a vector a sequence of JSON values, comma separated, wrapped in "[]".
-template<typename T>
-bool PrintVector(const Vector<T> &v, Type type, int indent,
-                 const IDLOptions &opts, std::string *_text) {
-  std::string &text = *_text;
-  text += "[";
-  text += NewLine(opts);
-  for (uoffset_t i = 0; i < v.size(); i++) {
-    if (i) {
-      if (!opts.protobuf_ascii_alike) text += ",";
-      text += NewLine(opts);
-    }
-    text.append(indent + Indent(opts), ' ');
-    if (IsStruct(type)) {
-      if (!Print(v.GetStructFromOffset(i * type.struct_def->bytesize), type,
-                 indent + Indent(opts), nullptr, opts, _text)) {
-        return false;
-      }
-    } else {
-      if (!Print(v[i], type, indent + Indent(opts), nullptr, opts, _text)) {
-        return false;
-      }
-    }
+  bool Flush() {
+    auto ok = text.empty() || sink->Write(text.data(), text.size());
+    text.clear();
+    return ok;
   }
-  text += NewLine(opts);
-  text.append(indent, ' ');
-  text += "]";
-  return true;
-}
 
-// Specialization of Print above for pointer types.
-template<>
-bool Print<const void *>(const void *val, Type type, int indent,
-                         Type *union_type, const IDLOptions &opts,
-                         std::string *_text) {
-  switch (type.base_type) {
-    case BASE_TYPE_UNION:
-      // If this assert hits, you have an corrupt buffer, a union type field
-      // was not present or was out of range.
-      FLATBUFFERS_ASSERT(union_type);
-      return Print<const void *>(val, *union_type, indent, nullptr, opts,
-                                 _text);
-    case BASE_TYPE_STRUCT:
-      if (!GenStruct(*type.struct_def, reinterpret_cast<const Table *>(val),
-                     indent, opts, _text)) {
-        return false;
-      }
-      break;
-    case BASE_TYPE_STRING: {
-      auto s = reinterpret_cast<const String *>(val);
-      if (!EscapeString(s->c_str(), s->size(), _text, opts.allow_non_utf8,
-                        opts.natural_utf8)) {
-        return false;
+  // Print (and its overload below for pointers) generate text for a single
+  // FlatBuffer value into JSON format.
+  // The general case for scalars:
+  template<typename T>
+  bool Print(T val, Type type, int /*indent*/, Type * /*union_type*/) {
+    if (type.enum_def && opts.output_enum_identifiers) {
+      auto ev = type.enum_def->ReverseLookup(static_cast<int64_t>(val));
+      if (ev) {
+        text += "\"";
+        text += ev->name;
+        text += "\"";
+        return true;
       }
-      break;
     }
-    case BASE_TYPE_VECTOR:
-      type = type.VectorType();
-      // Call PrintVector above specifically for each element type:
-      switch (type.base_type) {
-        // clang-format off
-        #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
-          CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
-          case BASE_TYPE_ ## ENUM: \
-            if (!PrintVector<CTYPE>( \
-                  *reinterpret_cast<const Vector<CTYPE> *>(val), \
-                  type, indent, opts, _text)) { \
-              return false; \
-            } \
-            break;
-          FLATBUFFERS_GEN_TYPES(FLATBUFFERS_TD)
-        #undef FLATBUFFERS_TD
-        // clang-format on
-      }
-      break;
-    default: FLATBUFFERS_ASSERT(0);
-  }
-  return true;
-}
-
-template<typename T> static T GetFieldDefault(const FieldDef &fd) {
-  T val;
-  auto check = StringToNumber(fd.value.constant.c_str(), &val);
-  (void)check;
-  FLATBUFFERS_ASSERT(check);
-  return val;
-}
 
-// Generate text for a scalar field.
-template<typename T>
-static bool GenField(const FieldDef &fd, const Table *table, bool fixed,
-                     const IDLOptions &opts, int indent, std::string *_text) {
-  return Print(
-      fixed ? reinterpret_cast<const Struct *>(table)->GetField<T>(
-                  fd.value.offset)
-            : table->GetField<T>(fd.value.offset, GetFieldDefault<T>(fd)),
-      fd.value.type, indent, nullptr, opts, _text);
-}
+    if (type.base_type == BASE_TYPE_BOOL) {
+      text += val != 0 ? "true" : "false";
+    } else {
+      text += ScalarToString(val, opts);
+    }
 
-static bool GenStruct(const StructDef &struct_def, const Table *table,
-                      int indent, const IDLOptions &opts, std::string *_text);
-
-// Generate text for non-scalar field.
-static bool GenFieldOffset(const FieldDef &fd, const Table *table, bool fixed,
-                           int indent, Type *union_type, const IDLOptions &opts,
-                           std::string *_text) {
-  const void *val = nullptr;
-  if (fixed) {
-    // The only non-scalar fields in structs are structs.
-    FLATBUFFERS_ASSERT(IsStruct(fd.value.type));
-    val = reinterpret_cast<const Struct *>(table)->GetStruct<const void *>(
-        fd.value.offset);
-  } else if (fd.flexbuffer) {
-    auto vec = table->GetPointer<const Vector<uint8_t> *>(fd.value.offset);
-    auto root = flexbuffers::GetRoot(vec->data(), vec->size());
-    root.ToString(true, opts.strict_json, *_text);
     return true;
-  } else if (fd.nested_flatbuffer) {
-    auto vec = table->GetPointer<const Vector<uint8_t> *>(fd.value.offset);
-    auto root = GetRoot<Table>(vec->data());
-    return GenStruct(*fd.nested_flatbuffer, root, indent, opts, _text);
-  } else {
-    val = IsStruct(fd.value.type)
-              ? table->GetStruct<const void *>(fd.value.offset)
-              : table->GetPointer<const void *>(fd.value.offset);
   }
-  return Print(val, fd.value.type, indent, union_type, opts, _text);
-}
 
-// Generate text for a struct or table, values separated by commas, indented,
-// and bracketed by "{}"
-static bool GenStruct(const StructDef &struct_def, const Table *table,
-                      int indent, const IDLOptions &opts, std::string *_text) {
-  std::string &text = *_text;
-  text += "{";
-  int fieldout = 0;
-  Type *union_type = nullptr;
-  for (auto it = struct_def.fields.vec.begin();
-       it != struct_def.fields.vec.end(); ++it) {
-    FieldDef &fd = **it;
-    auto is_present = struct_def.fixed || table->CheckField(fd.value.offset);
-    auto output_anyway = opts.output_default_scalars_in_json &&
-                         IsScalar(fd.value.type.base_type) && !fd.deprecated;
-    if (is_present || output_anyway) {
-      if (fieldout++) {
-        if (!opts.protobuf_ascii_alike) text += ",";
+  // Overload of Print above for pointer types.
+  bool Print(const void *val, Type type, int indent, Type *union_type) {
+    switch (type.base_type) {
+      case BASE_TYPE_UNION:
+        // If this assert hits, you have an corrupt buffer, a union type field
+        // was not present or was out of range.
+        FLATBUFFERS_ASSERT(union_type);
+        return Print(val, *union_type, indent, nullptr);
+      case BASE_TYPE_STRUCT:
+        if (!GenStruct(*type.struct_def, reinterpret_cast<const Table *>(val),
+                       indent)) {
+          return false;
+        }
+        break;
+      case BASE_TYPE_STRING: {
+        auto s = reinterpret_cast<const String *>(val);
+        if (!EscapeString(s->c_str(), s->size(), &text, opts.allow_non_utf8,
+                          opts.natural_utf8)) {
+          return false;
+        }
+        break;
       }
-      text += NewLine(opts);
-      text.append(indent + Indent(opts), ' ');
-      OutputIdentifier(fd.name, opts, _text);
-      if (!opts.protobuf_ascii_alike ||
-          (fd.value.type.base_type != BASE_TYPE_STRUCT &&
-           fd.value.type.base_type != BASE_TYPE_VECTOR))
-        text += ":";
-      text += " ";
-      switch (fd.value.type.base_type) {
+      case BASE_TYPE_VECTOR:
+        type = type.VectorType();
+        // Call PrintVector below specifically for each element type:
+        switch (type.base_type) {
           // clang-format off
           #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
             CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
             case BASE_TYPE_ ## ENUM: \
-              if (!GenField<CTYPE>(fd, table, struct_def.fixed, \
-                                   opts, indent + Indent(opts), _text)) { \
+              if (!PrintVector<CTYPE>( \
+                    *reinterpret_cast<const Vector<CTYPE> *>(val), \
+                    type, indent)) { \
                 return false; \
               } \
               break;
-          FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD)
-        #undef FLATBUFFERS_TD
-        // Generate drop-thru case statements for all pointer types:
-        #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
-          CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
-          case BASE_TYPE_ ## ENUM:
-          FLATBUFFERS_GEN_TYPES_POINTER(FLATBUFFERS_TD)
-        #undef FLATBUFFERS_TD
-            if (!GenFieldOffset(fd, table, struct_def.fixed, indent + Indent(opts),
-                                union_type, opts, _text)) {
-              return false;
-            }
-            break;
+            FLATBUFFERS_GEN_TYPES(FLATBUFFERS_TD)
+          #undef FLATBUFFERS_TD
           // clang-format on
+        }
+        break;
+      default: FLATBUFFERS_ASSERT(0);
+    }
+    return true;
+  }
+
+  // Print a vector a sequence of JSON values, comma separated, wrapped in
+  // "[]".
+  template<typename T>
+  bool PrintVector(const Vector<T> &v, Type type, int indent) {
+    text += "[";
+    text += NewLine();
+    for (uoffset_t i = 0; i < v.size(); i++) {
+      if (i) {
+        if (!opts.protobuf_ascii_alike) text += ",";
+        text += NewLine();
       }
-      if (fd.value.type.base_type == BASE_TYPE_UTYPE) {
-        auto enum_val = fd.value.type.enum_def->ReverseLookup(
-            table->GetField<uint8_t>(fd.value.offset, 0), true);
-        union_type = enum_val ? &enum_val->union_type : nullptr;
+      text.append(indent + Indent(), ' ');
+      if (IsStruct(type)) {
+        if (!Print(v.GetStructFromOffset(i * type.struct_def->bytesize), type,
+                   indent + Indent(), nullptr)) {
+          return false;
+        }
+      } else {
+        if (!Print(v[i], type, indent + Indent(), nullptr)) { return false; }
       }
+      if (!MaybeFlush()) return false;
     }
+    text += NewLine();
+    text.append(indent, ' ');
+    text += "]";
+    return true;
   }
-  text += NewLine(opts);
-  text.append(indent, ' ');
-  text += "}";
-  return true;
-}
+
+  template<typename T> static T GetFieldDefault(const FieldDef &fd) {
+    T val;
+    auto check = StringToNumber(fd.value.constant.c_str(), &val);
+    (void)check;
+    FLATBUFFERS_ASSERT(check);
+    return val;
+  }
+
+  // Generate text for a scalar field.
+  template<typename T>
+  bool GenField(const FieldDef &fd, const Table *table, bool fixed,
+                int indent) {
+    return Print(
+        fixed ? reinterpret_cast<const Struct *>(table)->GetField<T>(
+                    fd.value.offset)
+              : table->GetField<T>(fd.value.offset, GetFieldDefault<T>(fd)),
+        fd.value.type, indent, nullptr);
+  }
+
+  // Generate text for non-scalar field.
+  bool GenFieldOffset(const FieldDef &fd, const Table *table, bool fixed,
+                      int indent, Type *union_type) {
+    const void *val = nullptr;
+    if (fixed) {
+      // The only non-scalar fields in structs are structs.
+      FLATBUFFERS_ASSERT(IsStruct(fd.value.type));
+      val = reinterpret_cast<const Struct *>(table)->GetStruct<const void *>(
+          fd.value.offset);
+    } else if (fd.flexbuffer) {
+      auto vec = table->GetPointer<const Vector<uint8_t> *>(fd.value.offset);
+      auto root = flexbuffers::GetRoot(vec->data(), vec->size());
+      root.ToString(true, opts.strict_json, text);
+      return true;
+    } else if (fd.nested_flatbuffer) {
+      auto vec = table->GetPointer<const Vector<uint8_t> *>(fd.value.offset);
+      auto root = GetRoot<Table>(vec->data());
+      return GenStruct(*fd.nested_flatbuffer, root, indent);
+    } else {
+      val = IsStruct(fd.value.type)
+                ? table->GetStruct<const void *>(fd.value.offset)
+                : table->GetPointer<const void *>(fd.value.offset);
+    }
+    return Print(val, fd.value.type, indent, union_type);
+  }
+
+  // Generate text for a struct or table, values separated by commas,
+  // indented, and bracketed by "{}"
+  bool GenStruct(const StructDef &struct_def, const Table *table, int indent) {
+    text += "{";
+    int fieldout = 0;
+    Type *union_type = nullptr;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      FieldDef &fd = **it;
+      auto is_present = struct_def.fixed || table->CheckField(fd.value.offset);
+      auto output_anyway = opts.output_default_scalars_in_json &&
+                           IsScalar(fd.value.type.base_type) && !fd.deprecated;
+      if (is_present || output_anyway) {
+        if (fieldout++) {
+          if (!opts.protobuf_ascii_alike) text += ",";
+        }
+        text += NewLine();
+        text.append(indent + Indent(), ' ');
+        OutputIdentifier(fd.name);
+        if (!opts.protobuf_ascii_alike ||
+            (fd.value.type.base_type != BASE_TYPE_STRUCT &&
+             fd.value.type.base_type != BASE_TYPE_VECTOR))
+          text += ":";
+        text += " ";
+        switch (fd.value.type.base_type) {
+            // clang-format off
+            #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
+              CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
+              case BASE_TYPE_ ## ENUM: \
+                if (!GenField<CTYPE>(fd, table, struct_def.fixed, \
+                                     indent + Indent())) { \
+                  return false; \
+                } \
+                break;
+            FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD)
+          #undef FLATBUFFERS_TD
+          // Generate drop-thru case statements for all pointer types:
+          #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
+            CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
+            case BASE_TYPE_ ## ENUM:
+            FLATBUFFERS_GEN_TYPES_POINTER(FLATBUFFERS_TD)
+          #undef FLATBUFFERS_TD
+              if (!GenFieldOffset(fd, table, struct_def.fixed,
+                                  indent + Indent(), union_type)) {
+                return false;
+              }
+              break;
+            // clang-format on
+        }
+        if (fd.value.type.base_type == BASE_TYPE_UTYPE) {
+          auto enum_val = fd.value.type.enum_def->ReverseLookup(
+              table->GetField<uint8_t>(fd.value.offset, 0), true);
+          union_type = enum_val ? &enum_val->union_type : nullptr;
+        }
+        if (!MaybeFlush()) return false;
+      }
+    }
+    text += NewLine();
+    text.append(indent, ' ');
+    text += "}";
+    return true;
+  }
+
+  const IDLOptions &opts;
+  std::string &text;
+  TextSink *sink;
+  size_t chunk_size;
+};
 
 // Generate a text representation of a flatbuffer in JSON format.
 bool GenerateTextFromTable(const Parser &parser, const void *table,
@@ -272,10 +295,11 @@ bool GenerateTextFromTable(const Parser &parser, const void *table,
   auto text = *_text;
   text.reserve(1024);  // Reduce amount of inevitable reallocs.
   auto root = static_cast<const Table *>(table);
-  if (!GenStruct(*struct_def, root, 0, parser.opts, _text)) {
+  JsonPrinter printer(parser.opts, *_text, nullptr, 0);
+  if (!printer.GenStruct(*struct_def, root, 0)) {
     return false;
   }
-  text += NewLine(parser.opts);
+  text += printer.NewLine();
   return true;
 }
 
@@ -287,32 +311,96 @@ bool GenerateText(const Parser &parser, const void *flatbuffer,
   text.reserve(1024);               // Reduce amount of inevitable reallocs.
   auto root = parser.opts.size_prefixed ?
       GetSizePrefixedRoot<Table>(flatbuffer) : GetRoot<Table>(flatbuffer);
-  if (!GenStruct(*parser.root_struct_def_, root, 0, parser.opts, _text)) {
+  JsonPrinter printer(parser.opts, text, nullptr, 0);
+  if (!printer.GenStruct(*parser.root_struct_def_, root, 0)) {
     return false;
   }
-  text += NewLine(parser.opts);
+  text += printer.NewLine();
   return true;
 }
 
+bool GenerateText(const Parser &parser, const void *flatbuffer,
+                  TextSink *sink, size_t chunk_size) {
+  FLATBUFFERS_ASSERT(parser.root_struct_def_);  // call SetRootType()
+  std::string text;
+  text.reserve(chunk_size + 1024);  // Most chunks end up a bit over size.
+  auto root = parser.opts.size_prefixed ?
+      GetSizePrefixedRoot<Table>(flatbuffer) : GetRoot<Table>(flatbuffer);
+  JsonPrinter printer(parser.opts, text, sink, chunk_size);
+  if (!printer.GenStruct(*parser.root_struct_def_, root, 0)) {
+    return false;
+  }
+  text += printer.NewLine();
+  return printer.Flush();
+}
+
 std::string TextFileName(const std::string &path,
                          const std::string &file_name) {
   return path + file_name + ".json";
 }
 
+// Writes text to a temporary file as it is generated. Commit() then replaces
+// the file with it, so a failure never leaves a truncated file behind.
+class FileTextSink : public TextSink {
+ public:
+  explicit FileTextSink(const std::string &file_name)
+      : file_name_(file_name),
+        tmp_name_(file_name + ".tmp"),
+        ofs_(tmp_name_.c_str(), std::ofstream::out),
+        committed_(false) {}
+
+  ~FileTextSink() {
+    if (committed_) return;
+    if (ofs_.is_open()) ofs_.close();
+    std::remove(tmp_name_.c_str());
+  }
+
+  bool is_open() const { return ofs_.is_open(); }
+
+  bool Write(const char *data, size_t size) {
+    ofs_.write(data, static_cast<std::streamsize>(size));
+    return !ofs_.bad();
+  }
+
+  bool Commit() {
+    ofs_.close();
+    if (ofs_.fail()) return false;
+    // clang-format off
+    #ifdef _WIN32
+      // rename() doesn't replace existing files there.
+      std::remove(file_name_.c_str());
+    #endif
+    // clang-format on
+    committed_ = !std::rename(tmp_name_.c_str(), file_name_.c_str());
+    return committed_;
+  }
+
+ private:
+  std::string file_name_;
+  std::string tmp_name_;
+  std::ofstream ofs_;
+  bool committed_;
+};
+
 bool GenerateTextFile(const Parser &parser, const std::string &path,
                       const std::string &file_name) {
-  if (!parser.builder_.GetSize() || !parser.root_struct_def_) return true;
-  std::string text;
-  if (!GenerateText(parser, parser.builder_.GetBufferPointer(), &text)) {
-    return false;
+  if (!parser.GetBufferSize() || !parser.root_struct_def_) return true;
+  auto text_file_name = TextFileName(path, file_name);
+  if (HasCustomSaveFileFunction()) {
+    // It takes the whole file at once.
+    std::string text;
+    return GenerateText(parser, parser.GetBufferPointer(), &text) &&
+           SaveFile(text_file_name.c_str(), text, false);
   }
-  return flatbuffers::SaveFile(TextFileName(path, file_name).c_str(), text,
-                               false);
+  FileTextSink sink(text_file_name);
+  return sink.is_open() &&
+         GenerateText(parser, parser.GetBufferPointer(), &sink) &&
+         sink.Commit();
 }
 
 std::string TextMakeRule(const Parser &parser, const std::string &path,
                          const std::string &file_name) {
-  if (!parser.builder_.GetSize() || !parser.root_struct_def_) return "";
+  if (!parser.GetBufferSize() || !parser.root_struct_def_) return "";
   std::string filebase =
       flatbuffers::StripPath(flatbuffers::StripExtension(file_name));
   std::string make_rule = TextFileName(path, filebase) + ": " + file_name;
@@ -15,7 +15,9 @@
  */
 
 #include <algorithm>
+#include <istream>
 #include <list>
+#include <ostream>
 #include <string>
 #include <utility>
 
@@ -250,6 +252,50 @@ static inline bool IsIdentifierStart(char c) {
   return is_alpha(c) || (c == '_');
 }
 
+// Whether c can be copied as is from a string constant, and leaves it a
+// trivial ASCII string (see attr_is_trivial_ascii_string_).
+static inline bool IsPlainStringChar(char c, char quote) {
+  return check_ascii_range(c, ' ', '~') && c != quote && c != '\\';
+}
+
+// Returns the first char from p that is not IsPlainStringChar(). Looks at
+// whole blocks of chars at once where possible, which must not go past end.
+static const char *SkipPlainStringChars(const char *p, const char *end,
+                                        char quote) {
+  // Look at 8 chars at a time in a 64-bit int, using bit tricks that detect
+  // whether any byte is a quote, a backslash, < ' ' or > '~'.
+  const uint64_t ones = 0x0101010101010101ULL;
+  const uint64_t highs = ones * 0x80;
+  auto has_zero = [&](uint64_t x) { return (x - ones) & ~x & highs; };
+  while (end - p >= 8) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    if (has_zero(v ^ (ones * static_cast<uint8_t>(quote))) ||
+        has_zero(v ^ (ones * '\\')) || ((v - ones * ' ') & ~v & highs) ||
+        ((v + ones * (127 - '~')) | v) & highs)
+      break;
+    p += 8;
+  }
+  // Find the exact position in the last block.
+  while (IsPlainStringChar(*p, quote)) p++;
+  return p;
+}
+
+// Returns the first char from p that is not a space, tab or carriage return.
+// Skips whole blocks of spaces at once where possible, which are most of the
+// indentation of pretty printed JSON. Blocks must not go past end.
+static const char *SkipBlanks(const char *p, const char *end) {
+  const uint64_t spaces = 0x2020202020202020ULL;
+  while (end - p >= 8) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    if (v != spaces) break;
+    p += 8;
+  }
+  while (*p == ' ' || *p == '\t' || *p == '\r') p++;
+  return p;
+}
+
 CheckedError Parser::Next() {
   doc_comment_.clear();
   bool seen_newline = cursor_ == source_;
@@ -265,7 +311,7 @@ CheckedError Parser::Next() {
         return NoError();
       case ' ':
       case '\r':
-      case '\t': break;
+      case '\t': cursor_ = SkipBlanks(cursor_, end_); break;
       case '\n':
         MarkNewLine();
         seen_newline = true;
@@ -285,6 +331,16 @@ CheckedError Parser::Next() {
         int unicode_high_surrogate = -1;
 
         while (*cursor_ != c) {
+          if (unicode_high_surrogate == -1) {
+            // Copy runs of plain chars at once, which is most of a typical
+            // string.
+            auto run_end = SkipPlainStringChars(cursor_, end_, c);
+            if (run_end != cursor_) {
+              attribute_.append(cursor_, run_end);
+              cursor_ = run_end;
+              continue;
+            }
+          }
           if (*cursor_ < ' ' && static_cast<signed char>(*cursor_) >= 0)
             return Error("illegal character in string constant");
           if (*cursor_ == '\\') {
@@ -807,6 +863,15 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
     field->nested_flatbuffer = LookupStruct(nested_qualified_name);
   }
 
+  auto hash_index = field->attributes.Lookup("hash_index");
+  if (hash_index) {
+    if (hash_index->type.base_type != BASE_TYPE_STRING)
+      return Error(
+          "hash_index attribute must be a string (the vector it indexes)");
+    if (type.base_type != BASE_TYPE_VECTOR || type.element != BASE_TYPE_UINT)
+      return Error("hash_index attribute may only apply to a vector of uint");
+  }
+
   if (field->attributes.Lookup("flexbuffer")) {
     field->flexbuffer = true;
     uses_flexbuffers_ = true;
@@ -891,7 +956,7 @@ CheckedError Parser::ParseAnyValue(Value &val, FieldDef *field,
         // scanning/serialization logic would get very complicated.
         auto type_name = field->name + UnionTypeFieldSuffix();
         FLATBUFFERS_ASSERT(parent_struct_def);
-        auto type_field = parent_struct_def->fields.Lookup(type_name);
+        auto type_field = parent_struct_def->LookupField(type_name);
         FLATBUFFERS_ASSERT(type_field);  // Guaranteed by ParseField().
         // Remember where we are in the source file, so we can come back here.
         auto backup = *static_cast<ParserState *>(this);
@@ -1033,7 +1098,7 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
           ECHECK(Expect(kTokenStringConstant));
           return NoError();
         }
-        auto field = struct_def_inner->fields.Lookup(name);
+        auto field = struct_def_inner->LookupField(name);
         if (!field) {
           if (!opts.skip_unexpected_fields_in_json) {
             return Error("unknown field: " + name);
@@ -2566,6 +2631,96 @@ bool Parser::ParseFlexBuffer(const char *source, const char *source_filename,
   return ok;
 }
 
+JsonConverter::JsonConverter(const Parser &schema) : parser_(schema.opts) {
+  // Borrow the definitions of the schema, without taking ownership.
+  parser_.structs_.dict = schema.structs_.dict;
+  parser_.structs_.vec = schema.structs_.vec;
+  parser_.enums_.dict = schema.enums_.dict;
+  parser_.enums_.vec = schema.enums_.vec;
+  parser_.root_struct_def_ = schema.root_struct_def_;
+  parser_.file_identifier_ = schema.file_identifier_;
+  parser_.uses_flexbuffers_ = schema.uses_flexbuffers_;
+}
+
+JsonConverter::~JsonConverter() {
+  // Clear the borrowed definitions, so they don't get deleted with parser_.
+  parser_.structs_.dict.clear();
+  parser_.structs_.vec.clear();
+  parser_.enums_.dict.clear();
+  parser_.enums_.vec.clear();
+}
+
+bool JsonConverter::Parse(const char *json) {
+  FLATBUFFERS_ASSERT(0 == parser_.recurse_protection_counter);
+  auto r = !parser_.DoParseJson(json).Check();
+  FLATBUFFERS_ASSERT(0 == parser_.recurse_protection_counter);
+  return r;
+}
+
+bool JsonConverter::ConvertStream(std::istream &in, std::ostream &out,
+                                  const char *source_filename) {
+  // Lines are parsed where they are in buf, with their newline replaced by
+  // a terminator. A line that doesn't fit is moved to the front of buf,
+  // which grows if needed, and the rest of it read behind it.
+  static const size_t kBlockSize = 1 << 16;
+  std::vector<char> buf(kBlockSize + 1);
+  size_t begin = 0, end = 0;  // The part of buf not converted yet.
+  auto eof = false;
+  auto ok = true;
+  auto size_prefixed = parser_.opts.size_prefixed;
+  parser_.opts.size_prefixed = true;
+  parser_.error_.clear();
+  for (int line = 1; ok; line++) {
+    auto newline =
+        static_cast<char *>(memchr(buf.data() + begin, '\n', end - begin));
+    while (!newline && !eof) {
+      auto scanned = end - begin;
+      memmove(buf.data(), buf.data() + begin, scanned);
+      begin = 0;
+      end = scanned;
+      // Always leave room for the terminator of the last line.
+      if (buf.size() < end + kBlockSize + 1) buf.resize(end + kBlockSize + 1);
+      in.read(buf.data() + end, static_cast<std::streamsize>(kBlockSize));
+      end += static_cast<size_t>(in.gcount());
+      if (in.bad()) {
+        parser_.error_ = "error reading input";
+        ok = false;
+        break;
+      }
+      eof = !in;  // Also stops if `in` failed to open.
+      newline = static_cast<char *>(
+          memchr(buf.data() + scanned, '\n', end - scanned));
+    }
+    if (!ok) break;
+    if (!newline) {
+      if (begin == end) break;
+      newline = buf.data() + end;  // The last line has no newline.
+    }
+    *newline = '\0';
+    auto json = buf.data() + begin;
+    begin = std::min(static_cast<size_t>(newline - buf.data()) + 1, end);
+    auto p = json;
+    while (*p == ' ' || *p == '\t' || *p == '\r') p++;
+    if (p == newline) continue;
+    ok = !parser_.DoParseJson(json, source_filename, line).Check();
+    // The parser stops at a 0 byte, so there must be none in the line.
+    if (ok && parser_.cursor_ != newline) {
+      ok = !parser_.Error("illegal character: \\0").Check();
+    }
+    if (!ok) break;
+    auto &fbb = parser_.builder_;
+    out.write(reinterpret_cast<const char *>(fbb.GetBufferPointer()),
+              static_cast<std::streamsize>(fbb.GetSize()));
+    if (out.bad()) {
+      parser_.error_ = "error writing output";
+      ok = false;
+    }
+  }
+  parser_.opts.size_prefixed = size_prefixed;
+  FLATBUFFERS_ASSERT(0 == parser_.recurse_protection_counter);
+  return ok;
+}
+
 bool Parser::Parse(const char *source, const char **include_paths,
                    const char *source_filename) {
   FLATBUFFERS_ASSERT(0 == recurse_protection_counter);
@@ -2575,10 +2730,11 @@ bool Parser::Parse(const char *source, const char **include_paths,
 }
 
 CheckedError Parser::StartParseFile(const char *source,
-                                    const char *source_filename) {
+                                    const char *source_filename, int line) {
   file_being_parsed_ = source_filename ? source_filename : "";
   source_ = source;
   ResetState(source_);
+  line_ = line;
   error_.clear();
   ECHECK(SkipByteOrderMark());
   NEXT();
@@ -2648,6 +2804,36 @@ CheckedError Parser::ParseRoot(const char *source, const char **include_paths,
     ++it;
   }
 
+  // Build the tables LookupField() uses to find fields quickly in JSON. A
+  // parser may be reused for more schemas, so also rebuild those that fields
+  // were added to since.
+  for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+    auto &struct_def = **it;
+    if (struct_def.field_lookup_count != struct_def.fields.vec.size() ||
+        struct_def.field_lookup.empty())
+      struct_def.BuildFieldLookup();
+  }
+
+  // The vector indexed by a hash_index may be declared after it, and its
+  // element type anywhere, so check it once everything has been parsed.
+  for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+    auto &struct_def = **it;
+    for (auto field_it = struct_def.fields.vec.begin();
+         field_it != struct_def.fields.vec.end(); ++field_it) {
+      auto hash_index = (*field_it)->attributes.Lookup("hash_index");
+      if (!hash_index) continue;
+      auto vec = struct_def.fields.Lookup(hash_index->constant);
+      if (!vec || vec->deprecated ||
+          vec->value.type.base_type != BASE_TYPE_VECTOR ||
+          vec->value.type.element != BASE_TYPE_STRUCT ||
+          vec->value.type.struct_def->fixed ||
+          !vec->value.type.struct_def->has_key)
+        return Error("hash_index of " + (*field_it)->name +
+                     " must name a vector of tables with a key in " +
+                     struct_def.name + ": " + hash_index->constant);
+    }
+  }
+
   // This check has to happen here and not earlier, because only now do we
   // know for sure what the type of these are.
   for (auto it = enums_.vec.begin(); it != enums_.vec.end(); ++it) {
@@ -2667,6 +2853,41 @@ CheckedError Parser::ParseRoot(const char *source, const char **include_paths,
   return NoError();
 }
 
+CheckedError Parser::ParseJsonRoot() {
+  if (!root_struct_def_)
+    return Error("no root type set to parse json with");
+  if (builder_.GetSize()) {
+    return Error("cannot have more than one json object in a file");
+  }
+  uoffset_t toff;
+  ECHECK(ParseTable(*root_struct_def_, nullptr, &toff));
+  if (opts.size_prefixed) {
+    builder_.FinishSizePrefixed(Offset<Table>(toff), file_identifier_.length()
+                                                         ? file_identifier_.c_str()
+                                                         : nullptr);
+  } else {
+    builder_.Finish(Offset<Table>(toff), file_identifier_.length()
+                                             ? file_identifier_.c_str()
+                                             : nullptr);
+  }
+  // Check that JSON file doesn't contain more objects or IDL directives.
+  // Comments after JSON are allowed.
+  EXPECT(kTokenEof);
+  return NoError();
+}
+
+// Like DoParse(), but only accepts a JSON object, so it never changes the
+// schema (see JsonConverter).
+CheckedError Parser::DoParseJson(const char *source,
+                                 const char *source_filename, int line) {
+  field_stack_.clear();
+  builder_.Clear();
+  current_namespace_ = empty_namespace_;
+  ECHECK(StartParseFile(source, source_filename, line));
+  if (token_ != '{') return Error("expected a json object");
+  return ParseJsonRoot();
+}
+
 CheckedError Parser::DoParse(const char *source, const char **include_paths,
                              const char *source_filename,
                              const char *include_filename) {
@@ -2756,25 +2977,7 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
     } else if (IsIdent("namespace")) {
       ECHECK(ParseNamespace());
     } else if (token_ == '{') {
-      if (!root_struct_def_)
-        return Error("no root type set to parse json with");
-      if (builder_.GetSize()) {
-        return Error("cannot have more than one json object in a file");
-      }
-      uoffset_t toff;
-      ECHECK(ParseTable(*root_struct_def_, nullptr, &toff));
-      if (opts.size_prefixed) {
-        builder_.FinishSizePrefixed(Offset<Table>(toff), file_identifier_.length()
-                                                             ? file_identifier_.c_str()
-                                                             : nullptr);
-      } else {
-        builder_.Finish(Offset<Table>(toff), file_identifier_.length()
-                                                 ? file_identifier_.c_str()
-                                                 : nullptr);
-      }
-      // Check that JSON file doesn't contain more objects or IDL directives.
-      // Comments after JSON are allowed.
-      EXPECT(kTokenEof);
+      ECHECK(ParseJsonRoot());
     } else if (IsIdent("enum")) {
       ECHECK(ParseEnum(false, nullptr));
     } else if (IsIdent("union")) {
@@ -2986,9 +3189,37 @@ bool StructDef::Deserialize(Parser &parser, const reflection::Object *object) {
     }
   }
   FLATBUFFERS_ASSERT(static_cast<int>(bytesize) == object->bytesize());
+  BuildFieldLookup();
   return true;
 }
 
+FieldDef *StructDef::LookupField(const std::string &field_name) const {
+  if (field_lookup_count != fields.vec.size() || field_lookup.empty())
+    return fields.Lookup(field_name);
+  auto mask = field_lookup.size() - 1;
+  for (auto i = HashFnv1a<uint32_t>(field_name.c_str()) & mask;;
+       i = (i + 1) & mask) {
+    auto field = field_lookup[i];
+    if (!field || field->name == field_name) return field;
+  }
+}
+
+void StructDef::BuildFieldLookup() {
+  // Keep the table at most half full, so probe sequences stay short.
+  size_t size = 1;
+  while (size < fields.vec.size() * 2) size *= 2;
+  field_lookup.assign(size, nullptr);
+  auto mask = size - 1;
+  for (auto it = fields.vec.begin(); it != fields.vec.end(); ++it) {
+    auto i = HashFnv1a<uint32_t>((*it)->name.c_str()) & mask;
+    // Only the first of duplicate names can be found, like in fields.dict.
+    while (field_lookup[i] && field_lookup[i]->name != (*it)->name)
+      i = (i + 1) & mask;
+    if (!field_lookup[i]) field_lookup[i] = *it;
+  }
+  field_lookup_count = fields.vec.size();
+}
+
 Offset<reflection::Field> FieldDef::Serialize(FlatBufferBuilder *builder,
                                               uint16_t id,
                                               const Parser &parser) const {
@@ -157,52 +157,61 @@ void SetAnyValueS(reflection::BaseType type, uint8_t *data, const char *val) {
 }
 
 // Resize a FlatBuffer in-place by iterating through all offsets in the buffer
-// and adjusting them by "delta" if they straddle the start offset.
-// Once that is done, bytes can now be inserted/deleted safely.
-// "delta" may be negative (shrinking).
-// Unless "delta" is a multiple of the largest alignment, you'll create a small
-// amount of garbage space in the buffer (usually 0..7 bytes).
+// and adjusting them by the deltas of the insertion points they straddle.
+// Once that is done, bytes are inserted/deleted at all points at once.
+// Deltas may be negative (shrinking), and must be multiples of the largest
+// alignment (see ResizeBatch::AlignDelta).
 // If your FlatBuffer's root table is not the schema's root table, you should
 // pass in your root_table type as well.
 class ResizeContext {
  public:
-  ResizeContext(const reflection::Schema &schema, uoffset_t start, int delta,
+  ResizeContext(const reflection::Schema &schema,
+                const std::vector<ResizeBatch::Resize> &resizes,
                 std::vector<uint8_t> *flatbuf,
                 const reflection::Object *root_table = nullptr)
       : schema_(schema),
-        startptr_(vector_data(*flatbuf) + start),
-        delta_(delta),
         buf_(*flatbuf),
         dag_check_(flatbuf->size() / sizeof(uoffset_t), false) {
-    auto mask = static_cast<int>(sizeof(largest_scalar_t) - 1);
-    delta_ = (delta_ + mask) & ~mask;
-    if (!delta_) return;  // We can't shrink by less than largest_scalar_t.
-    // Now change all the offsets by delta_.
+    // Running totals of the deltas, so Shift() can binary search them.
+    int total = 0;
+    for (auto it = resizes.begin(); it != resizes.end(); ++it) {
+      if (!it->delta) continue;
+      total += it->delta;
+      starts_.push_back(it->start);
+      shifts_.push_back(total);
+    }
+    if (starts_.empty()) return;
+    // Now change all the offsets.
     auto root = GetAnyRoot(vector_data(buf_));
-    Straddle<uoffset_t, 1>(vector_data(buf_), root, vector_data(buf_));
+    Straddle<uoffset_t, 1>(vector_data(buf_), root);
     ResizeTable(root_table ? *root_table : *schema.root_table(), root);
-    // We can now add or remove bytes at start.
-    if (delta_ > 0)
-      buf_.insert(buf_.begin() + start, delta_, 0);
-    else
-      buf_.erase(buf_.begin() + start, buf_.begin() + start - delta_);
+    // We can now add or remove bytes at all the insertion points.
+    MoveBytes(resizes, total);
+  }
+
+  // How far the byte at offsetloc moves, i.e. the sum of the deltas of the
+  // insertion points at or before it.
+  int Shift(const void *offsetloc) const {
+    auto pos = static_cast<uoffset_t>(
+        reinterpret_cast<const uint8_t *>(offsetloc) - vector_data(buf_));
+    auto it = std::upper_bound(starts_.begin(), starts_.end(), pos);
+    return it == starts_.begin() ? 0 : shifts_[it - starts_.begin() - 1];
   }
 
-  // Check if the range between first (lower address) and second straddles
-  // the insertion point. If it does, change the offset at offsetloc (of
-  // type T, with direction D).
+  // Adjust the offset at offsetloc (of type T, pointing forwards to target
+  // with D == 1, or backwards with D == -1) by the bytes inserted or removed
+  // between the two.
   template<typename T, int D>
-  void Straddle(const void *first, const void *second, void *offsetloc) {
-    if (first <= startptr_ && second >= startptr_) {
-      WriteScalar<T>(offsetloc, ReadScalar<T>(offsetloc) + delta_ * D);
-      DagCheck(offsetloc) = true;
-    }
+  void Straddle(void *offsetloc, const void *target) {
+    auto delta = (Shift(target) - Shift(offsetloc)) * D;
+    if (delta) WriteScalar<T>(offsetloc, ReadScalar<T>(offsetloc) + delta);
+    DagCheck(offsetloc) = true;
   }
 
   // This returns a boolean that records if the corresponding offset location
-  // has been modified already. If so, we can't even read the corresponding
-  // offset, since it is pointing to a location that is illegal until the
-  // resize actually happens.
+  // has been visited already. If so, we can't even read the corresponding
+  // offset, since it may have been changed to point to a location that is
+  // illegal until the resize actually happens.
   // This must be checked for every offset, since we can't know which offsets
   // will straddle and which won't.
   uint8_t &DagCheck(const void *offsetloc) {
@@ -215,13 +224,13 @@ class ResizeContext {
     if (DagCheck(table)) return;  // Table already visited.
     auto vtable = table->GetVTable();
     // Early out: since all fields inside the table must point forwards in
-    // memory, if the insertion point is before the table we can stop here.
+    // memory, if all insertion points are before the table we can stop here.
     auto tableloc = reinterpret_cast<uint8_t *>(table);
-    if (startptr_ <= tableloc) {
-      // Check if insertion point is between the table and a vtable that
-      // precedes it. This can't happen in current construction code, but check
-      // just in case we ever change the way flatbuffers are built.
-      Straddle<soffset_t, -1>(vtable, table, table);
+    if (vector_data(buf_) + starts_.back() <= tableloc) {
+      // Check if an insertion point is between the table and a vtable that
+      // precedes it. This can't happen in current construction code, but
+      // check just in case we ever change the way flatbuffers are built.
+      Straddle<soffset_t, -1>(table, vtable);
     } else {
       // Check each field.
       auto fielddefs = objectdef.fields();
@@ -243,7 +252,7 @@ class ResizeContext {
         auto offsetloc = tableloc + offset;
         if (DagCheck(offsetloc)) continue;  // This offset already visited.
         auto ref = offsetloc + ReadScalar<uoffset_t>(offsetloc);
-        Straddle<uoffset_t, 1>(offsetloc, ref, offsetloc);
+        Straddle<uoffset_t, 1>(offsetloc, ref);
         // Recurse.
         switch (base_type) {
           case reflection::Obj: {
@@ -264,7 +273,7 @@ class ResizeContext {
               auto loc = vec->Data() + i * sizeof(uoffset_t);
               if (DagCheck(loc)) continue;  // This offset already visited.
               auto dest = loc + vec->Get(i);
-              Straddle<uoffset_t, 1>(loc, dest, loc);
+              Straddle<uoffset_t, 1>(loc, dest);
               if (elemobjectdef)
                 ResizeTable(*elemobjectdef, reinterpret_cast<Table *>(dest));
             }
@@ -279,67 +288,166 @@ class ResizeContext {
           default: FLATBUFFERS_ASSERT(false);
         }
       }
-      // Check if the vtable offset points beyond the insertion point.
-      // Must do this last, since GetOptionalFieldOffset above still reads
-      // this value.
-      Straddle<soffset_t, -1>(table, vtable, table);
+      // Check if the vtable offset needs adjusting. Must do this last, since
+      // GetOptionalFieldOffset above still reads this value.
+      Straddle<soffset_t, -1>(table, vtable);
     }
   }
 
+  // Moves every run of bytes between two insertion points to its new place,
+  // with a single memmove each. Runs moving down are moved first, front to
+  // back, then runs moving up, back to front, so no run overwrites another
+  // one that hasn't been moved yet.
+  void MoveBytes(const std::vector<ResizeBatch::Resize> &resizes, int total) {
+    auto old_size = buf_.size();
+    if (total > 0) buf_.resize(old_size + total, 0);
+    struct Run {
+      size_t begin, end;
+      int shift;
+    };
+    std::vector<Run> runs;
+    Run run = { 0, 0, 0 };
+    for (auto it = resizes.begin(); it != resizes.end(); ++it) {
+      if (!it->delta) continue;
+      run.end = it->start;
+      runs.push_back(run);
+      run.begin = it->start + (it->delta < 0 ? -it->delta : 0);
+      run.shift += it->delta;
+    }
+    run.end = old_size;
+    runs.push_back(run);
+    auto data = vector_data(buf_);
+    for (auto it = runs.begin(); it != runs.end(); ++it) {
+      if (it->shift < 0)
+        memmove(data + it->begin + it->shift, data + it->begin,
+                it->end - it->begin);
+    }
+    for (auto it = runs.rbegin(); it != runs.rend(); ++it) {
+      if (it->shift > 0)
+        memmove(data + it->begin + it->shift, data + it->begin,
+                it->end - it->begin);
+    }
+    // Clear the inserted bytes, which still hold whatever was moved away.
+    auto shift = 0;
+    for (auto it = resizes.begin(); it != resizes.end(); ++it) {
+      if (it->delta > 0) memset(data + it->start + shift, 0, it->delta);
+      shift += it->delta;
+    }
+    if (total < 0) buf_.resize(old_size + total);
+  }
+
   void operator=(const ResizeContext &rc);
 
  private:
   const reflection::Schema &schema_;
-  uint8_t *startptr_;
-  int delta_;
   std::vector<uint8_t> &buf_;
   std::vector<uint8_t> dag_check_;
+  std::vector<uoffset_t> starts_;
+  std::vector<int> shifts_;
 };
 
+int ResizeBatch::AlignDelta(int delta) {
+  // We can't shrink by less than largest_scalar_t, and grow by a multiple of
+  // it so everything after the insertion point stays aligned.
+  auto mask = static_cast<int>(sizeof(largest_scalar_t) - 1);
+  return (delta + mask) & ~mask;
+}
+
+void ResizeBatch::SetString(const std::string &val, const String *str) {
+  Resize resize;
+  resize.len_loc = static_cast<uoffset_t>(
+      reinterpret_cast<const uint8_t *>(str) - vector_data(*flatbuf_));
+  resize.new_len = static_cast<uoffset_t>(val.size());
+  // Bytes are inserted or removed at the start of the string data.
+  resize.start = resize.len_loc + static_cast<uoffset_t>(sizeof(uoffset_t));
+  resize.delta =
+      AlignDelta(static_cast<int>(val.size()) - static_cast<int>(str->size()));
+  // Clear the old string, since we don't want parts of it remaining.
+  resize.clear_begin = resize.start;
+  resize.clear_end = resize.start + str->size();
+  resize.data.assign(val.c_str(), val.c_str() + val.size() + 1);
+  resizes_.push_back(resize);
+}
+
+void ResizeBatch::ResizeAnyVector(uoffset_t newsize, const VectorOfAny *vec,
+                                  uoffset_t num_elems, uoffset_t elem_size,
+                                  const uint8_t *elem) {
+  if (newsize == num_elems) return;
+  Resize resize;
+  resize.len_loc = static_cast<uoffset_t>(
+      reinterpret_cast<const uint8_t *>(vec) - vector_data(*flatbuf_));
+  resize.new_len = newsize;
+  auto end = resize.len_loc + static_cast<uoffset_t>(sizeof(uoffset_t)) +
+             elem_size * num_elems;
+  resize.delta = AlignDelta((static_cast<int>(newsize) -
+                             static_cast<int>(num_elems)) *
+                            static_cast<int>(elem_size));
+  if (newsize > num_elems) {
+    // Bytes are inserted at the end of the vector, and the new elements are
+    // written there.
+    resize.start = end;
+    resize.clear_begin = resize.clear_end = end;
+    if (elem) {
+      for (auto i = num_elems; i < newsize; i++)
+        resize.data.insert(resize.data.end(), elem, elem + elem_size);
+    }
+  } else {
+    // Bytes are removed from the end of the elements we're throwing away,
+    // which we clear, since some might remain in the buffer.
+    resize.start = static_cast<uoffset_t>(static_cast<int>(end) + resize.delta);
+    resize.clear_begin = resize.len_loc +
+                         static_cast<uoffset_t>(sizeof(uoffset_t)) +
+                         elem_size * newsize;
+    resize.clear_end = end;
+  }
+  resizes_.push_back(resize);
+}
+
+void ResizeBatch::Apply() {
+  std::sort(resizes_.begin(), resizes_.end(),
+            [](const Resize &a, const Resize &b) { return a.start < b.start; });
+  for (size_t i = 1; i < resizes_.size(); i++) {
+    // If this hits, you're resizing the same string or vector twice.
+    FLATBUFFERS_ASSERT(resizes_[i - 1].start < resizes_[i].start);
+  }
+  auto data = vector_data(*flatbuf_);
+  for (auto it = resizes_.begin(); it != resizes_.end(); ++it) {
+    memset(data + it->clear_begin, 0, it->clear_end - it->clear_begin);
+  }
+  ResizeContext(schema_, resizes_, flatbuf_, root_table_);
+  // Set the new lengths and data, at their moved locations.
+  data = vector_data(*flatbuf_);
+  auto shift = 0;
+  for (auto it = resizes_.begin(); it != resizes_.end(); ++it) {
+    WriteScalar(data + it->len_loc + shift, it->new_len);
+    if (!it->data.empty()) {
+      memcpy(data + it->start + shift, vector_data(it->data), it->data.size());
+    }
+    shift += it->delta;
+  }
+  resizes_.clear();
+}
+
 void SetString(const reflection::Schema &schema, const std::string &val,
                const String *str, std::vector<uint8_t> *flatbuf,
                const reflection::Object *root_table) {
-  auto delta = static_cast<int>(val.size()) - static_cast<int>(str->size());
-  auto str_start = static_cast<uoffset_t>(
-      reinterpret_cast<const uint8_t *>(str) - vector_data(*flatbuf));
-  auto start = str_start + static_cast<uoffset_t>(sizeof(uoffset_t));
-  if (delta) {
-    // Clear the old string, since we don't want parts of it remaining.
-    memset(vector_data(*flatbuf) + start, 0, str->size());
-    // Different size, we must expand (or contract).
-    ResizeContext(schema, start, delta, flatbuf, root_table);
-    // Set the new length.
-    WriteScalar(vector_data(*flatbuf) + str_start,
-                static_cast<uoffset_t>(val.size()));
-  }
-  // Copy new data. Safe because we created the right amount of space.
-  memcpy(vector_data(*flatbuf) + start, val.c_str(), val.size() + 1);
+  ResizeBatch batch(schema, flatbuf, root_table);
+  batch.SetString(val, str);
+  batch.Apply();
 }
 
 uint8_t *ResizeAnyVector(const reflection::Schema &schema, uoffset_t newsize,
                          const VectorOfAny *vec, uoffset_t num_elems,
                          uoffset_t elem_size, std::vector<uint8_t> *flatbuf,
                          const reflection::Object *root_table) {
-  auto delta_elem = static_cast<int>(newsize) - static_cast<int>(num_elems);
-  auto delta_bytes = delta_elem * static_cast<int>(elem_size);
-  auto vec_start =
-      reinterpret_cast<const uint8_t *>(vec) - vector_data(*flatbuf);
-  auto start = static_cast<uoffset_t>(vec_start + sizeof(uoffset_t) +
-                                      elem_size * num_elems);
-  if (delta_bytes) {
-    if (delta_elem < 0) {
-      // Clear elements we're throwing away, since some might remain in the
-      // buffer.
-      auto size_clear = -delta_elem * elem_size;
-      memset(vector_data(*flatbuf) + start - size_clear, 0, size_clear);
-    }
-    ResizeContext(schema, start, delta_bytes, flatbuf, root_table);
-    WriteScalar(vector_data(*flatbuf) + vec_start, newsize);  // Length field.
-    // Set new elements to 0.. this can be overwritten by the caller.
-    if (delta_elem > 0) {
-      memset(vector_data(*flatbuf) + start, 0, delta_elem * elem_size);
-    }
-  }
+  auto start = static_cast<uoffset_t>(
+      reinterpret_cast<const uint8_t *>(vec) - vector_data(*flatbuf) +
+      sizeof(uoffset_t) + elem_size * num_elems);
+  ResizeBatch batch(schema, flatbuf, root_table);
+  batch.ResizeAnyVector(newsize, vec, num_elems, elem_size);
+  batch.Apply();
+  // Only bytes after the old elements moved, so this is where new elements
+  // start (if any).
   return vector_data(*flatbuf) + start;
 }
 
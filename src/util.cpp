@@ -28,7 +28,10 @@
 #  include <winbase.h>
 #  undef interface  // This is also important because of reasons
 #else
+#  include <fcntl.h>
 #  include <limits.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
 #endif
 // clang-format on
 
@@ -50,24 +53,99 @@ bool LoadFileRaw(const char *name, bool binary, std::string *buf) {
   if (DirExists(name)) return false;
   std::ifstream ifs(name, binary ? std::ifstream::binary : std::ifstream::in);
   if (!ifs.is_open()) return false;
-  if (binary) {
-    // The fastest way to read a file into a string.
-    ifs.seekg(0, std::ios::end);
-    auto size = ifs.tellg();
-    (*buf).resize(static_cast<size_t>(size));
-    ifs.seekg(0, std::ios::beg);
-    ifs.read(&(*buf)[0], (*buf).size());
-  } else {
-    // This is slower, but works correctly on all platforms for text files.
-    std::ostringstream oss;
-    oss << ifs.rdbuf();
-    *buf = oss.str();
+  // The fastest way to read a file into a string. In text mode, line endings
+  // may be translated, so fewer characters than the file size can be read.
+  ifs.seekg(0, std::ios::end);
+  auto size = ifs.tellg();
+  if (size < 0) return false;
+  (*buf).resize(static_cast<size_t>(size));
+  ifs.seekg(0, std::ios::beg);
+  ifs.read(&(*buf)[0], (*buf).size());
+  if (ifs.bad()) return false;
+  (*buf).resize(static_cast<size_t>(ifs.gcount()));
+  return true;
+}
+
+void MappedFile::Reset() {
+  // clang-format off
+  if (mapped_) {
+    #ifdef _WIN32
+      UnmapViewOfFile(data_);
+    #else
+      munmap(const_cast<uint8_t *>(data_), size_);
+    #endif
   }
-  return !ifs.bad();
+  // clang-format on
+  data_ = nullptr;
+  size_ = 0;
+  mapped_ = false;
+  std::string().swap(contents_);
+}
+
+bool MapFileRaw(const char *name, MappedFile *file) {
+  file->Reset();
+  void *data = nullptr;
+  size_t size = 0;
+  // clang-format off
+  #ifdef _WIN32
+    auto handle = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle != INVALID_HANDLE_VALUE) {
+      LARGE_INTEGER file_size;
+      if (GetFileSizeEx(handle, &file_size) && file_size.QuadPart > 0 &&
+          static_cast<uint64_t>(file_size.QuadPart) <=
+              std::numeric_limits<size_t>::max()) {
+        auto mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0,
+                                          nullptr);
+        if (mapping) {
+          data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+          size = static_cast<size_t>(file_size.QuadPart);
+          // The view keeps the mapping alive.
+          CloseHandle(mapping);
+        }
+      }
+      CloseHandle(handle);
+    }
+  #else
+    auto fd = open(name, O_RDONLY);
+    if (fd >= 0) {
+      struct stat file_info;
+      if (fstat(fd, &file_info) == 0 && S_ISREG(file_info.st_mode) &&
+          file_info.st_size > 0 &&
+          static_cast<uint64_t>(file_info.st_size) <=
+              std::numeric_limits<size_t>::max()) {
+        size = static_cast<size_t>(file_info.st_size);
+        data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) data = nullptr;
+      }
+      // The mapping stays valid after closing the file.
+      close(fd);
+    }
+  #endif
+  // clang-format on
+  if (data) {
+    file->data_ = static_cast<const uint8_t *>(data);
+    file->size_ = size;
+    file->mapped_ = true;
+    return true;
+  }
+  std::string contents;
+  if (!LoadFileRaw(name, true, &contents)) return false;
+  file->Assign(&contents);
+  return true;
+}
+
+bool SaveFileRaw(const char *name, const char *buf, size_t len, bool binary) {
+  std::ofstream ofs(name, binary ? std::ofstream::binary : std::ofstream::out);
+  if (!ofs.is_open()) return false;
+  ofs.write(buf, len);
+  return !ofs.bad();
 }
 
 static LoadFileFunction g_load_file_function = LoadFileRaw;
 static FileExistsFunction g_file_exists_function = FileExistsRaw;
+static SaveFileFunction g_save_file_function = SaveFileRaw;
+static MapFileFunction g_map_file_function = MapFileRaw;
 
 bool LoadFile(const char *name, bool binary, std::string *buf) {
   FLATBUFFERS_ASSERT(g_load_file_function);
@@ -109,11 +187,30 @@ FileExistsFunction SetFileExistsFunction(
   return previous_function;
 }
 
+MapFileFunction SetMapFileFunction(MapFileFunction map_file_function) {
+  MapFileFunction previous_function = g_map_file_function;
+  g_map_file_function = map_file_function ? map_file_function : MapFileRaw;
+  return previous_function;
+}
+
+bool MapFile(const char *name, MappedFile *file) {
+  FLATBUFFERS_ASSERT(g_map_file_function);
+  return g_map_file_function(name, file);
+}
+
+SaveFileFunction SetSaveFileFunction(SaveFileFunction save_file_function) {
+  SaveFileFunction previous_function = g_save_file_function;
+  g_save_file_function = save_file_function ? save_file_function : SaveFileRaw;
+  return previous_function;
+}
+
+bool HasCustomSaveFileFunction() {
+  return g_save_file_function != SaveFileRaw;
+}
+
 bool SaveFile(const char *name, const char *buf, size_t len, bool binary) {
-  std::ofstream ofs(name, binary ? std::ofstream::binary : std::ofstream::out);
-  if (!ofs.is_open()) return false;
-  ofs.write(buf, len);
-  return !ofs.bad();
+  FLATBUFFERS_ASSERT(g_save_file_function);
+  return g_save_file_function(name, buf, len, binary);
 }
 
 // We internally store paths in posix format ('/'). Paths supplied
@@ -221,6 +318,246 @@ ClassicLocale ClassicLocale::instance_;
 
 #endif  // !FLATBUFFERS_LOCALE_INDEPENDENT
 
+namespace {
+
+// Shortest float to string conversion, using the Grisu2 algorithm from
+// "Printing Floating-Point Numbers Quickly and Accurately with Integers"
+// (Florian Loitsch, 2010). Its output always converts back to the same value,
+// and is the shortest such string in over 99.9% of cases.
+
+// A number f * 2^e with a 64-bit significand.
+struct DiyFp {
+  DiyFp(uint64_t _f, int _e) : f(_f), e(_e) {}
+
+  DiyFp operator-(const DiyFp &o) const { return DiyFp(f - o.f, e); }
+
+  // Multiplies the significands, keeping the (rounded) upper 64 bits.
+  DiyFp operator*(const DiyFp &o) const {
+    const uint64_t m32 = 0xFFFFFFFF;
+    const uint64_t a = f >> 32, b = f & m32, c = o.f >> 32, d = o.f & m32;
+    const uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    uint64_t tmp = (bd >> 32) + (ad & m32) + (bc & m32);
+    tmp += 1U << 31;  // Round.
+    return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), e + o.e + 64);
+  }
+
+  DiyFp Normalize() const {
+    DiyFp r = *this;
+    while (!(r.f & (1ULL << 63))) {
+      r.f <<= 1;
+      r.e--;
+    }
+    return r;
+  }
+
+  uint64_t f;
+  int e;
+};
+
+// Returns the cached power of ten 10^-K such that multiplying by it brings a
+// number with binary exponent e into the range needed by DigitGen.
+DiyFp CachedPower(int e, int *K) {
+  // 10^-348, 10^-340, ..., 10^340, normalized.
+  static const uint64_t kCachedPowersF[] = {
+    0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+    0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+    0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+    0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+    0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+    0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+    0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+    0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+    0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+    0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+    0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+    0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+    0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+    0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+    0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+    0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+    0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+    0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+    0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+    0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+    0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+    0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+    0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+    0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+    0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+    0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+    0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+    0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+    0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+  };
+  static const int16_t kCachedPowersE[] = {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954,
+    -927, -901, -874, -847, -821, -794, -768, -741, -715, -688, -661, -635,
+    -608, -582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316,
+    -289, -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30, 56,
+    83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348, 375, 402, 428, 455,
+    481, 508, 534, 561, 588, 614, 641, 667, 694, 720, 747, 774, 800, 827, 853,
+    880, 907, 933, 960, 986, 1013, 1039, 1066
+  };
+  auto dk = (-61 - e) * 0.30102999566398114 + 347;  // dk must be positive.
+  auto k = static_cast<int>(dk);
+  if (dk - k > 0.0) k++;
+  auto index = static_cast<size_t>((k >> 3) + 1);
+  *K = -(-348 + static_cast<int>(index << 3));
+  return DiyFp(kCachedPowersF[index], kCachedPowersE[index]);
+}
+
+void GrisuRound(char *buffer, int len, uint64_t delta, uint64_t rest,
+                uint64_t ten_kappa, uint64_t wp_w) {
+  while (rest < wp_w && delta - rest >= ten_kappa &&
+         (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w)) {
+    buffer[len - 1]--;
+    rest += ten_kappa;
+  }
+}
+
+// Generates the shortest digits of W that lie within delta below Mp.
+void DigitGen(const DiyFp &W, const DiyFp &Mp, uint64_t delta, char *buffer,
+              int *len, int *K) {
+  static const uint64_t kPow10[] = {
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+    10000000000000000ULL,
+    100000000000000000ULL,
+    1000000000000000000ULL,
+    10000000000000000000ULL
+  };
+  const DiyFp one(1ULL << -Mp.e, Mp.e);
+  const DiyFp wp_w = Mp - W;
+  auto p1 = static_cast<uint32_t>(Mp.f >> -one.e);
+  auto p2 = Mp.f & (one.f - 1);
+  int kappa = 1;
+  while (kappa < 10 && p1 >= kPow10[kappa]) kappa++;
+  *len = 0;
+  while (kappa > 0) {
+    auto div = static_cast<uint32_t>(kPow10[kappa - 1]);
+    auto d = p1 / div;
+    p1 %= div;
+    if (d || *len) buffer[(*len)++] = static_cast<char>('0' + d);
+    kappa--;
+    auto tmp = (static_cast<uint64_t>(p1) << -one.e) + p2;
+    if (tmp <= delta) {
+      *K += kappa;
+      GrisuRound(buffer, *len, delta, tmp, kPow10[kappa] << -one.e, wp_w.f);
+      return;
+    }
+  }
+  for (;;) {
+    p2 *= 10;
+    delta *= 10;
+    auto d = static_cast<char>(p2 >> -one.e);
+    if (d || *len) buffer[(*len)++] = static_cast<char>('0' + d);
+    p2 &= one.f - 1;
+    kappa--;
+    if (p2 < delta) {
+      *K += kappa;
+      auto index = -kappa;
+      GrisuRound(buffer, *len, delta, p2, one.f,
+                 wp_w.f * (index < 20 ? kPow10[index] : 0));
+      return;
+    }
+  }
+}
+
+// Formats the absolute value v of a float or double, given the hidden bit of
+// its type, with the shortest digits that convert back to it.
+std::string ShortestString(const DiyFp &v, uint64_t hidden_bit,
+                           bool negative) {
+  // The boundaries halfway to the neighbouring values: any number in between
+  // converts back to v.
+  auto m_plus = DiyFp((v.f << 1) + 1, v.e - 1).Normalize();
+  auto m_minus = v.f == hidden_bit ? DiyFp((v.f << 2) - 1, v.e - 2)
+                                   : DiyFp((v.f << 1) - 1, v.e - 1);
+  m_minus.f <<= m_minus.e - m_plus.e;
+  m_minus.e = m_plus.e;
+  int K;
+  auto c_mk = CachedPower(m_plus.e, &K);
+  auto W = v.Normalize() * c_mk;
+  auto Wp = m_plus * c_mk;
+  auto Wm = m_minus * c_mk;
+  Wm.f++;
+  Wp.f--;
+  char digits[20];
+  int len;
+  DigitGen(W, Wp, Wp.f - Wm.f, digits, &len, &K);
+  // The value is 0.digits * 10^kk.
+  auto kk = len + K;
+  std::string s;
+  if (negative) s += '-';
+  if (kk > 0 && kk <= 21) {
+    if (len <= kk) {
+      s.append(digits, len);
+      s.append(kk - len, '0');
+      s += ".0";
+    } else {
+      s.append(digits, kk);
+      s += '.';
+      s.append(digits + kk, len - kk);
+    }
+  } else if (kk > -6 && kk <= 0) {
+    s += "0.";
+    s.append(-kk, '0');
+    s.append(digits, len);
+  } else {
+    s += digits[0];
+    if (len > 1) {
+      s += '.';
+      s.append(digits + 1, len - 1);
+    }
+    s += 'e';
+    s += NumToString(kk - 1);
+  }
+  return s;
+}
+
+}  // namespace
+
+std::string FloatToShortestString(double d) {
+  uint64_t u;
+  memcpy(&u, &d, sizeof(u));
+  auto negative = (u >> 63) != 0;
+  auto biased_e = static_cast<int>((u >> 52) & 0x7FF);
+  auto f = u & ((1ULL << 52) - 1);
+  if (biased_e == 0x7FF) return FloatToString(d, 12);  // NaN or inf.
+  if (!biased_e && !f) return negative ? "-0.0" : "0.0";
+  const auto hidden_bit = 1ULL << 52;
+  return biased_e ? ShortestString(DiyFp(f | hidden_bit, biased_e - 1075),
+                                   hidden_bit, negative)
+                  : ShortestString(DiyFp(f, -1074), hidden_bit, negative);
+}
+
+std::string FloatToShortestString(float fl) {
+  uint32_t u;
+  memcpy(&u, &fl, sizeof(u));
+  auto negative = (u >> 31) != 0;
+  auto biased_e = static_cast<int>((u >> 23) & 0xFF);
+  auto f = static_cast<uint64_t>(u & ((1U << 23) - 1));
+  if (biased_e == 0xFF) return FloatToString(fl, 6);  // NaN or inf.
+  if (!biased_e && !f) return negative ? "-0.0" : "0.0";
+  const auto hidden_bit = 1ULL << 23;
+  return biased_e ? ShortestString(DiyFp(f | hidden_bit, biased_e - 150),
+                                   hidden_bit, negative)
+                  : ShortestString(DiyFp(f, -149), hidden_bit, negative);
+}
+
 std::string RemoveStringQuotes(const std::string &s) {
   auto ch = *s.c_str();
   return ((s.size() >= 2) && (ch == '\"' || ch == '\'') &&
@@ -0,0 +1,46 @@
+#!/bin/bash -eu
+#
+# Copyright 2019 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Checks that flatc --incremental compiles again when any of its outputs was
+# deleted, including the JSON written with -t.
+# Usage: FlatcIncrementalTest.sh [absolute/path/to/flatc]
+
+pushd "$(dirname $0)" >/dev/null
+test_dir="$(pwd)"
+flatc="${1:-${test_dir}/../flatc}"
+out_dir="$(mktemp -d)"
+trap "rm -rf ${out_dir}" EXIT
+
+function run_flatc() {
+  "${flatc}" --incremental "${out_dir}/manifest" -c -t -o "${out_dir}/" \
+    -I include_test monster_test.fbs monsterdata_test.golden 2>/dev/null
+}
+
+outputs="monster_test_generated.h monsterdata_test.json"
+run_flatc
+for output in ${outputs}; do
+  test -f "${out_dir}/${output}"
+done
+for output in ${outputs}; do
+  rm "${out_dir}/${output}"
+  run_flatc
+  if [ ! -f "${out_dir}/${output}" ]; then
+    echo "flatc --incremental didn't write ${output} again"
+    exit 1
+  fi
+done
+
+echo "flatc --incremental test passed"
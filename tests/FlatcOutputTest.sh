@@ -0,0 +1,52 @@
+#!/bin/bash -eu
+#
+# Copyright 2019 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Checks the files flatc writes when converting between JSON and binary.
+# Usage: FlatcOutputTest.sh [absolute/path/to/flatc]
+
+pushd "$(dirname $0)" >/dev/null
+test_dir="$(pwd)"
+flatc="${1:-${test_dir}/../flatc}"
+out_dir="$(mktemp -d)"
+trap "rm -rf ${out_dir}" EXIT
+
+function fail() {
+  echo "$1"
+  exit 1
+}
+
+# JSON is streamed to a temporary file, which then replaces any existing
+# output.
+"${flatc}" -b -o "${out_dir}/" -I include_test monster_test.fbs \
+  monsterdata_test.golden >/dev/null 2>&1
+echo "stale" > "${out_dir}/monsterdata_test.json"
+"${flatc}" -t -o "${out_dir}/" -I include_test monster_test.fbs \
+  -- "${out_dir}/monsterdata_test.mon" >/dev/null 2>&1
+cmp -s "${out_dir}/monsterdata_test.json" monsterdata_test.golden ||
+  fail "flatc -t didn't write the JSON it read"
+test ! -e "${out_dir}/monsterdata_test.json.tmp" ||
+  fail "flatc -t left its temporary file behind"
+
+# A binary input is mapped, so writing a binary of the same name must not
+# truncate it while it's being read.
+cp "${out_dir}/monsterdata_test.mon" "${out_dir}/expected.mon"
+"${flatc}" -b -o "${out_dir}/" -I include_test monster_test.fbs \
+  -- "${out_dir}/monsterdata_test.mon" >/dev/null 2>&1 ||
+  fail "flatc -b failed to write a binary over its input"
+cmp -s "${out_dir}/monsterdata_test.mon" "${out_dir}/expected.mon" ||
+  fail "flatc -b didn't write the binary it read"
+
+echo "flatc output test passed"
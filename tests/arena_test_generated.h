@@ -0,0 +1,1120 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_ARENATEST_MYGAME_ARENATEST_H_
+#define FLATBUFFERS_GENERATED_ARENATEST_MYGAME_ARENATEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/arena.h"
+
+namespace MyGame {
+namespace ArenaTest {
+
+struct Point;
+
+struct Leaf;
+struct LeafT;
+
+struct Node;
+struct NodeT;
+
+bool operator==(const Point &lhs, const Point &rhs);
+bool operator!=(const Point &lhs, const Point &rhs);
+bool operator==(const LeafT &lhs, const LeafT &rhs);
+bool operator!=(const LeafT &lhs, const LeafT &rhs);
+bool operator==(const NodeT &lhs, const NodeT &rhs);
+bool operator!=(const NodeT &lhs, const NodeT &rhs);
+
+inline const flatbuffers::TypeTable *PointTypeTable();
+
+inline const flatbuffers::TypeTable *LeafTypeTable();
+
+inline const flatbuffers::TypeTable *NodeTypeTable();
+
+enum Kind {
+  Kind_Small = 0,
+  Kind_Large = 1,
+  Kind_MIN = Kind_Small,
+  Kind_MAX = Kind_Large
+};
+
+inline const Kind (&EnumValuesKind())[2] {
+  static const Kind values[] = {
+    Kind_Small,
+    Kind_Large
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesKind() {
+  static const char * const names[] = {
+    "Small",
+    "Large",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameKind(Kind e) {
+  if (e < Kind_Small || e > Kind_Large) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesKind()[index];
+}
+
+enum Payload {
+  Payload_NONE = 0,
+  Payload_Leaf = 1,
+  Payload_Node = 2,
+  Payload_Label = 3,
+  Payload_MIN = Payload_NONE,
+  Payload_MAX = Payload_Label
+};
+
+inline const Payload (&EnumValuesPayload())[4] {
+  static const Payload values[] = {
+    Payload_NONE,
+    Payload_Leaf,
+    Payload_Node,
+    Payload_Label
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesPayload() {
+  static const char * const names[] = {
+    "NONE",
+    "Leaf",
+    "Node",
+    "Label",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNamePayload(Payload e) {
+  if (e < Payload_NONE || e > Payload_Label) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesPayload()[index];
+}
+
+template<typename T> struct PayloadTraits {
+  static const Payload enum_value = Payload_NONE;
+};
+
+template<> struct PayloadTraits<Leaf> {
+  static const Payload enum_value = Payload_Leaf;
+};
+
+template<> struct PayloadTraits<Node> {
+  static const Payload enum_value = Payload_Node;
+};
+
+template<> struct PayloadTraits<flatbuffers::String> {
+  static const Payload enum_value = Payload_Label;
+};
+
+struct PayloadUnion {
+  Payload type;
+  void *value;
+
+  PayloadUnion() : type(Payload_NONE), value(nullptr) {}
+  PayloadUnion(PayloadUnion&& u) FLATBUFFERS_NOEXCEPT :
+    type(Payload_NONE), value(nullptr)
+    { std::swap(type, u.type); std::swap(value, u.value); }
+  PayloadUnion(const PayloadUnion &) FLATBUFFERS_NOEXCEPT;
+  PayloadUnion &operator=(const PayloadUnion &u) FLATBUFFERS_NOEXCEPT
+    { PayloadUnion t(u); std::swap(type, t.type); std::swap(value, t.value); return *this; }
+  PayloadUnion &operator=(PayloadUnion &&u) FLATBUFFERS_NOEXCEPT
+    { std::swap(type, u.type); std::swap(value, u.value); return *this; }
+  ~PayloadUnion() { Reset(); }
+
+  void Reset();
+
+#ifndef FLATBUFFERS_CPP98_STL
+  template <typename T>
+  void Set(T&& val) {
+    using RT = typename std::remove_reference<T>::type;
+    Reset();
+    type = PayloadTraits<typename RT::TableType>::enum_value;
+    if (type != Payload_NONE) {
+      value = new RT(std::forward<T>(val));
+    }
+  }
+#endif  // FLATBUFFERS_CPP98_STL
+
+  static void *UnPack(const void *obj, Payload type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackFrom(const void *obj, Payload _type, const flatbuffers::resolver_function_t *resolver);
+  flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+
+  LeafT *AsLeaf() {
+    return type == Payload_Leaf ?
+      reinterpret_cast<LeafT *>(value) : nullptr;
+  }
+  const LeafT *AsLeaf() const {
+    return type == Payload_Leaf ?
+      reinterpret_cast<const LeafT *>(value) : nullptr;
+  }
+  NodeT *AsNode() {
+    return type == Payload_Node ?
+      reinterpret_cast<NodeT *>(value) : nullptr;
+  }
+  const NodeT *AsNode() const {
+    return type == Payload_Node ?
+      reinterpret_cast<const NodeT *>(value) : nullptr;
+  }
+  flatbuffers::ArenaUnionString *AsLabel() {
+    return type == Payload_Label ?
+      reinterpret_cast<flatbuffers::ArenaUnionString *>(value) : nullptr;
+  }
+  const flatbuffers::ArenaUnionString *AsLabel() const {
+    return type == Payload_Label ?
+      reinterpret_cast<const flatbuffers::ArenaUnionString *>(value) : nullptr;
+  }
+};
+
+
+inline bool operator==(const PayloadUnion &lhs, const PayloadUnion &rhs) {
+  if (lhs.type != rhs.type) return false;
+  switch (lhs.type) {
+    case Payload_NONE: {
+      return true;
+    }
+    case Payload_Leaf: {
+      return *(reinterpret_cast<const LeafT *>(lhs.value)) ==
+             *(reinterpret_cast<const LeafT *>(rhs.value));
+    }
+    case Payload_Node: {
+      return *(reinterpret_cast<const NodeT *>(lhs.value)) ==
+             *(reinterpret_cast<const NodeT *>(rhs.value));
+    }
+    case Payload_Label: {
+      return *(reinterpret_cast<const flatbuffers::ArenaUnionString *>(lhs.value)) ==
+             *(reinterpret_cast<const flatbuffers::ArenaUnionString *>(rhs.value));
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+inline bool operator!=(const PayloadUnion &lhs, const PayloadUnion &rhs) {
+    return !(lhs == rhs);
+}
+
+bool VerifyPayload(flatbuffers::Verifier &verifier, const void *obj, Payload type);
+bool VerifyPayloadVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Point FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+
+ public:
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return PointTypeTable();
+  }
+  Point() {
+    memset(static_cast<void *>(this), 0, sizeof(Point));
+  }
+  Point(float _x, float _y)
+      : x_(flatbuffers::EndianScalar(_x)),
+        y_(flatbuffers::EndianScalar(_y)) {
+  }
+  float x() const {
+    return flatbuffers::EndianScalar(x_);
+  }
+  void mutate_x(float _x) {
+    flatbuffers::WriteScalar(&x_, _x);
+  }
+  float y() const {
+    return flatbuffers::EndianScalar(y_);
+  }
+  void mutate_y(float _y) {
+    flatbuffers::WriteScalar(&y_, _y);
+  }
+  void *operator new(std::size_t count) {
+    return flatbuffers::Arena::New(count);
+  }
+  void operator delete(void *ptr) {
+    flatbuffers::Arena::Delete(ptr);
+  }
+};
+FLATBUFFERS_STRUCT_END(Point, 8);
+
+inline bool operator==(const Point &lhs, const Point &rhs) {
+  return
+      (lhs.x() == rhs.x()) &&
+      (lhs.y() == rhs.y());
+}
+
+inline bool operator!=(const Point &lhs, const Point &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct LeafT : public flatbuffers::NativeTable {
+  typedef Leaf TableType;
+  flatbuffers::arena_string name;
+  std::vector<int32_t, flatbuffers::ArenaAllocator<int32_t>> values;
+  void *operator new(std::size_t count) {
+    return flatbuffers::Arena::New(count);
+  }
+  void operator delete(void *ptr) {
+    flatbuffers::Arena::Delete(ptr);
+  }
+  LeafT() {
+  }
+};
+
+inline bool operator==(const LeafT &lhs, const LeafT &rhs) {
+  return
+      (lhs.name == rhs.name) &&
+      (lhs.values == rhs.values);
+}
+
+inline bool operator!=(const LeafT &lhs, const LeafT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Leaf FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LeafT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return LeafTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_VALUES = 6
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  const flatbuffers::Vector<int32_t> *values() const {
+    return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_VALUES);
+  }
+  flatbuffers::Vector<int32_t> *mutable_values() {
+    return GetPointer<flatbuffers::Vector<int32_t> *>(VT_VALUES);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_VALUES) &&
+           verifier.VerifyVector(values()) &&
+           verifier.EndTable();
+  }
+  LeafT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(LeafT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Leaf> Pack(flatbuffers::FlatBufferBuilder &_fbb, const LeafT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct LeafBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Leaf::VT_NAME, name);
+  }
+  void add_values(flatbuffers::Offset<flatbuffers::Vector<int32_t>> values) {
+    fbb_.AddOffset(Leaf::VT_VALUES, values);
+  }
+  explicit LeafBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LeafBuilder &operator=(const LeafBuilder &);
+  flatbuffers::Offset<Leaf> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Leaf>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Leaf> CreateLeaf(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> values = 0) {
+  if (name.o &&
+      values.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 8, 12, 4, 8 };
+    auto table_ = _fbb.StartFixedTable(12, 4);
+    _fbb.AddFixedOffset(table_, 4, name);
+    _fbb.AddFixedOffset(table_, 8, values);
+    return flatbuffers::Offset<Leaf>(_fbb.EndFixedTable(vtable_));
+  }
+  LeafBuilder builder_(_fbb);
+  builder_.add_values(values);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Leaf> CreateLeafDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const std::vector<int32_t> *values = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto values__ = values ? _fbb.CreateVector<int32_t>(*values) : 0;
+  return MyGame::ArenaTest::CreateLeaf(
+      _fbb,
+      name__,
+      values__);
+}
+
+flatbuffers::Offset<Leaf> CreateLeaf(flatbuffers::FlatBufferBuilder &_fbb, const LeafT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct NodeT : public flatbuffers::NativeTable {
+  typedef Node TableType;
+  flatbuffers::arena_string name;
+  Kind kind;
+  std::vector<flatbuffers::arena_string, flatbuffers::ArenaAllocator<flatbuffers::arena_string>> tags;
+  std::vector<bool, flatbuffers::ArenaAllocator<bool>> flags;
+  std::vector<Kind, flatbuffers::ArenaAllocator<Kind>> kinds;
+  flatbuffers::unique_ptr<Point> origin;
+  std::vector<Point, flatbuffers::ArenaAllocator<Point>> path;
+  flatbuffers::unique_ptr<LeafT> leaf;
+  std::vector<flatbuffers::unique_ptr<NodeT>, flatbuffers::ArenaAllocator<flatbuffers::unique_ptr<NodeT>>> children;
+  PayloadUnion payload;
+  std::vector<PayloadUnion, flatbuffers::ArenaAllocator<PayloadUnion>> payloads;
+  void *operator new(std::size_t count) {
+    return flatbuffers::Arena::New(count);
+  }
+  void operator delete(void *ptr) {
+    flatbuffers::Arena::Delete(ptr);
+  }
+  NodeT()
+      : kind(Kind_Small) {
+  }
+};
+
+inline bool operator==(const NodeT &lhs, const NodeT &rhs) {
+  return
+      (lhs.name == rhs.name) &&
+      (lhs.kind == rhs.kind) &&
+      (lhs.tags == rhs.tags) &&
+      (lhs.flags == rhs.flags) &&
+      (lhs.kinds == rhs.kinds) &&
+      (lhs.origin == rhs.origin) &&
+      (lhs.path == rhs.path) &&
+      (lhs.leaf == rhs.leaf) &&
+      (lhs.children == rhs.children) &&
+      (lhs.payload == rhs.payload) &&
+      (lhs.payloads == rhs.payloads);
+}
+
+inline bool operator!=(const NodeT &lhs, const NodeT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Node FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef NodeT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return NodeTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_KIND = 6,
+    VT_TAGS = 8,
+    VT_FLAGS = 10,
+    VT_KINDS = 12,
+    VT_ORIGIN = 14,
+    VT_PATH = 16,
+    VT_LEAF = 18,
+    VT_CHILDREN = 20,
+    VT_PAYLOAD_TYPE = 22,
+    VT_PAYLOAD = 24,
+    VT_PAYLOADS_TYPE = 26,
+    VT_PAYLOADS = 28
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  Kind kind() const {
+    return static_cast<Kind>(GetField<int8_t>(VT_KIND, 0));
+  }
+  bool mutate_kind(Kind _kind) {
+    return SetField<int8_t>(VT_KIND, static_cast<int8_t>(_kind), 0);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *tags() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_tags() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  const flatbuffers::Vector<uint8_t> *flags() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_FLAGS);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_flags() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_FLAGS);
+  }
+  const flatbuffers::Vector<int8_t> *kinds() const {
+    return GetPointer<const flatbuffers::Vector<int8_t> *>(VT_KINDS);
+  }
+  flatbuffers::Vector<int8_t> *mutable_kinds() {
+    return GetPointer<flatbuffers::Vector<int8_t> *>(VT_KINDS);
+  }
+  const Point *origin() const {
+    return GetStruct<const Point *>(VT_ORIGIN);
+  }
+  Point *mutable_origin() {
+    return GetStruct<Point *>(VT_ORIGIN);
+  }
+  const flatbuffers::Vector<const Point *> *path() const {
+    return GetPointer<const flatbuffers::Vector<const Point *> *>(VT_PATH);
+  }
+  flatbuffers::Vector<const Point *> *mutable_path() {
+    return GetPointer<flatbuffers::Vector<const Point *> *>(VT_PATH);
+  }
+  const Leaf *leaf() const {
+    return GetPointer<const Leaf *>(VT_LEAF);
+  }
+  Leaf *mutable_leaf() {
+    return GetPointer<Leaf *>(VT_LEAF);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Node>> *children() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Node>> *>(VT_CHILDREN);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Node>> *mutable_children() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Node>> *>(VT_CHILDREN);
+  }
+  Payload payload_type() const {
+    return static_cast<Payload>(GetField<uint8_t>(VT_PAYLOAD_TYPE, 0));
+  }
+  bool mutate_payload_type(Payload _payload_type) {
+    return SetField<uint8_t>(VT_PAYLOAD_TYPE, static_cast<uint8_t>(_payload_type), 0);
+  }
+  const void *payload() const {
+    return GetPointer<const void *>(VT_PAYLOAD);
+  }
+  template<typename T> const T *payload_as() const;
+  const Leaf *payload_as_Leaf() const {
+    return payload_type() == Payload_Leaf ? static_cast<const Leaf *>(payload()) : nullptr;
+  }
+  const Node *payload_as_Node() const {
+    return payload_type() == Payload_Node ? static_cast<const Node *>(payload()) : nullptr;
+  }
+  const flatbuffers::String *payload_as_Label() const {
+    return payload_type() == Payload_Label ? static_cast<const flatbuffers::String *>(payload()) : nullptr;
+  }
+  void *mutable_payload() {
+    return GetPointer<void *>(VT_PAYLOAD);
+  }
+  const flatbuffers::Vector<uint8_t> *payloads_type() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_PAYLOADS_TYPE);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_payloads_type() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_PAYLOADS_TYPE);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<void>> *payloads() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<void>> *>(VT_PAYLOADS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<void>> *mutable_payloads() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<void>> *>(VT_PAYLOADS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<int8_t>(verifier, VT_KIND) &&
+           VerifyOffset(verifier, VT_TAGS) &&
+           verifier.VerifyVector(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           VerifyOffset(verifier, VT_FLAGS) &&
+           verifier.VerifyVector(flags()) &&
+           VerifyOffset(verifier, VT_KINDS) &&
+           verifier.VerifyVector(kinds()) &&
+           VerifyField<Point>(verifier, VT_ORIGIN) &&
+           VerifyOffset(verifier, VT_PATH) &&
+           verifier.VerifyVector(path()) &&
+           VerifyOffset(verifier, VT_LEAF) &&
+           verifier.VerifyTable(leaf()) &&
+           VerifyOffset(verifier, VT_CHILDREN) &&
+           verifier.VerifyVector(children()) &&
+           verifier.VerifyVectorOfTables(children()) &&
+           VerifyField<uint8_t>(verifier, VT_PAYLOAD_TYPE) &&
+           VerifyOffset(verifier, VT_PAYLOAD) &&
+           VerifyPayload(verifier, payload(), payload_type()) &&
+           VerifyOffset(verifier, VT_PAYLOADS_TYPE) &&
+           verifier.VerifyVector(payloads_type()) &&
+           VerifyOffset(verifier, VT_PAYLOADS) &&
+           verifier.VerifyVector(payloads()) &&
+           VerifyPayloadVector(verifier, payloads(), payloads_type()) &&
+           verifier.EndTable();
+  }
+  NodeT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(NodeT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Node> Pack(flatbuffers::FlatBufferBuilder &_fbb, const NodeT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+template<> inline const Leaf *Node::payload_as<Leaf>() const {
+  return payload_as_Leaf();
+}
+
+template<> inline const Node *Node::payload_as<Node>() const {
+  return payload_as_Node();
+}
+
+template<> inline const flatbuffers::String *Node::payload_as<flatbuffers::String>() const {
+  return payload_as_Label();
+}
+
+struct NodeBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Node::VT_NAME, name);
+  }
+  void add_kind(Kind kind) {
+    fbb_.AddElement<int8_t>(Node::VT_KIND, static_cast<int8_t>(kind), 0);
+  }
+  void add_tags(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags) {
+    fbb_.AddOffset(Node::VT_TAGS, tags);
+  }
+  void add_flags(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flags) {
+    fbb_.AddOffset(Node::VT_FLAGS, flags);
+  }
+  void add_kinds(flatbuffers::Offset<flatbuffers::Vector<int8_t>> kinds) {
+    fbb_.AddOffset(Node::VT_KINDS, kinds);
+  }
+  void add_origin(const Point *origin) {
+    fbb_.AddStruct(Node::VT_ORIGIN, origin);
+  }
+  void add_path(flatbuffers::Offset<flatbuffers::Vector<const Point *>> path) {
+    fbb_.AddOffset(Node::VT_PATH, path);
+  }
+  void add_leaf(flatbuffers::Offset<Leaf> leaf) {
+    fbb_.AddOffset(Node::VT_LEAF, leaf);
+  }
+  void add_children(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Node>>> children) {
+    fbb_.AddOffset(Node::VT_CHILDREN, children);
+  }
+  void add_payload_type(Payload payload_type) {
+    fbb_.AddElement<uint8_t>(Node::VT_PAYLOAD_TYPE, static_cast<uint8_t>(payload_type), 0);
+  }
+  void add_payload(flatbuffers::Offset<void> payload) {
+    fbb_.AddOffset(Node::VT_PAYLOAD, payload);
+  }
+  void add_payloads_type(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> payloads_type) {
+    fbb_.AddOffset(Node::VT_PAYLOADS_TYPE, payloads_type);
+  }
+  void add_payloads(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<void>>> payloads) {
+    fbb_.AddOffset(Node::VT_PAYLOADS, payloads);
+  }
+  explicit NodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  NodeBuilder &operator=(const NodeBuilder &);
+  flatbuffers::Offset<Node> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Node>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Node> CreateNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    Kind kind = Kind_Small,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flags = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int8_t>> kinds = 0,
+    const Point *origin = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Point *>> path = 0,
+    flatbuffers::Offset<Leaf> leaf = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Node>>> children = 0,
+    Payload payload_type = Payload_NONE,
+    flatbuffers::Offset<void> payload = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> payloads_type = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<void>>> payloads = 0) {
+  if (name.o &&
+      !flatbuffers::IsTheSameAs<int8_t>(static_cast<int8_t>(kind), 0) &&
+      tags.o &&
+      flags.o &&
+      kinds.o &&
+      origin &&
+      path.o &&
+      leaf.o &&
+      children.o &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(payload_type), 0) &&
+      payload.o &&
+      payloads_type.o &&
+      payloads.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 30, 54, 4, 52, 8, 12, 16, 20, 28, 32, 36, 53, 40, 44, 48 };
+    auto table_ = _fbb.StartFixedTable(54, 4);
+    _fbb.AddFixedOffset(table_, 4, name);
+    flatbuffers::WriteScalar<int8_t>(table_ + 52, static_cast<int8_t>(kind));
+    _fbb.AddFixedOffset(table_, 8, tags);
+    _fbb.AddFixedOffset(table_, 12, flags);
+    _fbb.AddFixedOffset(table_, 16, kinds);
+    memcpy(table_ + 20, origin, sizeof(*origin));
+    _fbb.AddFixedOffset(table_, 28, path);
+    _fbb.AddFixedOffset(table_, 32, leaf);
+    _fbb.AddFixedOffset(table_, 36, children);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 53, static_cast<uint8_t>(payload_type));
+    _fbb.AddFixedOffset(table_, 40, payload);
+    _fbb.AddFixedOffset(table_, 44, payloads_type);
+    _fbb.AddFixedOffset(table_, 48, payloads);
+    return flatbuffers::Offset<Node>(_fbb.EndFixedTable(vtable_));
+  }
+  NodeBuilder builder_(_fbb);
+  builder_.add_payloads(payloads);
+  builder_.add_payloads_type(payloads_type);
+  builder_.add_payload(payload);
+  builder_.add_children(children);
+  builder_.add_leaf(leaf);
+  builder_.add_path(path);
+  builder_.add_origin(origin);
+  builder_.add_kinds(kinds);
+  builder_.add_flags(flags);
+  builder_.add_tags(tags);
+  builder_.add_name(name);
+  builder_.add_payload_type(payload_type);
+  builder_.add_kind(kind);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Node> CreateNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    Kind kind = Kind_Small,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *tags = nullptr,
+    const std::vector<uint8_t> *flags = nullptr,
+    const std::vector<int8_t> *kinds = nullptr,
+    const Point *origin = 0,
+    const std::vector<Point> *path = nullptr,
+    flatbuffers::Offset<Leaf> leaf = 0,
+    const std::vector<flatbuffers::Offset<Node>> *children = nullptr,
+    Payload payload_type = Payload_NONE,
+    flatbuffers::Offset<void> payload = 0,
+    const std::vector<uint8_t> *payloads_type = nullptr,
+    const std::vector<flatbuffers::Offset<void>> *payloads = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto tags__ = tags ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*tags) : 0;
+  auto flags__ = flags ? _fbb.CreateVector<uint8_t>(*flags) : 0;
+  auto kinds__ = kinds ? _fbb.CreateVector<int8_t>(*kinds) : 0;
+  auto path__ = path ? _fbb.CreateVectorOfStructs<Point>(*path) : 0;
+  auto children__ = children ? _fbb.CreateVector<flatbuffers::Offset<Node>>(*children) : 0;
+  auto payloads_type__ = payloads_type ? _fbb.CreateVector<uint8_t>(*payloads_type) : 0;
+  auto payloads__ = payloads ? _fbb.CreateVector<flatbuffers::Offset<void>>(*payloads) : 0;
+  return MyGame::ArenaTest::CreateNode(
+      _fbb,
+      name__,
+      kind,
+      tags__,
+      flags__,
+      kinds__,
+      origin,
+      path__,
+      leaf,
+      children__,
+      payload_type,
+      payload,
+      payloads_type__,
+      payloads__);
+}
+
+flatbuffers::Offset<Node> CreateNode(flatbuffers::FlatBufferBuilder &_fbb, const NodeT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline LeafT *Leaf::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new LeafT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Leaf::UnPackTo(LeafT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else _o->name.clear(); };
+  { auto _e = values(); if (_e) { _o->values.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->values[_i] = _e->Get(_i); } } else _o->values.clear(); };
+}
+
+inline flatbuffers::Offset<Leaf> Leaf::Pack(flatbuffers::FlatBufferBuilder &_fbb, const LeafT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateLeaf(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Leaf> CreateLeaf(flatbuffers::FlatBufferBuilder &_fbb, const LeafT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const LeafT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
+  auto _values = _o->values.size() ? _fbb.CreateVector(_o->values) : 0;
+  return MyGame::ArenaTest::CreateLeaf(
+      _fbb,
+      _name,
+      _values);
+}
+
+inline NodeT *Node::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new NodeT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Node::UnPackTo(NodeT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else _o->name.clear(); };
+  { auto _e = kind(); _o->kind = _e; };
+  { auto _e = tags(); if (_e) { _o->tags.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->tags[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->tags.clear(); };
+  { auto _e = flags(); if (_e) { _o->flags.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->flags[_i] = _e->Get(_i) != 0; } } else _o->flags.clear(); };
+  { auto _e = kinds(); if (_e) { _o->kinds.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->kinds[_i] = static_cast<Kind>(_e->Get(_i)); } } else _o->kinds.clear(); };
+  { auto _e = origin(); if (_e) { if (_o->origin) *_o->origin = *_e; else _o->origin = flatbuffers::unique_ptr<Point>(new Point(*_e)); } else _o->origin.reset(); };
+  { auto _e = path(); if (_e) { _o->path.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->path[_i] = *_e->Get(_i); } } else _o->path.clear(); };
+  { auto _e = leaf(); if (_e) { if (_o->leaf) _e->UnPackTo(_o->leaf.get(), _resolver); else _o->leaf = flatbuffers::unique_ptr<LeafT>(_e->UnPack(_resolver)); } else _o->leaf.reset(); };
+  { auto _e = children(); if (_e) { _o->children.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->children[_i]) _e->Get(_i)->UnPackTo(_o->children[_i].get(), _resolver); else _o->children[_i] = flatbuffers::unique_ptr<NodeT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->children.clear(); };
+  { auto _e = payload(); _o->payload.UnPackFrom(_e, payload_type(), _resolver); };
+  { auto _e = payloads(); if (_e) { _o->payloads.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->payloads[_i].UnPackFrom(_e->Get(_i), payloads_type()->GetEnum<Payload>(_i), _resolver); } } else _o->payloads.clear(); };
+}
+
+inline flatbuffers::Offset<Node> Node::Pack(flatbuffers::FlatBufferBuilder &_fbb, const NodeT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateNode(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Node> CreateNode(flatbuffers::FlatBufferBuilder &_fbb, const NodeT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const NodeT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
+  auto _kind = _o->kind;
+  auto _tags = _o->tags.size() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>> (_o->tags.size(), [](size_t i, _VectorArgs *__va) { return __va->__fbb->CreateString(__va->__o->tags[i]); }, &_va ) : 0;
+  auto _flags = _o->flags.size() ? _fbb.CreateVector<uint8_t>(_o->flags.size(), [](size_t i, _VectorArgs *__va) { return static_cast<uint8_t>(__va->__o->flags[i]); }, &_va) : 0;
+  auto _kinds = _o->kinds.size() ? _fbb.CreateVectorScalarCast<int8_t>(flatbuffers::data(_o->kinds), _o->kinds.size()) : 0;
+  auto _origin = _o->origin ? _o->origin.get() : 0;
+  auto _path = _o->path.size() ? _fbb.CreateVectorOfStructs(_o->path) : 0;
+  auto _leaf = _o->leaf ? CreateLeaf(_fbb, _o->leaf.get(), _rehasher) : 0;
+  auto _children = _o->children.size() ? _fbb.CreateVector<flatbuffers::Offset<Node>> (_o->children.size(), [](size_t i, _VectorArgs *__va) { return CreateNode(*__va->__fbb, __va->__o->children[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _payload_type = _o->payload.type;
+  auto _payload = _o->payload.Pack(_fbb);
+  auto _payloads_type = _o->payloads.size() ? _fbb.CreateVector<uint8_t>(_o->payloads.size(), [](size_t i, _VectorArgs *__va) { return static_cast<uint8_t>(__va->__o->payloads[i].type); }, &_va) : 0;
+  auto _payloads = _o->payloads.size() ? _fbb.CreateVector<flatbuffers::Offset<void>>(_o->payloads.size(), [](size_t i, _VectorArgs *__va) { return __va->__o->payloads[i].Pack(*__va->__fbb, __va->__rehasher); }, &_va) : 0;
+  return MyGame::ArenaTest::CreateNode(
+      _fbb,
+      _name,
+      _kind,
+      _tags,
+      _flags,
+      _kinds,
+      _origin,
+      _path,
+      _leaf,
+      _children,
+      _payload_type,
+      _payload,
+      _payloads_type,
+      _payloads);
+}
+
+inline bool VerifyPayload(flatbuffers::Verifier &verifier, const void *obj, Payload type) {
+  switch (type) {
+    case Payload_NONE: {
+      return true;
+    }
+    case Payload_Leaf: {
+      auto ptr = reinterpret_cast<const Leaf *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Payload_Node: {
+      auto ptr = reinterpret_cast<const Node *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Payload_Label: {
+      auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+      return verifier.VerifyString(ptr);
+    }
+    default: return false;
+  }
+}
+
+inline bool VerifyPayloadVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types) {
+  if (!values || !types) return !values && !types;
+  if (values->size() != types->size()) return false;
+  for (flatbuffers::uoffset_t i = 0; i < values->size(); ++i) {
+    if (!VerifyPayload(
+        verifier,  values->Get(i), types->GetEnum<Payload>(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline void *PayloadUnion::UnPack(const void *obj, Payload type, const flatbuffers::resolver_function_t *resolver) {
+  switch (type) {
+    case Payload_Leaf: {
+      auto ptr = reinterpret_cast<const Leaf *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Payload_Node: {
+      auto ptr = reinterpret_cast<const Node *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case Payload_Label: {
+      auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+      return new flatbuffers::ArenaUnionString(ptr->c_str(), ptr->size());
+    }
+    default: return nullptr;
+  }
+}
+
+inline void PayloadUnion::UnPackFrom(const void *obj, Payload _type, const flatbuffers::resolver_function_t *resolver) {
+  if (obj && value && _type == type) {
+    switch (type) {
+      case Payload_Leaf: {
+        auto ptr = reinterpret_cast<const Leaf *>(obj);
+        auto _o = reinterpret_cast<LeafT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      case Payload_Node: {
+        auto ptr = reinterpret_cast<const Node *>(obj);
+        auto _o = reinterpret_cast<NodeT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      case Payload_Label: {
+        auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+        auto _o = reinterpret_cast<flatbuffers::ArenaUnionString *>(value);
+        _o->assign(ptr->c_str(), ptr->size());
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  if (obj) value = UnPack(obj, _type, resolver);
+}
+
+inline flatbuffers::Offset<void> PayloadUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
+  switch (type) {
+    case Payload_Leaf: {
+      auto ptr = reinterpret_cast<const LeafT *>(value);
+      return CreateLeaf(_fbb, ptr, _rehasher).Union();
+    }
+    case Payload_Node: {
+      auto ptr = reinterpret_cast<const NodeT *>(value);
+      return CreateNode(_fbb, ptr, _rehasher).Union();
+    }
+    case Payload_Label: {
+      auto ptr = reinterpret_cast<const flatbuffers::ArenaUnionString *>(value);
+      return _fbb.CreateString(*ptr).Union();
+    }
+    default: return 0;
+  }
+}
+
+inline PayloadUnion::PayloadUnion(const PayloadUnion &u) FLATBUFFERS_NOEXCEPT : type(u.type), value(nullptr) {
+  switch (type) {
+    case Payload_Leaf: {
+      value = new LeafT(*reinterpret_cast<LeafT *>(u.value));
+      break;
+    }
+    case Payload_Node: {
+      FLATBUFFERS_ASSERT(false);  // NodeT not copyable.
+      break;
+    }
+    case Payload_Label: {
+      value = new flatbuffers::ArenaUnionString(*reinterpret_cast<flatbuffers::ArenaUnionString *>(u.value));
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+inline void PayloadUnion::Reset() {
+  switch (type) {
+    case Payload_Leaf: {
+      auto ptr = reinterpret_cast<LeafT *>(value);
+      delete ptr;
+      break;
+    }
+    case Payload_Node: {
+      auto ptr = reinterpret_cast<NodeT *>(value);
+      delete ptr;
+      break;
+    }
+    case Payload_Label: {
+      auto ptr = reinterpret_cast<flatbuffers::ArenaUnionString *>(value);
+      delete ptr;
+      break;
+    }
+    default: break;
+  }
+  value = nullptr;
+  type = Payload_NONE;
+}
+
+inline const flatbuffers::TypeTable *KindTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_CHAR, 0, 0 },
+    { flatbuffers::ET_CHAR, 0, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    KindTypeTable
+  };
+  static const char * const names[] = {
+    "Small",
+    "Large"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_ENUM, 2, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *PayloadTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 0, -1 },
+    { flatbuffers::ET_SEQUENCE, 0, 0 },
+    { flatbuffers::ET_SEQUENCE, 0, 1 },
+    { flatbuffers::ET_STRING, 0, -1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    LeafTypeTable,
+    NodeTypeTable
+  };
+  static const char * const names[] = {
+    "NONE",
+    "Leaf",
+    "Node",
+    "Label"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_UNION, 4, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *PointTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_FLOAT, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 }
+  };
+  static const int64_t values[] = { 0, 4, 8 };
+  static const char * const names[] = {
+    "x",
+    "y"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_STRUCT, 2, type_codes, nullptr, values, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *LeafTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_INT, 1, -1 }
+  };
+  static const char * const names[] = {
+    "name",
+    "values"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *NodeTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_CHAR, 0, 0 },
+    { flatbuffers::ET_STRING, 1, -1 },
+    { flatbuffers::ET_BOOL, 1, -1 },
+    { flatbuffers::ET_CHAR, 1, 0 },
+    { flatbuffers::ET_SEQUENCE, 0, 1 },
+    { flatbuffers::ET_SEQUENCE, 1, 1 },
+    { flatbuffers::ET_SEQUENCE, 0, 2 },
+    { flatbuffers::ET_SEQUENCE, 1, 3 },
+    { flatbuffers::ET_UTYPE, 0, 4 },
+    { flatbuffers::ET_SEQUENCE, 0, 4 },
+    { flatbuffers::ET_UTYPE, 1, 4 },
+    { flatbuffers::ET_SEQUENCE, 1, 4 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    KindTypeTable,
+    PointTypeTable,
+    LeafTypeTable,
+    NodeTypeTable,
+    PayloadTypeTable
+  };
+  static const char * const names[] = {
+    "name",
+    "kind",
+    "tags",
+    "flags",
+    "kinds",
+    "origin",
+    "path",
+    "leaf",
+    "children",
+    "payload_type",
+    "payload",
+    "payloads_type",
+    "payloads"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 13, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const MyGame::ArenaTest::Node *GetNode(const void *buf) {
+  return flatbuffers::GetRoot<MyGame::ArenaTest::Node>(buf);
+}
+
+inline const MyGame::ArenaTest::Node *GetSizePrefixedNode(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<MyGame::ArenaTest::Node>(buf);
+}
+
+inline Node *GetMutableNode(void *buf) {
+  return flatbuffers::GetMutableRoot<Node>(buf);
+}
+
+inline bool VerifyNodeBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<MyGame::ArenaTest::Node>(nullptr);
+}
+
+inline bool VerifySizePrefixedNodeBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<MyGame::ArenaTest::Node>(nullptr);
+}
+
+inline void FinishNodeBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::ArenaTest::Node> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedNodeBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::ArenaTest::Node> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline flatbuffers::unique_ptr<NodeT> UnPackNode(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<NodeT>(GetNode(buf)->UnPack(res));
+}
+
+inline flatbuffers::unique_ptr<NodeT> UnPackNode(
+    const void *buf,
+    flatbuffers::Arena &arena,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  flatbuffers::Arena::Scope scope(&arena);
+  return UnPackNode(buf, res);
+}
+
+}  // namespace ArenaTest
+}  // namespace MyGame
+
+#endif  // FLATBUFFERS_GENERATED_ARENATEST_MYGAME_ARENATEST_H_
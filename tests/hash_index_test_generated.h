@@ -0,0 +1,407 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_HASHINDEXTEST_MYGAME_HASHINDEX_H_
+#define FLATBUFFERS_GENERATED_HASHINDEXTEST_MYGAME_HASHINDEX_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace MyGame {
+namespace HashIndex {
+
+struct Item;
+
+struct Entry;
+
+struct Inventory;
+
+inline const flatbuffers::TypeTable *ItemTypeTable();
+
+inline const flatbuffers::TypeTable *EntryTypeTable();
+
+inline const flatbuffers::TypeTable *InventoryTypeTable();
+
+struct Item FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return ItemTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_COUNT = 6
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  bool KeyCompareLessThan(const Item *o) const {
+    return *name() < *o->name();
+  }
+  int KeyCompareWithValue(const char *val) const {
+    return strcmp(name()->c_str(), val);
+  }
+  int32_t count() const {
+    return GetField<int32_t>(VT_COUNT, 0);
+  }
+  bool mutate_count(int32_t _count) {
+    return SetField<int32_t>(VT_COUNT, _count, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<int32_t>(verifier, VT_COUNT) &&
+           verifier.EndTable();
+  }
+};
+
+struct ItemBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Item::VT_NAME, name);
+  }
+  void add_count(int32_t count) {
+    fbb_.AddElement<int32_t>(Item::VT_COUNT, count, 0);
+  }
+  explicit ItemBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ItemBuilder &operator=(const ItemBuilder &);
+  flatbuffers::Offset<Item> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Item>(end);
+    fbb_.Required(o, Item::VT_NAME);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Item> CreateItem(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    int32_t count = 0) {
+  if (name.o &&
+      !flatbuffers::IsTheSameAs<int32_t>(count, 0)) {
+    static const flatbuffers::voffset_t vtable_[] = { 8, 12, 4, 8 };
+    auto table_ = _fbb.StartFixedTable(12, 4);
+    _fbb.AddFixedOffset(table_, 4, name);
+    flatbuffers::WriteScalar<int32_t>(table_ + 8, count);
+    return flatbuffers::Offset<Item>(_fbb.EndFixedTable(vtable_));
+  }
+  ItemBuilder builder_(_fbb);
+  builder_.add_count(count);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Item> CreateItemDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    int32_t count = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  return MyGame::HashIndex::CreateItem(
+      _fbb,
+      name__,
+      count);
+}
+
+struct Entry FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return EntryTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4
+  };
+  uint64_t id() const {
+    return GetField<uint64_t>(VT_ID, 0);
+  }
+  bool mutate_id(uint64_t _id) {
+    return SetField<uint64_t>(VT_ID, _id, 0);
+  }
+  bool KeyCompareLessThan(const Entry *o) const {
+    return id() < o->id();
+  }
+  int KeyCompareWithValue(uint64_t val) const {
+    return static_cast<int>(id() > val) - static_cast<int>(id() < val);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_ID) &&
+           verifier.EndTable();
+  }
+};
+
+struct EntryBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(uint64_t id) {
+    fbb_.AddElement<uint64_t>(Entry::VT_ID, id, 0);
+  }
+  explicit EntryBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  EntryBuilder &operator=(const EntryBuilder &);
+  flatbuffers::Offset<Entry> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Entry>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Entry> CreateEntry(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t id = 0) {
+  if (!flatbuffers::IsTheSameAs<uint64_t>(id, 0)) {
+    static const flatbuffers::voffset_t vtable_[] = { 6, 16, 8 };
+    auto table_ = _fbb.StartFixedTable(16, 8);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 8, id);
+    return flatbuffers::Offset<Entry>(_fbb.EndFixedTable(vtable_));
+  }
+  EntryBuilder builder_(_fbb);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+struct Inventory FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return InventoryTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ITEMS_INDEX = 4,
+    VT_ITEMS = 6,
+    VT_ENTRIES = 8,
+    VT_ENTRIES_INDEX = 10
+  };
+  const flatbuffers::Vector<uint32_t> *items_index() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_ITEMS_INDEX);
+  }
+  flatbuffers::Vector<uint32_t> *mutable_items_index() {
+    return GetPointer<flatbuffers::Vector<uint32_t> *>(VT_ITEMS_INDEX);
+  }
+  const Item *items_by_key(const char *key) const {
+    auto vec = items();
+    return vec ? vec->LookupByKeyHashed(items_index(), key) : nullptr;
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Item>> *items() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Item>> *>(VT_ITEMS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Item>> *mutable_items() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Item>> *>(VT_ITEMS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Entry>> *entries() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Entry>> *>(VT_ENTRIES);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Entry>> *mutable_entries() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Entry>> *>(VT_ENTRIES);
+  }
+  const flatbuffers::Vector<uint32_t> *entries_index() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_ENTRIES_INDEX);
+  }
+  flatbuffers::Vector<uint32_t> *mutable_entries_index() {
+    return GetPointer<flatbuffers::Vector<uint32_t> *>(VT_ENTRIES_INDEX);
+  }
+  const Entry *entries_by_key(uint64_t key) const {
+    auto vec = entries();
+    return vec ? vec->LookupByKeyHashed(entries_index(), key) : nullptr;
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ITEMS_INDEX) &&
+           verifier.VerifyVector(items_index()) &&
+           VerifyOffset(verifier, VT_ITEMS) &&
+           verifier.VerifyVector(items()) &&
+           verifier.VerifyVectorOfTables(items()) &&
+           VerifyOffset(verifier, VT_ENTRIES) &&
+           verifier.VerifyVector(entries()) &&
+           verifier.VerifyVectorOfTables(entries()) &&
+           VerifyOffset(verifier, VT_ENTRIES_INDEX) &&
+           verifier.VerifyVector(entries_index()) &&
+           verifier.EndTable();
+  }
+};
+
+struct InventoryBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_items_index(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> items_index) {
+    fbb_.AddOffset(Inventory::VT_ITEMS_INDEX, items_index);
+  }
+  void add_items(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Item>>> items) {
+    fbb_.AddOffset(Inventory::VT_ITEMS, items);
+  }
+  void add_entries(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Entry>>> entries) {
+    fbb_.AddOffset(Inventory::VT_ENTRIES, entries);
+  }
+  void add_entries_index(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> entries_index) {
+    fbb_.AddOffset(Inventory::VT_ENTRIES_INDEX, entries_index);
+  }
+  explicit InventoryBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  InventoryBuilder &operator=(const InventoryBuilder &);
+  flatbuffers::Offset<Inventory> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Inventory>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Inventory> CreateInventory(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> items_index = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Item>>> items = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Entry>>> entries = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> entries_index = 0) {
+  if (items_index.o &&
+      items.o &&
+      entries.o &&
+      entries_index.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 12, 20, 4, 8, 12, 16 };
+    auto table_ = _fbb.StartFixedTable(20, 4);
+    _fbb.AddFixedOffset(table_, 4, items_index);
+    _fbb.AddFixedOffset(table_, 8, items);
+    _fbb.AddFixedOffset(table_, 12, entries);
+    _fbb.AddFixedOffset(table_, 16, entries_index);
+    return flatbuffers::Offset<Inventory>(_fbb.EndFixedTable(vtable_));
+  }
+  InventoryBuilder builder_(_fbb);
+  builder_.add_entries_index(entries_index);
+  builder_.add_entries(entries);
+  builder_.add_items(items);
+  builder_.add_items_index(items_index);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Inventory> CreateInventoryDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint32_t> *items_index = nullptr,
+    const std::vector<flatbuffers::Offset<Item>> *items = nullptr,
+    const std::vector<flatbuffers::Offset<Entry>> *entries = nullptr,
+    const std::vector<uint32_t> *entries_index = nullptr) {
+  auto items_index__ = items_index ? _fbb.CreateVector<uint32_t>(*items_index) : 0;
+  auto items__ = items ? _fbb.CreateVector<flatbuffers::Offset<Item>>(*items) : 0;
+  auto entries__ = entries ? _fbb.CreateVector<flatbuffers::Offset<Entry>>(*entries) : 0;
+  auto entries_index__ = entries_index ? _fbb.CreateVector<uint32_t>(*entries_index) : 0;
+  return MyGame::HashIndex::CreateInventory(
+      _fbb,
+      items_index__,
+      items__,
+      entries__,
+      entries_index__);
+}
+
+inline flatbuffers::Offset<flatbuffers::Vector<uint32_t>> CreateInventoryItemsIndex(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Item>>> items) {
+  auto vec = flatbuffers::GetTemporaryPointer(_fbb, items);
+  std::vector<uint32_t> hashes(vec->size());
+  for (flatbuffers::uoffset_t i = 0; i < vec->size(); i++) {
+    hashes[i] = flatbuffers::HashKey(vec->Get(i)->name());
+  }
+  return _fbb.CreateHashIndex(hashes);
+}
+
+inline flatbuffers::Offset<flatbuffers::Vector<uint32_t>> CreateInventoryEntriesIndex(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Entry>>> entries) {
+  auto vec = flatbuffers::GetTemporaryPointer(_fbb, entries);
+  std::vector<uint32_t> hashes(vec->size());
+  for (flatbuffers::uoffset_t i = 0; i < vec->size(); i++) {
+    hashes[i] = flatbuffers::HashKey(static_cast<uint64_t>(vec->Get(i)->id()));
+  }
+  return _fbb.CreateHashIndex(hashes);
+}
+
+inline const flatbuffers::TypeTable *ItemTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_INT, 0, -1 }
+  };
+  static const char * const names[] = {
+    "name",
+    "count"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *EntryTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_ULONG, 0, -1 }
+  };
+  static const char * const names[] = {
+    "id"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *InventoryTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_UINT, 1, -1 },
+    { flatbuffers::ET_SEQUENCE, 1, 0 },
+    { flatbuffers::ET_SEQUENCE, 1, 1 },
+    { flatbuffers::ET_UINT, 1, -1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    ItemTypeTable,
+    EntryTypeTable
+  };
+  static const char * const names[] = {
+    "items_index",
+    "items",
+    "entries",
+    "entries_index"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 4, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const MyGame::HashIndex::Inventory *GetInventory(const void *buf) {
+  return flatbuffers::GetRoot<MyGame::HashIndex::Inventory>(buf);
+}
+
+inline const MyGame::HashIndex::Inventory *GetSizePrefixedInventory(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<MyGame::HashIndex::Inventory>(buf);
+}
+
+inline Inventory *GetMutableInventory(void *buf) {
+  return flatbuffers::GetMutableRoot<Inventory>(buf);
+}
+
+inline bool VerifyInventoryBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<MyGame::HashIndex::Inventory>(nullptr);
+}
+
+inline bool VerifySizePrefixedInventoryBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<MyGame::HashIndex::Inventory>(nullptr);
+}
+
+inline void FinishInventoryBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::HashIndex::Inventory> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedInventoryBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::HashIndex::Inventory> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace HashIndex
+}  // namespace MyGame
+
+#endif  // FLATBUFFERS_GENERATED_HASHINDEXTEST_MYGAME_HASHINDEX_H_
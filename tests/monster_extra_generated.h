@@ -184,6 +184,26 @@ inline flatbuffers::Offset<MonsterExtra> CreateMonsterExtra(
     double testd_ninf = -std::numeric_limits<double>::infinity(),
     flatbuffers::Offset<flatbuffers::Vector<float>> testf_vec = 0,
     flatbuffers::Offset<flatbuffers::Vector<double>> testd_vec = 0) {
+  if (!flatbuffers::IsTheSameAs<float>(testf_nan, std::numeric_limits<float>::quiet_NaN()) &&
+      !flatbuffers::IsTheSameAs<float>(testf_pinf, std::numeric_limits<float>::infinity()) &&
+      !flatbuffers::IsTheSameAs<float>(testf_ninf, -std::numeric_limits<float>::infinity()) &&
+      !flatbuffers::IsTheSameAs<double>(testd_nan, std::numeric_limits<double>::quiet_NaN()) &&
+      !flatbuffers::IsTheSameAs<double>(testd_pinf, std::numeric_limits<double>::infinity()) &&
+      !flatbuffers::IsTheSameAs<double>(testd_ninf, -std::numeric_limits<double>::infinity()) &&
+      testf_vec.o &&
+      testd_vec.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 20, 48, 4, 32, 36, 8, 16, 24, 40, 44 };
+    auto table_ = _fbb.StartFixedTable(48, 8);
+    flatbuffers::WriteScalar<float>(table_ + 4, testf_nan);
+    flatbuffers::WriteScalar<float>(table_ + 32, testf_pinf);
+    flatbuffers::WriteScalar<float>(table_ + 36, testf_ninf);
+    flatbuffers::WriteScalar<double>(table_ + 8, testd_nan);
+    flatbuffers::WriteScalar<double>(table_ + 16, testd_pinf);
+    flatbuffers::WriteScalar<double>(table_ + 24, testd_ninf);
+    _fbb.AddFixedOffset(table_, 40, testf_vec);
+    _fbb.AddFixedOffset(table_, 44, testd_vec);
+    return flatbuffers::Offset<MonsterExtra>(_fbb.EndFixedTable(vtable_));
+  }
   MonsterExtraBuilder builder_(_fbb);
   builder_.add_testd_ninf(testd_ninf);
   builder_.add_testd_pinf(testd_pinf);
@@ -237,8 +257,8 @@ inline void MonsterExtra::UnPackTo(MonsterExtraT *_o, const flatbuffers::resolve
   { auto _e = testd_nan(); _o->testd_nan = _e; };
   { auto _e = testd_pinf(); _o->testd_pinf = _e; };
   { auto _e = testd_ninf(); _o->testd_ninf = _e; };
-  { auto _e = testf_vec(); if (_e) { _o->testf_vec.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testf_vec[_i] = _e->Get(_i); } } };
-  { auto _e = testd_vec(); if (_e) { _o->testd_vec.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testd_vec[_i] = _e->Get(_i); } } };
+  { auto _e = testf_vec(); if (_e) { _o->testf_vec.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testf_vec[_i] = _e->Get(_i); } } else _o->testf_vec.clear(); };
+  { auto _e = testd_vec(); if (_e) { _o->testd_vec.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testd_vec[_i] = _e->Get(_i); } } else _o->testd_vec.clear(); };
 }
 
 inline flatbuffers::Offset<MonsterExtra> MonsterExtra::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterExtraT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -6,6 +6,7 @@
 
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/flexbuffers.h"
+#include "flatbuffers/json.h"
 
 namespace MyGame {
 
@@ -219,6 +220,7 @@ struct AnyUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, Any type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackFrom(const void *obj, Any _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MonsterT *AsMonster() {
@@ -361,6 +363,7 @@ struct AnyUniqueAliasesUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, AnyUniqueAliases type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackFrom(const void *obj, AnyUniqueAliases _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MonsterT *AsM() {
@@ -475,6 +478,7 @@ struct AnyAmbiguousAliasesUnion {
   void Reset();
 
   static void *UnPack(const void *obj, AnyAmbiguousAliases type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackFrom(const void *obj, AnyAmbiguousAliases _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MonsterT *AsM1() {
@@ -856,6 +860,9 @@ struct TestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Ta
   Color color() const {
     return static_cast<Color>(GetField<int8_t>(VT_COLOR, 2));
   }
+  Color color(const flatbuffers::Verifier &verifier) const {
+    return static_cast<Color>(GetFieldChecked<int8_t>(verifier, VT_COLOR, 2));
+  }
   bool mutate_color(Color _color) {
     return SetField<int8_t>(VT_COLOR, static_cast<int8_t>(_color), 2);
   }
@@ -890,6 +897,12 @@ struct TestSimpleTableWithEnumBuilder {
 inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(
     flatbuffers::FlatBufferBuilder &_fbb,
     Color color = Color_Green) {
+  if (!flatbuffers::IsTheSameAs<int8_t>(static_cast<int8_t>(color), 2)) {
+    static const flatbuffers::voffset_t vtable_[] = { 6, 5, 4 };
+    auto table_ = _fbb.StartFixedTable(5, 4);
+    flatbuffers::WriteScalar<int8_t>(table_ + 4, static_cast<int8_t>(color));
+    return flatbuffers::Offset<TestSimpleTableWithEnum>(_fbb.EndFixedTable(vtable_));
+  }
   TestSimpleTableWithEnumBuilder builder_(_fbb);
   builder_.add_color(color);
   return builder_.Finish();
@@ -933,18 +946,27 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *id() const {
     return GetPointer<const flatbuffers::String *>(VT_ID);
   }
+  const flatbuffers::String *id(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::String *>(verifier, VT_ID);
+  }
   flatbuffers::String *mutable_id() {
     return GetPointer<flatbuffers::String *>(VT_ID);
   }
   int64_t val() const {
     return GetField<int64_t>(VT_VAL, 0);
   }
+  int64_t val(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int64_t>(verifier, VT_VAL, 0);
+  }
   bool mutate_val(int64_t _val) {
     return SetField<int64_t>(VT_VAL, _val, 0);
   }
   uint16_t count() const {
     return GetField<uint16_t>(VT_COUNT, 0);
   }
+  uint16_t count(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint16_t>(verifier, VT_COUNT, 0);
+  }
   bool mutate_count(uint16_t _count) {
     return SetField<uint16_t>(VT_COUNT, _count, 0);
   }
@@ -990,6 +1012,16 @@ inline flatbuffers::Offset<Stat> CreateStat(
     flatbuffers::Offset<flatbuffers::String> id = 0,
     int64_t val = 0,
     uint16_t count = 0) {
+  if (id.o &&
+      !flatbuffers::IsTheSameAs<int64_t>(val, 0) &&
+      !flatbuffers::IsTheSameAs<uint16_t>(count, 0)) {
+    static const flatbuffers::voffset_t vtable_[] = { 10, 18, 4, 8, 16 };
+    auto table_ = _fbb.StartFixedTable(18, 8);
+    _fbb.AddFixedOffset(table_, 4, id);
+    flatbuffers::WriteScalar<int64_t>(table_ + 8, val);
+    flatbuffers::WriteScalar<uint16_t>(table_ + 16, count);
+    return flatbuffers::Offset<Stat>(_fbb.EndFixedTable(vtable_));
+  }
   StatBuilder builder_(_fbb);
   builder_.add_val(val);
   builder_.add_id(id);
@@ -1041,6 +1073,9 @@ struct Referrable FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   uint64_t id() const {
     return GetField<uint64_t>(VT_ID, 0);
   }
+  uint64_t id(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint64_t>(verifier, VT_ID, 0);
+  }
   bool mutate_id(uint64_t _id) {
     return SetField<uint64_t>(VT_ID, _id, 0);
   }
@@ -1081,6 +1116,12 @@ struct ReferrableBuilder {
 inline flatbuffers::Offset<Referrable> CreateReferrable(
     flatbuffers::FlatBufferBuilder &_fbb,
     uint64_t id = 0) {
+  if (!flatbuffers::IsTheSameAs<uint64_t>(id, 0)) {
+    static const flatbuffers::voffset_t vtable_[] = { 6, 16, 8 };
+    auto table_ = _fbb.StartFixedTable(16, 8);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 8, id);
+    return flatbuffers::Offset<Referrable>(_fbb.EndFixedTable(vtable_));
+  }
   ReferrableBuilder builder_(_fbb);
   builder_.add_id(id);
   return builder_.Finish();
@@ -1267,24 +1308,36 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const Vec3 *pos() const {
     return GetStruct<const Vec3 *>(VT_POS);
   }
+  const Vec3 *pos(const flatbuffers::Verifier &verifier) const {
+    return GetStructChecked<const Vec3 *>(verifier, VT_POS);
+  }
   Vec3 *mutable_pos() {
     return GetStruct<Vec3 *>(VT_POS);
   }
   int16_t mana() const {
     return GetField<int16_t>(VT_MANA, 150);
   }
+  int16_t mana(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int16_t>(verifier, VT_MANA, 150);
+  }
   bool mutate_mana(int16_t _mana) {
     return SetField<int16_t>(VT_MANA, _mana, 150);
   }
   int16_t hp() const {
     return GetField<int16_t>(VT_HP, 100);
   }
+  int16_t hp(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int16_t>(verifier, VT_HP, 100);
+  }
   bool mutate_hp(int16_t _hp) {
     return SetField<int16_t>(VT_HP, _hp, 100);
   }
   const flatbuffers::String *name() const {
     return GetPointer<const flatbuffers::String *>(VT_NAME);
   }
+  const flatbuffers::String *name(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::String *>(verifier, VT_NAME);
+  }
   flatbuffers::String *mutable_name() {
     return GetPointer<flatbuffers::String *>(VT_NAME);
   }
@@ -1297,46 +1350,76 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<uint8_t> *inventory() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
   }
+  const flatbuffers::Vector<uint8_t> *inventory(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<uint8_t> *>(verifier, VT_INVENTORY);
+  }
   flatbuffers::Vector<uint8_t> *mutable_inventory() {
     return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
   }
   Color color() const {
     return static_cast<Color>(GetField<int8_t>(VT_COLOR, 8));
   }
+  Color color(const flatbuffers::Verifier &verifier) const {
+    return static_cast<Color>(GetFieldChecked<int8_t>(verifier, VT_COLOR, 8));
+  }
   bool mutate_color(Color _color) {
     return SetField<int8_t>(VT_COLOR, static_cast<int8_t>(_color), 8);
   }
   Any test_type() const {
     return static_cast<Any>(GetField<uint8_t>(VT_TEST_TYPE, 0));
   }
+  Any test_type(const flatbuffers::Verifier &verifier) const {
+    return static_cast<Any>(GetFieldChecked<uint8_t>(verifier, VT_TEST_TYPE, 0));
+  }
   bool mutate_test_type(Any _test_type) {
     return SetField<uint8_t>(VT_TEST_TYPE, static_cast<uint8_t>(_test_type), 0);
   }
   const void *test() const {
     return GetPointer<const void *>(VT_TEST);
   }
+  const void *test(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const void *>(verifier, VT_TEST);
+  }
   template<typename T> const T *test_as() const;
   const Monster *test_as_Monster() const {
     return test_type() == Any_Monster ? static_cast<const Monster *>(test()) : nullptr;
   }
+  const Monster *test_as_Monster(const flatbuffers::Verifier &verifier) const {
+    auto p = test_type(verifier) == Any_Monster ? static_cast<const Monster *>(test(verifier)) : nullptr;
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
   const TestSimpleTableWithEnum *test_as_TestSimpleTableWithEnum() const {
     return test_type() == Any_TestSimpleTableWithEnum ? static_cast<const TestSimpleTableWithEnum *>(test()) : nullptr;
   }
+  const TestSimpleTableWithEnum *test_as_TestSimpleTableWithEnum(const flatbuffers::Verifier &verifier) const {
+    auto p = test_type(verifier) == Any_TestSimpleTableWithEnum ? static_cast<const TestSimpleTableWithEnum *>(test(verifier)) : nullptr;
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
   const MyGame::Example2::Monster *test_as_MyGame_Example2_Monster() const {
     return test_type() == Any_MyGame_Example2_Monster ? static_cast<const MyGame::Example2::Monster *>(test()) : nullptr;
   }
+  const MyGame::Example2::Monster *test_as_MyGame_Example2_Monster(const flatbuffers::Verifier &verifier) const {
+    auto p = test_type(verifier) == Any_MyGame_Example2_Monster ? static_cast<const MyGame::Example2::Monster *>(test(verifier)) : nullptr;
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
   void *mutable_test() {
     return GetPointer<void *>(VT_TEST);
   }
   const flatbuffers::Vector<const Test *> *test4() const {
     return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST4);
   }
+  const flatbuffers::Vector<const Test *> *test4(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<const Test *> *>(verifier, VT_TEST4);
+  }
   flatbuffers::Vector<const Test *> *mutable_test4() {
     return GetPointer<flatbuffers::Vector<const Test *> *>(VT_TEST4);
   }
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(verifier, VT_TESTARRAYOFSTRING);
+  }
   flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_testarrayofstring() {
     return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING);
   }
@@ -1345,18 +1428,27 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<Monster>> *testarrayoftables() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Monster>> *>(VT_TESTARRAYOFTABLES);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<Monster>> *testarrayoftables(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<flatbuffers::Offset<Monster>> *>(verifier, VT_TESTARRAYOFTABLES);
+  }
   flatbuffers::Vector<flatbuffers::Offset<Monster>> *mutable_testarrayoftables() {
     return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Monster>> *>(VT_TESTARRAYOFTABLES);
   }
   const Monster *enemy() const {
     return GetPointer<const Monster *>(VT_ENEMY);
   }
+  const Monster *enemy(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const Monster *>(verifier, VT_ENEMY);
+  }
   Monster *mutable_enemy() {
     return GetPointer<Monster *>(VT_ENEMY);
   }
   const flatbuffers::Vector<uint8_t> *testnestedflatbuffer() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTNESTEDFLATBUFFER);
   }
+  const flatbuffers::Vector<uint8_t> *testnestedflatbuffer(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<uint8_t> *>(verifier, VT_TESTNESTEDFLATBUFFER);
+  }
   flatbuffers::Vector<uint8_t> *mutable_testnestedflatbuffer() {
     return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_TESTNESTEDFLATBUFFER);
   }
@@ -1366,102 +1458,153 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const Stat *testempty() const {
     return GetPointer<const Stat *>(VT_TESTEMPTY);
   }
+  const Stat *testempty(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const Stat *>(verifier, VT_TESTEMPTY);
+  }
   Stat *mutable_testempty() {
     return GetPointer<Stat *>(VT_TESTEMPTY);
   }
   bool testbool() const {
     return GetField<uint8_t>(VT_TESTBOOL, 0) != 0;
   }
+  bool testbool(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint8_t>(verifier, VT_TESTBOOL, 0) != 0;
+  }
   bool mutate_testbool(bool _testbool) {
     return SetField<uint8_t>(VT_TESTBOOL, static_cast<uint8_t>(_testbool), 0);
   }
   int32_t testhashs32_fnv1() const {
     return GetField<int32_t>(VT_TESTHASHS32_FNV1, 0);
   }
+  int32_t testhashs32_fnv1(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int32_t>(verifier, VT_TESTHASHS32_FNV1, 0);
+  }
   bool mutate_testhashs32_fnv1(int32_t _testhashs32_fnv1) {
     return SetField<int32_t>(VT_TESTHASHS32_FNV1, _testhashs32_fnv1, 0);
   }
   uint32_t testhashu32_fnv1() const {
     return GetField<uint32_t>(VT_TESTHASHU32_FNV1, 0);
   }
+  uint32_t testhashu32_fnv1(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint32_t>(verifier, VT_TESTHASHU32_FNV1, 0);
+  }
   bool mutate_testhashu32_fnv1(uint32_t _testhashu32_fnv1) {
     return SetField<uint32_t>(VT_TESTHASHU32_FNV1, _testhashu32_fnv1, 0);
   }
   int64_t testhashs64_fnv1() const {
     return GetField<int64_t>(VT_TESTHASHS64_FNV1, 0);
   }
+  int64_t testhashs64_fnv1(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int64_t>(verifier, VT_TESTHASHS64_FNV1, 0);
+  }
   bool mutate_testhashs64_fnv1(int64_t _testhashs64_fnv1) {
     return SetField<int64_t>(VT_TESTHASHS64_FNV1, _testhashs64_fnv1, 0);
   }
   uint64_t testhashu64_fnv1() const {
     return GetField<uint64_t>(VT_TESTHASHU64_FNV1, 0);
   }
+  uint64_t testhashu64_fnv1(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint64_t>(verifier, VT_TESTHASHU64_FNV1, 0);
+  }
   bool mutate_testhashu64_fnv1(uint64_t _testhashu64_fnv1) {
     return SetField<uint64_t>(VT_TESTHASHU64_FNV1, _testhashu64_fnv1, 0);
   }
   int32_t testhashs32_fnv1a() const {
     return GetField<int32_t>(VT_TESTHASHS32_FNV1A, 0);
   }
+  int32_t testhashs32_fnv1a(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int32_t>(verifier, VT_TESTHASHS32_FNV1A, 0);
+  }
   bool mutate_testhashs32_fnv1a(int32_t _testhashs32_fnv1a) {
     return SetField<int32_t>(VT_TESTHASHS32_FNV1A, _testhashs32_fnv1a, 0);
   }
   uint32_t testhashu32_fnv1a() const {
     return GetField<uint32_t>(VT_TESTHASHU32_FNV1A, 0);
   }
+  uint32_t testhashu32_fnv1a(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint32_t>(verifier, VT_TESTHASHU32_FNV1A, 0);
+  }
   bool mutate_testhashu32_fnv1a(uint32_t _testhashu32_fnv1a) {
     return SetField<uint32_t>(VT_TESTHASHU32_FNV1A, _testhashu32_fnv1a, 0);
   }
   int64_t testhashs64_fnv1a() const {
     return GetField<int64_t>(VT_TESTHASHS64_FNV1A, 0);
   }
+  int64_t testhashs64_fnv1a(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int64_t>(verifier, VT_TESTHASHS64_FNV1A, 0);
+  }
   bool mutate_testhashs64_fnv1a(int64_t _testhashs64_fnv1a) {
     return SetField<int64_t>(VT_TESTHASHS64_FNV1A, _testhashs64_fnv1a, 0);
   }
   uint64_t testhashu64_fnv1a() const {
     return GetField<uint64_t>(VT_TESTHASHU64_FNV1A, 0);
   }
+  uint64_t testhashu64_fnv1a(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint64_t>(verifier, VT_TESTHASHU64_FNV1A, 0);
+  }
   bool mutate_testhashu64_fnv1a(uint64_t _testhashu64_fnv1a) {
     return SetField<uint64_t>(VT_TESTHASHU64_FNV1A, _testhashu64_fnv1a, 0);
   }
   const flatbuffers::Vector<uint8_t> *testarrayofbools() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS);
   }
+  const flatbuffers::Vector<uint8_t> *testarrayofbools(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<uint8_t> *>(verifier, VT_TESTARRAYOFBOOLS);
+  }
   flatbuffers::Vector<uint8_t> *mutable_testarrayofbools() {
     return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS);
   }
   float testf() const {
     return GetField<float>(VT_TESTF, 3.14159f);
   }
+  float testf(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<float>(verifier, VT_TESTF, 3.14159f);
+  }
   bool mutate_testf(float _testf) {
     return SetField<float>(VT_TESTF, _testf, 3.14159f);
   }
   float testf2() const {
     return GetField<float>(VT_TESTF2, 3.0f);
   }
+  float testf2(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<float>(verifier, VT_TESTF2, 3.0f);
+  }
   bool mutate_testf2(float _testf2) {
     return SetField<float>(VT_TESTF2, _testf2, 3.0f);
   }
   float testf3() const {
     return GetField<float>(VT_TESTF3, 0.0f);
   }
+  float testf3(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<float>(verifier, VT_TESTF3, 0.0f);
+  }
   bool mutate_testf3(float _testf3) {
     return SetField<float>(VT_TESTF3, _testf3, 0.0f);
   }
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring2() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING2);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring2(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(verifier, VT_TESTARRAYOFSTRING2);
+  }
   flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_testarrayofstring2() {
     return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING2);
   }
   const flatbuffers::Vector<const Ability *> *testarrayofsortedstruct() const {
     return GetPointer<const flatbuffers::Vector<const Ability *> *>(VT_TESTARRAYOFSORTEDSTRUCT);
   }
+  const flatbuffers::Vector<const Ability *> *testarrayofsortedstruct(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<const Ability *> *>(verifier, VT_TESTARRAYOFSORTEDSTRUCT);
+  }
   flatbuffers::Vector<const Ability *> *mutable_testarrayofsortedstruct() {
     return GetPointer<flatbuffers::Vector<const Ability *> *>(VT_TESTARRAYOFSORTEDSTRUCT);
   }
   const flatbuffers::Vector<uint8_t> *flex() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_FLEX);
   }
+  const flatbuffers::Vector<uint8_t> *flex(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<uint8_t> *>(verifier, VT_FLEX);
+  }
   flatbuffers::Vector<uint8_t> *mutable_flex() {
     return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_FLEX);
   }
@@ -1471,121 +1614,196 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<const Test *> *test5() const {
     return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST5);
   }
+  const flatbuffers::Vector<const Test *> *test5(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<const Test *> *>(verifier, VT_TEST5);
+  }
   flatbuffers::Vector<const Test *> *mutable_test5() {
     return GetPointer<flatbuffers::Vector<const Test *> *>(VT_TEST5);
   }
   const flatbuffers::Vector<int64_t> *vector_of_longs() const {
     return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_VECTOR_OF_LONGS);
   }
+  const flatbuffers::Vector<int64_t> *vector_of_longs(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<int64_t> *>(verifier, VT_VECTOR_OF_LONGS);
+  }
   flatbuffers::Vector<int64_t> *mutable_vector_of_longs() {
     return GetPointer<flatbuffers::Vector<int64_t> *>(VT_VECTOR_OF_LONGS);
   }
   const flatbuffers::Vector<double> *vector_of_doubles() const {
     return GetPointer<const flatbuffers::Vector<double> *>(VT_VECTOR_OF_DOUBLES);
   }
+  const flatbuffers::Vector<double> *vector_of_doubles(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<double> *>(verifier, VT_VECTOR_OF_DOUBLES);
+  }
   flatbuffers::Vector<double> *mutable_vector_of_doubles() {
     return GetPointer<flatbuffers::Vector<double> *>(VT_VECTOR_OF_DOUBLES);
   }
   const MyGame::InParentNamespace *parent_namespace_test() const {
     return GetPointer<const MyGame::InParentNamespace *>(VT_PARENT_NAMESPACE_TEST);
   }
+  const MyGame::InParentNamespace *parent_namespace_test(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const MyGame::InParentNamespace *>(verifier, VT_PARENT_NAMESPACE_TEST);
+  }
   MyGame::InParentNamespace *mutable_parent_namespace_test() {
     return GetPointer<MyGame::InParentNamespace *>(VT_PARENT_NAMESPACE_TEST);
   }
   const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *vector_of_referrables() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *>(VT_VECTOR_OF_REFERRABLES);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *vector_of_referrables(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *>(verifier, VT_VECTOR_OF_REFERRABLES);
+  }
   flatbuffers::Vector<flatbuffers::Offset<Referrable>> *mutable_vector_of_referrables() {
     return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Referrable>> *>(VT_VECTOR_OF_REFERRABLES);
   }
   uint64_t single_weak_reference() const {
     return GetField<uint64_t>(VT_SINGLE_WEAK_REFERENCE, 0);
   }
+  uint64_t single_weak_reference(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint64_t>(verifier, VT_SINGLE_WEAK_REFERENCE, 0);
+  }
   bool mutate_single_weak_reference(uint64_t _single_weak_reference) {
     return SetField<uint64_t>(VT_SINGLE_WEAK_REFERENCE, _single_weak_reference, 0);
   }
   const flatbuffers::Vector<uint64_t> *vector_of_weak_references() const {
     return GetPointer<const flatbuffers::Vector<uint64_t> *>(VT_VECTOR_OF_WEAK_REFERENCES);
   }
+  const flatbuffers::Vector<uint64_t> *vector_of_weak_references(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<uint64_t> *>(verifier, VT_VECTOR_OF_WEAK_REFERENCES);
+  }
   flatbuffers::Vector<uint64_t> *mutable_vector_of_weak_references() {
     return GetPointer<flatbuffers::Vector<uint64_t> *>(VT_VECTOR_OF_WEAK_REFERENCES);
   }
   const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *vector_of_strong_referrables() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *>(VT_VECTOR_OF_STRONG_REFERRABLES);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *vector_of_strong_referrables(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *>(verifier, VT_VECTOR_OF_STRONG_REFERRABLES);
+  }
   flatbuffers::Vector<flatbuffers::Offset<Referrable>> *mutable_vector_of_strong_referrables() {
     return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Referrable>> *>(VT_VECTOR_OF_STRONG_REFERRABLES);
   }
   uint64_t co_owning_reference() const {
     return GetField<uint64_t>(VT_CO_OWNING_REFERENCE, 0);
   }
+  uint64_t co_owning_reference(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint64_t>(verifier, VT_CO_OWNING_REFERENCE, 0);
+  }
   bool mutate_co_owning_reference(uint64_t _co_owning_reference) {
     return SetField<uint64_t>(VT_CO_OWNING_REFERENCE, _co_owning_reference, 0);
   }
   const flatbuffers::Vector<uint64_t> *vector_of_co_owning_references() const {
     return GetPointer<const flatbuffers::Vector<uint64_t> *>(VT_VECTOR_OF_CO_OWNING_REFERENCES);
   }
+  const flatbuffers::Vector<uint64_t> *vector_of_co_owning_references(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<uint64_t> *>(verifier, VT_VECTOR_OF_CO_OWNING_REFERENCES);
+  }
   flatbuffers::Vector<uint64_t> *mutable_vector_of_co_owning_references() {
     return GetPointer<flatbuffers::Vector<uint64_t> *>(VT_VECTOR_OF_CO_OWNING_REFERENCES);
   }
   uint64_t non_owning_reference() const {
     return GetField<uint64_t>(VT_NON_OWNING_REFERENCE, 0);
   }
+  uint64_t non_owning_reference(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint64_t>(verifier, VT_NON_OWNING_REFERENCE, 0);
+  }
   bool mutate_non_owning_reference(uint64_t _non_owning_reference) {
     return SetField<uint64_t>(VT_NON_OWNING_REFERENCE, _non_owning_reference, 0);
   }
   const flatbuffers::Vector<uint64_t> *vector_of_non_owning_references() const {
     return GetPointer<const flatbuffers::Vector<uint64_t> *>(VT_VECTOR_OF_NON_OWNING_REFERENCES);
   }
+  const flatbuffers::Vector<uint64_t> *vector_of_non_owning_references(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<uint64_t> *>(verifier, VT_VECTOR_OF_NON_OWNING_REFERENCES);
+  }
   flatbuffers::Vector<uint64_t> *mutable_vector_of_non_owning_references() {
     return GetPointer<flatbuffers::Vector<uint64_t> *>(VT_VECTOR_OF_NON_OWNING_REFERENCES);
   }
   AnyUniqueAliases any_unique_type() const {
     return static_cast<AnyUniqueAliases>(GetField<uint8_t>(VT_ANY_UNIQUE_TYPE, 0));
   }
+  AnyUniqueAliases any_unique_type(const flatbuffers::Verifier &verifier) const {
+    return static_cast<AnyUniqueAliases>(GetFieldChecked<uint8_t>(verifier, VT_ANY_UNIQUE_TYPE, 0));
+  }
   bool mutate_any_unique_type(AnyUniqueAliases _any_unique_type) {
     return SetField<uint8_t>(VT_ANY_UNIQUE_TYPE, static_cast<uint8_t>(_any_unique_type), 0);
   }
   const void *any_unique() const {
     return GetPointer<const void *>(VT_ANY_UNIQUE);
   }
+  const void *any_unique(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const void *>(verifier, VT_ANY_UNIQUE);
+  }
   template<typename T> const T *any_unique_as() const;
   const Monster *any_unique_as_M() const {
     return any_unique_type() == AnyUniqueAliases_M ? static_cast<const Monster *>(any_unique()) : nullptr;
   }
+  const Monster *any_unique_as_M(const flatbuffers::Verifier &verifier) const {
+    auto p = any_unique_type(verifier) == AnyUniqueAliases_M ? static_cast<const Monster *>(any_unique(verifier)) : nullptr;
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
   const TestSimpleTableWithEnum *any_unique_as_T() const {
     return any_unique_type() == AnyUniqueAliases_T ? static_cast<const TestSimpleTableWithEnum *>(any_unique()) : nullptr;
   }
+  const TestSimpleTableWithEnum *any_unique_as_T(const flatbuffers::Verifier &verifier) const {
+    auto p = any_unique_type(verifier) == AnyUniqueAliases_T ? static_cast<const TestSimpleTableWithEnum *>(any_unique(verifier)) : nullptr;
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
   const MyGame::Example2::Monster *any_unique_as_M2() const {
     return any_unique_type() == AnyUniqueAliases_M2 ? static_cast<const MyGame::Example2::Monster *>(any_unique()) : nullptr;
   }
+  const MyGame::Example2::Monster *any_unique_as_M2(const flatbuffers::Verifier &verifier) const {
+    auto p = any_unique_type(verifier) == AnyUniqueAliases_M2 ? static_cast<const MyGame::Example2::Monster *>(any_unique(verifier)) : nullptr;
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
   void *mutable_any_unique() {
     return GetPointer<void *>(VT_ANY_UNIQUE);
   }
   AnyAmbiguousAliases any_ambiguous_type() const {
     return static_cast<AnyAmbiguousAliases>(GetField<uint8_t>(VT_ANY_AMBIGUOUS_TYPE, 0));
   }
+  AnyAmbiguousAliases any_ambiguous_type(const flatbuffers::Verifier &verifier) const {
+    return static_cast<AnyAmbiguousAliases>(GetFieldChecked<uint8_t>(verifier, VT_ANY_AMBIGUOUS_TYPE, 0));
+  }
   bool mutate_any_ambiguous_type(AnyAmbiguousAliases _any_ambiguous_type) {
     return SetField<uint8_t>(VT_ANY_AMBIGUOUS_TYPE, static_cast<uint8_t>(_any_ambiguous_type), 0);
   }
   const void *any_ambiguous() const {
     return GetPointer<const void *>(VT_ANY_AMBIGUOUS);
   }
+  const void *any_ambiguous(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const void *>(verifier, VT_ANY_AMBIGUOUS);
+  }
   const Monster *any_ambiguous_as_M1() const {
     return any_ambiguous_type() == AnyAmbiguousAliases_M1 ? static_cast<const Monster *>(any_ambiguous()) : nullptr;
   }
+  const Monster *any_ambiguous_as_M1(const flatbuffers::Verifier &verifier) const {
+    auto p = any_ambiguous_type(verifier) == AnyAmbiguousAliases_M1 ? static_cast<const Monster *>(any_ambiguous(verifier)) : nullptr;
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
   const Monster *any_ambiguous_as_M2() const {
     return any_ambiguous_type() == AnyAmbiguousAliases_M2 ? static_cast<const Monster *>(any_ambiguous()) : nullptr;
   }
+  const Monster *any_ambiguous_as_M2(const flatbuffers::Verifier &verifier) const {
+    auto p = any_ambiguous_type(verifier) == AnyAmbiguousAliases_M2 ? static_cast<const Monster *>(any_ambiguous(verifier)) : nullptr;
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
   const Monster *any_ambiguous_as_M3() const {
     return any_ambiguous_type() == AnyAmbiguousAliases_M3 ? static_cast<const Monster *>(any_ambiguous()) : nullptr;
   }
+  const Monster *any_ambiguous_as_M3(const flatbuffers::Verifier &verifier) const {
+    auto p = any_ambiguous_type(verifier) == AnyAmbiguousAliases_M3 ? static_cast<const Monster *>(any_ambiguous(verifier)) : nullptr;
+    return verifier.VerifyShallow(p) ? p : nullptr;
+  }
   void *mutable_any_ambiguous() {
     return GetPointer<void *>(VT_ANY_AMBIGUOUS);
   }
   const flatbuffers::Vector<int8_t> *vector_of_enums() const {
     return GetPointer<const flatbuffers::Vector<int8_t> *>(VT_VECTOR_OF_ENUMS);
   }
+  const flatbuffers::Vector<int8_t> *vector_of_enums(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<int8_t> *>(verifier, VT_VECTOR_OF_ENUMS);
+  }
   flatbuffers::Vector<int8_t> *mutable_vector_of_enums() {
     return GetPointer<flatbuffers::Vector<int8_t> *>(VT_VECTOR_OF_ENUMS);
   }
@@ -1905,6 +2123,104 @@ inline flatbuffers::Offset<Monster> CreateMonster(
     AnyAmbiguousAliases any_ambiguous_type = AnyAmbiguousAliases_NONE,
     flatbuffers::Offset<void> any_ambiguous = 0,
     flatbuffers::Offset<flatbuffers::Vector<int8_t>> vector_of_enums = 0) {
+  if (pos &&
+      !flatbuffers::IsTheSameAs<int16_t>(mana, 150) &&
+      !flatbuffers::IsTheSameAs<int16_t>(hp, 100) &&
+      name.o &&
+      inventory.o &&
+      !flatbuffers::IsTheSameAs<int8_t>(static_cast<int8_t>(color), 8) &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(test_type), 0) &&
+      test.o &&
+      test4.o &&
+      testarrayofstring.o &&
+      testarrayoftables.o &&
+      enemy.o &&
+      testnestedflatbuffer.o &&
+      testempty.o &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(testbool), 0) &&
+      !flatbuffers::IsTheSameAs<int32_t>(testhashs32_fnv1, 0) &&
+      !flatbuffers::IsTheSameAs<uint32_t>(testhashu32_fnv1, 0) &&
+      !flatbuffers::IsTheSameAs<int64_t>(testhashs64_fnv1, 0) &&
+      !flatbuffers::IsTheSameAs<uint64_t>(testhashu64_fnv1, 0) &&
+      !flatbuffers::IsTheSameAs<int32_t>(testhashs32_fnv1a, 0) &&
+      !flatbuffers::IsTheSameAs<uint32_t>(testhashu32_fnv1a, 0) &&
+      !flatbuffers::IsTheSameAs<int64_t>(testhashs64_fnv1a, 0) &&
+      !flatbuffers::IsTheSameAs<uint64_t>(testhashu64_fnv1a, 0) &&
+      testarrayofbools.o &&
+      !flatbuffers::IsTheSameAs<float>(testf, 3.14159f) &&
+      !flatbuffers::IsTheSameAs<float>(testf2, 3.0f) &&
+      !flatbuffers::IsTheSameAs<float>(testf3, 0.0f) &&
+      testarrayofstring2.o &&
+      testarrayofsortedstruct.o &&
+      flex.o &&
+      test5.o &&
+      vector_of_longs.o &&
+      vector_of_doubles.o &&
+      parent_namespace_test.o &&
+      vector_of_referrables.o &&
+      !flatbuffers::IsTheSameAs<uint64_t>(single_weak_reference, 0) &&
+      vector_of_weak_references.o &&
+      vector_of_strong_referrables.o &&
+      !flatbuffers::IsTheSameAs<uint64_t>(co_owning_reference, 0) &&
+      vector_of_co_owning_references.o &&
+      !flatbuffers::IsTheSameAs<uint64_t>(non_owning_reference, 0) &&
+      vector_of_non_owning_references.o &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(any_unique_type), 0) &&
+      any_unique.o &&
+      !flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(any_ambiguous_type), 0) &&
+      any_ambiguous.o &&
+      vector_of_enums.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 100, 229, 8, 220, 222, 4, 0, 96, 224, 225, 100, 104, 108, 112, 116, 120, 124, 226, 128, 132, 40, 48, 136, 140, 56, 64, 144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188, 72, 192, 196, 80, 200, 88, 204, 227, 208, 228, 212, 216 };
+    auto table_ = _fbb.StartFixedTable(229, 8);
+    memcpy(table_ + 8, pos, sizeof(*pos));
+    flatbuffers::WriteScalar<int16_t>(table_ + 220, mana);
+    flatbuffers::WriteScalar<int16_t>(table_ + 222, hp);
+    _fbb.AddFixedOffset(table_, 4, name);
+    _fbb.AddFixedOffset(table_, 96, inventory);
+    flatbuffers::WriteScalar<int8_t>(table_ + 224, static_cast<int8_t>(color));
+    flatbuffers::WriteScalar<uint8_t>(table_ + 225, static_cast<uint8_t>(test_type));
+    _fbb.AddFixedOffset(table_, 100, test);
+    _fbb.AddFixedOffset(table_, 104, test4);
+    _fbb.AddFixedOffset(table_, 108, testarrayofstring);
+    _fbb.AddFixedOffset(table_, 112, testarrayoftables);
+    _fbb.AddFixedOffset(table_, 116, enemy);
+    _fbb.AddFixedOffset(table_, 120, testnestedflatbuffer);
+    _fbb.AddFixedOffset(table_, 124, testempty);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 226, static_cast<uint8_t>(testbool));
+    flatbuffers::WriteScalar<int32_t>(table_ + 128, testhashs32_fnv1);
+    flatbuffers::WriteScalar<uint32_t>(table_ + 132, testhashu32_fnv1);
+    flatbuffers::WriteScalar<int64_t>(table_ + 40, testhashs64_fnv1);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 48, testhashu64_fnv1);
+    flatbuffers::WriteScalar<int32_t>(table_ + 136, testhashs32_fnv1a);
+    flatbuffers::WriteScalar<uint32_t>(table_ + 140, testhashu32_fnv1a);
+    flatbuffers::WriteScalar<int64_t>(table_ + 56, testhashs64_fnv1a);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 64, testhashu64_fnv1a);
+    _fbb.AddFixedOffset(table_, 144, testarrayofbools);
+    flatbuffers::WriteScalar<float>(table_ + 148, testf);
+    flatbuffers::WriteScalar<float>(table_ + 152, testf2);
+    flatbuffers::WriteScalar<float>(table_ + 156, testf3);
+    _fbb.AddFixedOffset(table_, 160, testarrayofstring2);
+    _fbb.AddFixedOffset(table_, 164, testarrayofsortedstruct);
+    _fbb.AddFixedOffset(table_, 168, flex);
+    _fbb.AddFixedOffset(table_, 172, test5);
+    _fbb.AddFixedOffset(table_, 176, vector_of_longs);
+    _fbb.AddFixedOffset(table_, 180, vector_of_doubles);
+    _fbb.AddFixedOffset(table_, 184, parent_namespace_test);
+    _fbb.AddFixedOffset(table_, 188, vector_of_referrables);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 72, single_weak_reference);
+    _fbb.AddFixedOffset(table_, 192, vector_of_weak_references);
+    _fbb.AddFixedOffset(table_, 196, vector_of_strong_referrables);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 80, co_owning_reference);
+    _fbb.AddFixedOffset(table_, 200, vector_of_co_owning_references);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 88, non_owning_reference);
+    _fbb.AddFixedOffset(table_, 204, vector_of_non_owning_references);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 227, static_cast<uint8_t>(any_unique_type));
+    _fbb.AddFixedOffset(table_, 208, any_unique);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 228, static_cast<uint8_t>(any_ambiguous_type));
+    _fbb.AddFixedOffset(table_, 212, any_ambiguous);
+    _fbb.AddFixedOffset(table_, 216, vector_of_enums);
+    return flatbuffers::Offset<Monster>(_fbb.EndFixedTable(vtable_));
+  }
   MonsterBuilder builder_(_fbb);
   builder_.add_non_owning_reference(non_owning_reference);
   builder_.add_co_owning_reference(co_owning_reference);
@@ -2148,72 +2464,108 @@ struct TypeAliases FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int8_t i8() const {
     return GetField<int8_t>(VT_I8, 0);
   }
+  int8_t i8(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int8_t>(verifier, VT_I8, 0);
+  }
   bool mutate_i8(int8_t _i8) {
     return SetField<int8_t>(VT_I8, _i8, 0);
   }
   uint8_t u8() const {
     return GetField<uint8_t>(VT_U8, 0);
   }
+  uint8_t u8(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint8_t>(verifier, VT_U8, 0);
+  }
   bool mutate_u8(uint8_t _u8) {
     return SetField<uint8_t>(VT_U8, _u8, 0);
   }
   int16_t i16() const {
     return GetField<int16_t>(VT_I16, 0);
   }
+  int16_t i16(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int16_t>(verifier, VT_I16, 0);
+  }
   bool mutate_i16(int16_t _i16) {
     return SetField<int16_t>(VT_I16, _i16, 0);
   }
   uint16_t u16() const {
     return GetField<uint16_t>(VT_U16, 0);
   }
+  uint16_t u16(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint16_t>(verifier, VT_U16, 0);
+  }
   bool mutate_u16(uint16_t _u16) {
     return SetField<uint16_t>(VT_U16, _u16, 0);
   }
   int32_t i32() const {
     return GetField<int32_t>(VT_I32, 0);
   }
+  int32_t i32(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int32_t>(verifier, VT_I32, 0);
+  }
   bool mutate_i32(int32_t _i32) {
     return SetField<int32_t>(VT_I32, _i32, 0);
   }
   uint32_t u32() const {
     return GetField<uint32_t>(VT_U32, 0);
   }
+  uint32_t u32(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint32_t>(verifier, VT_U32, 0);
+  }
   bool mutate_u32(uint32_t _u32) {
     return SetField<uint32_t>(VT_U32, _u32, 0);
   }
   int64_t i64() const {
     return GetField<int64_t>(VT_I64, 0);
   }
+  int64_t i64(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<int64_t>(verifier, VT_I64, 0);
+  }
   bool mutate_i64(int64_t _i64) {
     return SetField<int64_t>(VT_I64, _i64, 0);
   }
   uint64_t u64() const {
     return GetField<uint64_t>(VT_U64, 0);
   }
+  uint64_t u64(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<uint64_t>(verifier, VT_U64, 0);
+  }
   bool mutate_u64(uint64_t _u64) {
     return SetField<uint64_t>(VT_U64, _u64, 0);
   }
   float f32() const {
     return GetField<float>(VT_F32, 0.0f);
   }
+  float f32(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<float>(verifier, VT_F32, 0.0f);
+  }
   bool mutate_f32(float _f32) {
     return SetField<float>(VT_F32, _f32, 0.0f);
   }
   double f64() const {
     return GetField<double>(VT_F64, 0.0);
   }
+  double f64(const flatbuffers::Verifier &verifier) const {
+    return GetFieldChecked<double>(verifier, VT_F64, 0.0);
+  }
   bool mutate_f64(double _f64) {
     return SetField<double>(VT_F64, _f64, 0.0);
   }
   const flatbuffers::Vector<int8_t> *v8() const {
     return GetPointer<const flatbuffers::Vector<int8_t> *>(VT_V8);
   }
+  const flatbuffers::Vector<int8_t> *v8(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<int8_t> *>(verifier, VT_V8);
+  }
   flatbuffers::Vector<int8_t> *mutable_v8() {
     return GetPointer<flatbuffers::Vector<int8_t> *>(VT_V8);
   }
   const flatbuffers::Vector<double> *vf64() const {
     return GetPointer<const flatbuffers::Vector<double> *>(VT_VF64);
   }
+  const flatbuffers::Vector<double> *vf64(const flatbuffers::Verifier &verifier) const {
+    return GetPointerChecked<const flatbuffers::Vector<double> *>(verifier, VT_VF64);
+  }
   flatbuffers::Vector<double> *mutable_vf64() {
     return GetPointer<flatbuffers::Vector<double> *>(VT_VF64);
   }
@@ -2305,6 +2657,34 @@ inline flatbuffers::Offset<TypeAliases> CreateTypeAliases(
     double f64 = 0.0,
     flatbuffers::Offset<flatbuffers::Vector<int8_t>> v8 = 0,
     flatbuffers::Offset<flatbuffers::Vector<double>> vf64 = 0) {
+  if (!flatbuffers::IsTheSameAs<int8_t>(i8, 0) &&
+      !flatbuffers::IsTheSameAs<uint8_t>(u8, 0) &&
+      !flatbuffers::IsTheSameAs<int16_t>(i16, 0) &&
+      !flatbuffers::IsTheSameAs<uint16_t>(u16, 0) &&
+      !flatbuffers::IsTheSameAs<int32_t>(i32, 0) &&
+      !flatbuffers::IsTheSameAs<uint32_t>(u32, 0) &&
+      !flatbuffers::IsTheSameAs<int64_t>(i64, 0) &&
+      !flatbuffers::IsTheSameAs<uint64_t>(u64, 0) &&
+      !flatbuffers::IsTheSameAs<float>(f32, 0.0f) &&
+      !flatbuffers::IsTheSameAs<double>(f64, 0.0) &&
+      v8.o &&
+      vf64.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 28, 54, 52, 53, 48, 50, 4, 32, 8, 16, 36, 24, 40, 44 };
+    auto table_ = _fbb.StartFixedTable(54, 8);
+    flatbuffers::WriteScalar<int8_t>(table_ + 52, i8);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 53, u8);
+    flatbuffers::WriteScalar<int16_t>(table_ + 48, i16);
+    flatbuffers::WriteScalar<uint16_t>(table_ + 50, u16);
+    flatbuffers::WriteScalar<int32_t>(table_ + 4, i32);
+    flatbuffers::WriteScalar<uint32_t>(table_ + 32, u32);
+    flatbuffers::WriteScalar<int64_t>(table_ + 8, i64);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 16, u64);
+    flatbuffers::WriteScalar<float>(table_ + 36, f32);
+    flatbuffers::WriteScalar<double>(table_ + 24, f64);
+    _fbb.AddFixedOffset(table_, 40, v8);
+    _fbb.AddFixedOffset(table_, 44, vf64);
+    return flatbuffers::Offset<TypeAliases>(_fbb.EndFixedTable(vtable_));
+  }
   TypeAliasesBuilder builder_(_fbb);
   builder_.add_f64(f64);
   builder_.add_u64(u64);
@@ -2444,7 +2824,7 @@ inline StatT *Stat::UnPack(const flatbuffers::resolver_function_t *_resolver) co
 inline void Stat::UnPackTo(StatT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = id(); if (_e) _o->id = _e->str(); };
+  { auto _e = id(); if (_e) { _o->id.assign(_e->c_str(), _e->size()); } else _o->id.clear(); };
   { auto _e = val(); _o->val = _e; };
   { auto _e = count(); _o->count = _e; };
 }
@@ -2502,20 +2882,19 @@ inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolv
 inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = pos(); if (_e) _o->pos = flatbuffers::unique_ptr<Vec3>(new Vec3(*_e)); };
+  { auto _e = pos(); if (_e) { if (_o->pos) *_o->pos = *_e; else _o->pos = flatbuffers::unique_ptr<Vec3>(new Vec3(*_e)); } else _o->pos.reset(); };
   { auto _e = mana(); _o->mana = _e; };
   { auto _e = hp(); _o->hp = _e; };
-  { auto _e = name(); if (_e) _o->name = _e->str(); };
-  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->inventory[_i] = _e->Get(_i); } } };
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else _o->name.clear(); };
+  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->inventory[_i] = _e->Get(_i); } } else _o->inventory.clear(); };
   { auto _e = color(); _o->color = _e; };
-  { auto _e = test_type(); _o->test.type = _e; };
-  { auto _e = test(); if (_e) _o->test.value = AnyUnion::UnPack(_e, test_type(), _resolver); };
-  { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test4[_i] = *_e->Get(_i); } } };
-  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i] = _e->Get(_i)->str(); } } };
-  { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayoftables[_i] = flatbuffers::unique_ptr<MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } };
-  { auto _e = enemy(); if (_e) _o->enemy = flatbuffers::unique_ptr<MonsterT>(_e->UnPack(_resolver)); };
-  { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testnestedflatbuffer[_i] = _e->Get(_i); } } };
-  { auto _e = testempty(); if (_e) _o->testempty = flatbuffers::unique_ptr<StatT>(_e->UnPack(_resolver)); };
+  { auto _e = test(); _o->test.UnPackFrom(_e, test_type(), _resolver); };
+  { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test4[_i] = *_e->Get(_i); } } else _o->test4.clear(); };
+  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->testarrayofstring.clear(); };
+  { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->testarrayoftables[_i]) _e->Get(_i)->UnPackTo(_o->testarrayoftables[_i].get(), _resolver); else _o->testarrayoftables[_i] = flatbuffers::unique_ptr<MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->testarrayoftables.clear(); };
+  { auto _e = enemy(); if (_e) { if (_o->enemy) _e->UnPackTo(_o->enemy.get(), _resolver); else _o->enemy = flatbuffers::unique_ptr<MonsterT>(_e->UnPack(_resolver)); } else _o->enemy.reset(); };
+  { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testnestedflatbuffer[_i] = _e->Get(_i); } } else _o->testnestedflatbuffer.clear(); };
+  { auto _e = testempty(); if (_e) { if (_o->testempty) _e->UnPackTo(_o->testempty.get(), _resolver); else _o->testempty = flatbuffers::unique_ptr<StatT>(_e->UnPack(_resolver)); } else _o->testempty.reset(); };
   { auto _e = testbool(); _o->testbool = _e; };
   { auto _e = testhashs32_fnv1(); _o->testhashs32_fnv1 = _e; };
   { auto _e = testhashu32_fnv1(); _o->testhashu32_fnv1 = _e; };
@@ -2526,36 +2905,34 @@ inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->testhashu32_fnv1a), static_cast<flatbuffers::hash_value_t>(_e)); else _o->testhashu32_fnv1a = nullptr; };
   { auto _e = testhashs64_fnv1a(); _o->testhashs64_fnv1a = _e; };
   { auto _e = testhashu64_fnv1a(); _o->testhashu64_fnv1a = _e; };
-  { auto _e = testarrayofbools(); if (_e) { _o->testarrayofbools.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofbools[_i] = _e->Get(_i) != 0; } } };
+  { auto _e = testarrayofbools(); if (_e) { _o->testarrayofbools.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofbools[_i] = _e->Get(_i) != 0; } } else _o->testarrayofbools.clear(); };
   { auto _e = testf(); _o->testf = _e; };
   { auto _e = testf2(); _o->testf2 = _e; };
   { auto _e = testf3(); _o->testf3 = _e; };
-  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i] = _e->Get(_i)->str(); } } };
-  { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofsortedstruct[_i] = *_e->Get(_i); } } };
-  { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->flex[_i] = _e->Get(_i); } } };
-  { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test5[_i] = *_e->Get(_i); } } };
-  { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_longs[_i] = _e->Get(_i); } } };
-  { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_doubles[_i] = _e->Get(_i); } } };
-  { auto _e = parent_namespace_test(); if (_e) _o->parent_namespace_test = flatbuffers::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); };
-  { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_referrables[_i] = flatbuffers::unique_ptr<ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } };
+  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->testarrayofstring2.clear(); };
+  { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofsortedstruct[_i] = *_e->Get(_i); } } else _o->testarrayofsortedstruct.clear(); };
+  { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->flex[_i] = _e->Get(_i); } } else _o->flex.clear(); };
+  { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test5[_i] = *_e->Get(_i); } } else _o->test5.clear(); };
+  { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_longs[_i] = _e->Get(_i); } } else _o->vector_of_longs.clear(); };
+  { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_doubles[_i] = _e->Get(_i); } } else _o->vector_of_doubles.clear(); };
+  { auto _e = parent_namespace_test(); if (_e) { if (_o->parent_namespace_test) _e->UnPackTo(_o->parent_namespace_test.get(), _resolver); else _o->parent_namespace_test = flatbuffers::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); } else _o->parent_namespace_test.reset(); };
+  { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_referrables[_i]) _e->Get(_i)->UnPackTo(_o->vector_of_referrables[_i].get(), _resolver); else _o->vector_of_referrables[_i] = flatbuffers::unique_ptr<ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->vector_of_referrables.clear(); };
   { auto _e = single_weak_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->single_weak_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->single_weak_reference = nullptr; };
   { auto _e = vector_of_weak_references(); if (_e) { _o->vector_of_weak_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_weak_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_weak_references[_i] = nullptr; } } };
-  { auto _e = vector_of_strong_referrables(); if (_e) { _o->vector_of_strong_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_strong_referrables[_i] = flatbuffers::unique_ptr<ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } };
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_weak_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_weak_references[_i] = nullptr; } } else _o->vector_of_weak_references.clear(); };
+  { auto _e = vector_of_strong_referrables(); if (_e) { _o->vector_of_strong_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_strong_referrables[_i]) _e->Get(_i)->UnPackTo(_o->vector_of_strong_referrables[_i].get(), _resolver); else _o->vector_of_strong_referrables[_i] = flatbuffers::unique_ptr<ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->vector_of_strong_referrables.clear(); };
   { auto _e = co_owning_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->co_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->co_owning_reference = nullptr; };
   { auto _e = vector_of_co_owning_references(); if (_e) { _o->vector_of_co_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, default_ptr_type
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */; } } };
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */; } } else _o->vector_of_co_owning_references.clear(); };
   { auto _e = non_owning_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->non_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->non_owning_reference = nullptr; };
   { auto _e = vector_of_non_owning_references(); if (_e) { _o->vector_of_non_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } };
-  { auto _e = any_unique_type(); _o->any_unique.type = _e; };
-  { auto _e = any_unique(); if (_e) _o->any_unique.value = AnyUniqueAliasesUnion::UnPack(_e, any_unique_type(), _resolver); };
-  { auto _e = any_ambiguous_type(); _o->any_ambiguous.type = _e; };
-  { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.value = AnyAmbiguousAliasesUnion::UnPack(_e, any_ambiguous_type(), _resolver); };
-  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_enums[_i] = static_cast<Color>(_e->Get(_i)); } } };
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } else _o->vector_of_non_owning_references.clear(); };
+  { auto _e = any_unique(); _o->any_unique.UnPackFrom(_e, any_unique_type(), _resolver); };
+  { auto _e = any_ambiguous(); _o->any_ambiguous.UnPackFrom(_e, any_ambiguous_type(), _resolver); };
+  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_enums[_i] = static_cast<Color>(_e->Get(_i)); } } else _o->vector_of_enums.clear(); };
 }
 
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -2683,8 +3060,8 @@ inline void TypeAliases::UnPackTo(TypeAliasesT *_o, const flatbuffers::resolver_
   { auto _e = u64(); _o->u64 = _e; };
   { auto _e = f32(); _o->f32 = _e; };
   { auto _e = f64(); _o->f64 = _e; };
-  { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->v8[_i] = _e->Get(_i); } } };
-  { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vf64[_i] = _e->Get(_i); } } };
+  { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->v8[_i] = _e->Get(_i); } } else _o->v8.clear(); };
+  { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vf64[_i] = _e->Get(_i); } } else _o->vf64.clear(); };
 }
 
 inline flatbuffers::Offset<TypeAliases> TypeAliases::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -2774,6 +3151,35 @@ inline void *AnyUnion::UnPack(const void *obj, Any type, const flatbuffers::reso
   }
 }
 
+inline void AnyUnion::UnPackFrom(const void *obj, Any _type, const flatbuffers::resolver_function_t *resolver) {
+  if (obj && value && _type == type) {
+    switch (type) {
+      case Any_Monster: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        auto _o = reinterpret_cast<MonsterT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      case Any_TestSimpleTableWithEnum: {
+        auto ptr = reinterpret_cast<const TestSimpleTableWithEnum *>(obj);
+        auto _o = reinterpret_cast<TestSimpleTableWithEnumT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      case Any_MyGame_Example2_Monster: {
+        auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+        auto _o = reinterpret_cast<MyGame::Example2::MonsterT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  if (obj) value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> AnyUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Any_Monster: {
@@ -2885,6 +3291,35 @@ inline void *AnyUniqueAliasesUnion::UnPack(const void *obj, AnyUniqueAliases typ
   }
 }
 
+inline void AnyUniqueAliasesUnion::UnPackFrom(const void *obj, AnyUniqueAliases _type, const flatbuffers::resolver_function_t *resolver) {
+  if (obj && value && _type == type) {
+    switch (type) {
+      case AnyUniqueAliases_M: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        auto _o = reinterpret_cast<MonsterT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      case AnyUniqueAliases_T: {
+        auto ptr = reinterpret_cast<const TestSimpleTableWithEnum *>(obj);
+        auto _o = reinterpret_cast<TestSimpleTableWithEnumT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      case AnyUniqueAliases_M2: {
+        auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+        auto _o = reinterpret_cast<MyGame::Example2::MonsterT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  if (obj) value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> AnyUniqueAliasesUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case AnyUniqueAliases_M: {
@@ -2996,6 +3431,35 @@ inline void *AnyAmbiguousAliasesUnion::UnPack(const void *obj, AnyAmbiguousAlias
   }
 }
 
+inline void AnyAmbiguousAliasesUnion::UnPackFrom(const void *obj, AnyAmbiguousAliases _type, const flatbuffers::resolver_function_t *resolver) {
+  if (obj && value && _type == type) {
+    switch (type) {
+      case AnyAmbiguousAliases_M1: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        auto _o = reinterpret_cast<MonsterT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      case AnyAmbiguousAliases_M2: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        auto _o = reinterpret_cast<MonsterT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      case AnyAmbiguousAliases_M3: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        auto _o = reinterpret_cast<MonsterT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  if (obj) value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> AnyAmbiguousAliasesUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case AnyAmbiguousAliases_M1: {
@@ -3056,6 +3520,1390 @@ inline void AnyAmbiguousAliasesUnion::Reset() {
   type = AnyAmbiguousAliases_NONE;
 }
 
+inline void ToJson(Color _e, flatbuffers::JsonWriter &_writer) {
+  switch (_e) {
+    case Color_Red: _writer.Enum("Red"); break;
+    case Color_Green: _writer.Enum("Green"); break;
+    case Color_Blue: _writer.Enum("Blue"); break;
+    default: _writer.Number(static_cast<int8_t>(_e)); break;
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Color *_e) {
+  static const char * const names[] = {
+    "Red",
+    "Green",
+    "Blue"
+  };
+  static const int8_t values[] = {
+    1,
+    2,
+    8
+  };
+  int8_t _v = 0;
+  if (!_reader.Enum(&_v, names, values, 3)) return false;
+  *_e = static_cast<Color>(_v);
+  return true;
+}
+
+inline void ToJson(Any _e, flatbuffers::JsonWriter &_writer) {
+  switch (_e) {
+    case Any_NONE: _writer.Enum("NONE"); break;
+    case Any_Monster: _writer.Enum("Monster"); break;
+    case Any_TestSimpleTableWithEnum: _writer.Enum("TestSimpleTableWithEnum"); break;
+    case Any_MyGame_Example2_Monster: _writer.Enum("MyGame_Example2_Monster"); break;
+    default: _writer.Number(static_cast<uint8_t>(_e)); break;
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Any *_e) {
+  static const char * const names[] = {
+    "NONE",
+    "Monster",
+    "TestSimpleTableWithEnum",
+    "MyGame_Example2_Monster"
+  };
+  static const uint8_t values[] = {
+    0,
+    1,
+    2,
+    3
+  };
+  uint8_t _v = 0;
+  if (!_reader.Enum(&_v, names, values, 4)) return false;
+  *_e = static_cast<Any>(_v);
+  return true;
+}
+
+inline void ToJson(AnyUniqueAliases _e, flatbuffers::JsonWriter &_writer) {
+  switch (_e) {
+    case AnyUniqueAliases_NONE: _writer.Enum("NONE"); break;
+    case AnyUniqueAliases_M: _writer.Enum("M"); break;
+    case AnyUniqueAliases_T: _writer.Enum("T"); break;
+    case AnyUniqueAliases_M2: _writer.Enum("M2"); break;
+    default: _writer.Number(static_cast<uint8_t>(_e)); break;
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, AnyUniqueAliases *_e) {
+  static const char * const names[] = {
+    "NONE",
+    "M",
+    "T",
+    "M2"
+  };
+  static const uint8_t values[] = {
+    0,
+    1,
+    2,
+    3
+  };
+  uint8_t _v = 0;
+  if (!_reader.Enum(&_v, names, values, 4)) return false;
+  *_e = static_cast<AnyUniqueAliases>(_v);
+  return true;
+}
+
+inline void ToJson(AnyAmbiguousAliases _e, flatbuffers::JsonWriter &_writer) {
+  switch (_e) {
+    case AnyAmbiguousAliases_NONE: _writer.Enum("NONE"); break;
+    case AnyAmbiguousAliases_M1: _writer.Enum("M1"); break;
+    case AnyAmbiguousAliases_M2: _writer.Enum("M2"); break;
+    case AnyAmbiguousAliases_M3: _writer.Enum("M3"); break;
+    default: _writer.Number(static_cast<uint8_t>(_e)); break;
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, AnyAmbiguousAliases *_e) {
+  static const char * const names[] = {
+    "NONE",
+    "M1",
+    "M2",
+    "M3"
+  };
+  static const uint8_t values[] = {
+    0,
+    1,
+    2,
+    3
+  };
+  uint8_t _v = 0;
+  if (!_reader.Enum(&_v, names, values, 4)) return false;
+  *_e = static_cast<AnyAmbiguousAliases>(_v);
+  return true;
+}
+
+}  // namespace Example
+
+inline bool ToJson(const InParentNamespace *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<InParentNamespace> *_o);
+namespace Example2 {
+
+inline bool ToJson(const Monster *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_o);
+}  // namespace Example2
+
+namespace Example {
+
+inline bool ToJson(const Test *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, Test *_o);
+inline bool ToJson(const TestSimpleTableWithEnum *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TestSimpleTableWithEnum> *_o);
+inline bool ToJson(const Vec3 *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, Vec3 *_o);
+inline bool ToJson(const Ability *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, Ability *_o);
+inline bool ToJson(const Stat *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Stat> *_o);
+inline bool ToJson(const Referrable *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Referrable> *_o);
+inline bool ToJson(const Monster *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_o);
+inline bool ToJson(const TypeAliases *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TypeAliases> *_o);
+
+inline bool ToJson(Any _type, const void *_obj, flatbuffers::JsonWriter &_writer) {
+  switch (_type) {
+    case Any_Monster:
+      return ToJson(reinterpret_cast<const Monster *>(_obj), _writer);
+    case Any_TestSimpleTableWithEnum:
+      return ToJson(reinterpret_cast<const TestSimpleTableWithEnum *>(_obj), _writer);
+    case Any_MyGame_Example2_Monster:
+      return ToJson(reinterpret_cast<const MyGame::Example2::Monster *>(_obj), _writer);
+    default: return false;
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, Any _type, flatbuffers::Offset<void> *_o) {
+  switch (_type) {
+    case Any_Monster: {
+      flatbuffers::Offset<Monster> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    case Any_TestSimpleTableWithEnum: {
+      flatbuffers::Offset<TestSimpleTableWithEnum> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    case Any_MyGame_Example2_Monster: {
+      flatbuffers::Offset<MyGame::Example2::Monster> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    default:
+      return _reader.Error("illegal type id for union: Any");
+  }
+}
+
+inline bool ToJson(AnyUniqueAliases _type, const void *_obj, flatbuffers::JsonWriter &_writer) {
+  switch (_type) {
+    case AnyUniqueAliases_M:
+      return ToJson(reinterpret_cast<const Monster *>(_obj), _writer);
+    case AnyUniqueAliases_T:
+      return ToJson(reinterpret_cast<const TestSimpleTableWithEnum *>(_obj), _writer);
+    case AnyUniqueAliases_M2:
+      return ToJson(reinterpret_cast<const MyGame::Example2::Monster *>(_obj), _writer);
+    default: return false;
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, AnyUniqueAliases _type, flatbuffers::Offset<void> *_o) {
+  switch (_type) {
+    case AnyUniqueAliases_M: {
+      flatbuffers::Offset<Monster> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    case AnyUniqueAliases_T: {
+      flatbuffers::Offset<TestSimpleTableWithEnum> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    case AnyUniqueAliases_M2: {
+      flatbuffers::Offset<MyGame::Example2::Monster> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    default:
+      return _reader.Error("illegal type id for union: AnyUniqueAliases");
+  }
+}
+
+inline bool ToJson(AnyAmbiguousAliases _type, const void *_obj, flatbuffers::JsonWriter &_writer) {
+  switch (_type) {
+    case AnyAmbiguousAliases_M1:
+      return ToJson(reinterpret_cast<const Monster *>(_obj), _writer);
+    case AnyAmbiguousAliases_M2:
+      return ToJson(reinterpret_cast<const Monster *>(_obj), _writer);
+    case AnyAmbiguousAliases_M3:
+      return ToJson(reinterpret_cast<const Monster *>(_obj), _writer);
+    default: return false;
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, AnyAmbiguousAliases _type, flatbuffers::Offset<void> *_o) {
+  switch (_type) {
+    case AnyAmbiguousAliases_M1: {
+      flatbuffers::Offset<Monster> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    case AnyAmbiguousAliases_M2: {
+      flatbuffers::Offset<Monster> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    case AnyAmbiguousAliases_M3: {
+      flatbuffers::Offset<Monster> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    default:
+      return _reader.Error("illegal type id for union: AnyAmbiguousAliases");
+  }
+}
+
+}  // namespace Example
+
+inline bool ToJson(const InParentNamespace *_o, flatbuffers::JsonWriter &_writer) {
+  (void)_o;
+  _writer.StartObject();
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<InParentNamespace> *_o) {
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (!_reader.SkipUnknownField()) return false;
+  }
+  if (!_reader.ok()) return false;
+  *_o = CreateInParentNamespace(_fbb);
+  return true;
+}
+
+namespace Example2 {
+
+inline bool ToJson(const Monster *_o, flatbuffers::JsonWriter &_writer) {
+  (void)_o;
+  _writer.StartObject();
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_o) {
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (!_reader.SkipUnknownField()) return false;
+  }
+  if (!_reader.ok()) return false;
+  *_o = CreateMonster(_fbb);
+  return true;
+}
+
+}  // namespace Example2
+
+namespace Example {
+
+inline bool ToJson(const Test *_o, flatbuffers::JsonWriter &_writer) {
+  _writer.StartObject();
+  _writer.Key("a");
+  _writer.Number(_o->a());
+  _writer.Key("b");
+  _writer.Number(_o->b());
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Test *_o) {
+  int16_t _a = 0;
+  int8_t _b = 0;
+  size_t _fields = 0;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("a")) {
+      if (!_reader.Number(&_a)) return false;
+    } else if (_reader.KeyIs("b")) {
+      if (!_reader.Number(&_b)) return false;
+    } else {
+      if (!_reader.SkipUnknownField()) return false;
+      continue;
+    }
+    _fields++;
+  }
+  if (!_reader.ok()) return false;
+  if (_fields != 2) {
+    return _reader.Error("wrong number of fields in struct: Test");
+  }
+  *_o = Test(_a, _b);
+  return true;
+}
+
+inline bool ToJson(const TestSimpleTableWithEnum *_o, flatbuffers::JsonWriter &_writer) {
+  auto _t = reinterpret_cast<const flatbuffers::Table *>(_o);
+  _writer.StartObject();
+  if (_t->CheckField(TestSimpleTableWithEnum::VT_COLOR)) {
+    _writer.Key("color");
+    ToJson(static_cast<Color>(_o->color()), _writer);
+  }
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TestSimpleTableWithEnum> *_o) {
+  Color _color = Color_Green;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("color")) {
+      if (!FromJson(_reader, &_color)) return false;
+    } else if (!_reader.SkipUnknownField()) {
+      return false;
+    }
+  }
+  if (!_reader.ok()) return false;
+  *_o = CreateTestSimpleTableWithEnum(_fbb,
+      _color);
+  return true;
+}
+
+inline bool ToJson(const Vec3 *_o, flatbuffers::JsonWriter &_writer) {
+  _writer.StartObject();
+  _writer.Key("x");
+  _writer.Number(_o->x());
+  _writer.Key("y");
+  _writer.Number(_o->y());
+  _writer.Key("z");
+  _writer.Number(_o->z());
+  _writer.Key("test1");
+  _writer.Number(_o->test1());
+  _writer.Key("test2");
+  ToJson(static_cast<Color>(_o->test2()), _writer);
+  _writer.Key("test3");
+  if (!ToJson(&_o->test3(), _writer)) return false;
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Vec3 *_o) {
+  float _x = 0;
+  float _y = 0;
+  float _z = 0;
+  double _test1 = 0;
+  auto _test2 = static_cast<Color>(0);
+  Test _test3;
+  size_t _fields = 0;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("x")) {
+      if (!_reader.Number(&_x)) return false;
+    } else if (_reader.KeyIs("y")) {
+      if (!_reader.Number(&_y)) return false;
+    } else if (_reader.KeyIs("z")) {
+      if (!_reader.Number(&_z)) return false;
+    } else if (_reader.KeyIs("test1")) {
+      if (!_reader.Number(&_test1)) return false;
+    } else if (_reader.KeyIs("test2")) {
+      if (!FromJson(_reader, &_test2)) return false;
+    } else if (_reader.KeyIs("test3")) {
+      if (!FromJson(_reader, &_test3)) return false;
+    } else {
+      if (!_reader.SkipUnknownField()) return false;
+      continue;
+    }
+    _fields++;
+  }
+  if (!_reader.ok()) return false;
+  if (_fields != 6) {
+    return _reader.Error("wrong number of fields in struct: Vec3");
+  }
+  *_o = Vec3(_x, _y, _z, _test1, _test2, _test3);
+  return true;
+}
+
+inline bool ToJson(const Ability *_o, flatbuffers::JsonWriter &_writer) {
+  _writer.StartObject();
+  _writer.Key("id");
+  _writer.Number(_o->id());
+  _writer.Key("distance");
+  _writer.Number(_o->distance());
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Ability *_o) {
+  uint32_t _id = 0;
+  uint32_t _distance = 0;
+  size_t _fields = 0;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("id")) {
+      if (!_reader.Number(&_id)) return false;
+    } else if (_reader.KeyIs("distance")) {
+      if (!_reader.Number(&_distance)) return false;
+    } else {
+      if (!_reader.SkipUnknownField()) return false;
+      continue;
+    }
+    _fields++;
+  }
+  if (!_reader.ok()) return false;
+  if (_fields != 2) {
+    return _reader.Error("wrong number of fields in struct: Ability");
+  }
+  *_o = Ability(_id, _distance);
+  return true;
+}
+
+inline bool ToJson(const Stat *_o, flatbuffers::JsonWriter &_writer) {
+  auto _t = reinterpret_cast<const flatbuffers::Table *>(_o);
+  _writer.StartObject();
+  if (_o->id()) {
+    _writer.Key("id");
+    if (!_writer.String(_o->id())) return false;
+  }
+  if (_t->CheckField(Stat::VT_VAL)) {
+    _writer.Key("val");
+    _writer.Number(_o->val());
+  }
+  if (_t->CheckField(Stat::VT_COUNT)) {
+    _writer.Key("count");
+    _writer.Number(_o->count());
+  }
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Stat> *_o) {
+  flatbuffers::Offset<flatbuffers::String> _id;
+  int64_t _val = 0;
+  uint16_t _count = 0;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("id")) {
+      if (_reader.Null()) continue;
+      if (!_reader.String()) return false;
+      _id = _fbb.CreateString(_reader.str());
+    } else if (_reader.KeyIs("val")) {
+      if (!_reader.Number(&_val)) return false;
+    } else if (_reader.KeyIs("count")) {
+      if (!_reader.Number(&_count)) return false;
+    } else if (!_reader.SkipUnknownField()) {
+      return false;
+    }
+  }
+  if (!_reader.ok()) return false;
+  *_o = CreateStat(_fbb,
+      _id,
+      _val,
+      _count);
+  return true;
+}
+
+inline bool ToJson(const Referrable *_o, flatbuffers::JsonWriter &_writer) {
+  auto _t = reinterpret_cast<const flatbuffers::Table *>(_o);
+  _writer.StartObject();
+  if (_t->CheckField(Referrable::VT_ID)) {
+    _writer.Key("id");
+    _writer.Number(_o->id());
+  }
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Referrable> *_o) {
+  uint64_t _id = 0;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("id")) {
+      if (!_reader.HashedNumber(&_id, flatbuffers::FindHashFunction64("fnv1a_64"))) return false;
+    } else if (!_reader.SkipUnknownField()) {
+      return false;
+    }
+  }
+  if (!_reader.ok()) return false;
+  *_o = CreateReferrable(_fbb,
+      _id);
+  return true;
+}
+
+inline bool ToJson(const Monster *_o, flatbuffers::JsonWriter &_writer) {
+  auto _t = reinterpret_cast<const flatbuffers::Table *>(_o);
+  _writer.StartObject();
+  if (_o->pos()) {
+    _writer.Key("pos");
+    if (!ToJson(_o->pos(), _writer)) return false;
+  }
+  if (_t->CheckField(Monster::VT_MANA)) {
+    _writer.Key("mana");
+    _writer.Number(_o->mana());
+  }
+  if (_t->CheckField(Monster::VT_HP)) {
+    _writer.Key("hp");
+    _writer.Number(_o->hp());
+  }
+  if (_o->name()) {
+    _writer.Key("name");
+    if (!_writer.String(_o->name())) return false;
+  }
+  if (_o->inventory()) {
+    _writer.Key("inventory");
+    auto _vec = _o->inventory();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      _writer.Number(_vec->Get(_i));
+    }
+    _writer.EndArray();
+  }
+  if (_t->CheckField(Monster::VT_COLOR)) {
+    _writer.Key("color");
+    ToJson(static_cast<Color>(_o->color()), _writer);
+  }
+  if (_t->CheckField(Monster::VT_TEST_TYPE)) {
+    _writer.Key("test_type");
+    ToJson(static_cast<Any>(_o->test_type()), _writer);
+  }
+  if (_o->test()) {
+    _writer.Key("test");
+    if (!ToJson(_o->test_type(), _o->test(), _writer)) {
+      return false;
+    }
+  }
+  if (_o->test4()) {
+    _writer.Key("test4");
+    auto _vec = _o->test4();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      if (!ToJson(_vec->Get(_i), _writer)) return false;
+    }
+    _writer.EndArray();
+  }
+  if (_o->testarrayofstring()) {
+    _writer.Key("testarrayofstring");
+    auto _vec = _o->testarrayofstring();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      if (!_writer.String(_vec->Get(_i))) return false;
+    }
+    _writer.EndArray();
+  }
+  if (_o->testarrayoftables()) {
+    _writer.Key("testarrayoftables");
+    auto _vec = _o->testarrayoftables();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      if (!ToJson(_vec->Get(_i), _writer)) return false;
+    }
+    _writer.EndArray();
+  }
+  if (_o->enemy()) {
+    _writer.Key("enemy");
+    if (!ToJson(_o->enemy(), _writer)) return false;
+  }
+  if (_o->testnestedflatbuffer()) {
+    _writer.Key("testnestedflatbuffer");
+    if (!ToJson(_o->testnestedflatbuffer_nested_root(), _writer)) {
+      return false;
+    }
+  }
+  if (_o->testempty()) {
+    _writer.Key("testempty");
+    if (!ToJson(_o->testempty(), _writer)) return false;
+  }
+  if (_t->CheckField(Monster::VT_TESTBOOL)) {
+    _writer.Key("testbool");
+    _writer.Bool(_o->testbool() != 0);
+  }
+  if (_t->CheckField(Monster::VT_TESTHASHS32_FNV1)) {
+    _writer.Key("testhashs32_fnv1");
+    _writer.Number(_o->testhashs32_fnv1());
+  }
+  if (_t->CheckField(Monster::VT_TESTHASHU32_FNV1)) {
+    _writer.Key("testhashu32_fnv1");
+    _writer.Number(_o->testhashu32_fnv1());
+  }
+  if (_t->CheckField(Monster::VT_TESTHASHS64_FNV1)) {
+    _writer.Key("testhashs64_fnv1");
+    _writer.Number(_o->testhashs64_fnv1());
+  }
+  if (_t->CheckField(Monster::VT_TESTHASHU64_FNV1)) {
+    _writer.Key("testhashu64_fnv1");
+    _writer.Number(_o->testhashu64_fnv1());
+  }
+  if (_t->CheckField(Monster::VT_TESTHASHS32_FNV1A)) {
+    _writer.Key("testhashs32_fnv1a");
+    _writer.Number(_o->testhashs32_fnv1a());
+  }
+  if (_t->CheckField(Monster::VT_TESTHASHU32_FNV1A)) {
+    _writer.Key("testhashu32_fnv1a");
+    _writer.Number(_o->testhashu32_fnv1a());
+  }
+  if (_t->CheckField(Monster::VT_TESTHASHS64_FNV1A)) {
+    _writer.Key("testhashs64_fnv1a");
+    _writer.Number(_o->testhashs64_fnv1a());
+  }
+  if (_t->CheckField(Monster::VT_TESTHASHU64_FNV1A)) {
+    _writer.Key("testhashu64_fnv1a");
+    _writer.Number(_o->testhashu64_fnv1a());
+  }
+  if (_o->testarrayofbools()) {
+    _writer.Key("testarrayofbools");
+    auto _vec = _o->testarrayofbools();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      _writer.Bool(_vec->Get(_i) != 0);
+    }
+    _writer.EndArray();
+  }
+  if (_t->CheckField(Monster::VT_TESTF)) {
+    _writer.Key("testf");
+    _writer.Number(_o->testf());
+  }
+  if (_t->CheckField(Monster::VT_TESTF2)) {
+    _writer.Key("testf2");
+    _writer.Number(_o->testf2());
+  }
+  if (_t->CheckField(Monster::VT_TESTF3)) {
+    _writer.Key("testf3");
+    _writer.Number(_o->testf3());
+  }
+  if (_o->testarrayofstring2()) {
+    _writer.Key("testarrayofstring2");
+    auto _vec = _o->testarrayofstring2();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      if (!_writer.String(_vec->Get(_i))) return false;
+    }
+    _writer.EndArray();
+  }
+  if (_o->testarrayofsortedstruct()) {
+    _writer.Key("testarrayofsortedstruct");
+    auto _vec = _o->testarrayofsortedstruct();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      if (!ToJson(_vec->Get(_i), _writer)) return false;
+    }
+    _writer.EndArray();
+  }
+  if (_o->flex()) {
+    _writer.Key("flex");
+    _writer.FlexBuffer(_o->flex());
+  }
+  if (_o->test5()) {
+    _writer.Key("test5");
+    auto _vec = _o->test5();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      if (!ToJson(_vec->Get(_i), _writer)) return false;
+    }
+    _writer.EndArray();
+  }
+  if (_o->vector_of_longs()) {
+    _writer.Key("vector_of_longs");
+    auto _vec = _o->vector_of_longs();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      _writer.Number(_vec->Get(_i));
+    }
+    _writer.EndArray();
+  }
+  if (_o->vector_of_doubles()) {
+    _writer.Key("vector_of_doubles");
+    auto _vec = _o->vector_of_doubles();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      _writer.Number(_vec->Get(_i));
+    }
+    _writer.EndArray();
+  }
+  if (_o->parent_namespace_test()) {
+    _writer.Key("parent_namespace_test");
+    if (!ToJson(_o->parent_namespace_test(), _writer)) return false;
+  }
+  if (_o->vector_of_referrables()) {
+    _writer.Key("vector_of_referrables");
+    auto _vec = _o->vector_of_referrables();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      if (!ToJson(_vec->Get(_i), _writer)) return false;
+    }
+    _writer.EndArray();
+  }
+  if (_t->CheckField(Monster::VT_SINGLE_WEAK_REFERENCE)) {
+    _writer.Key("single_weak_reference");
+    _writer.Number(_o->single_weak_reference());
+  }
+  if (_o->vector_of_weak_references()) {
+    _writer.Key("vector_of_weak_references");
+    auto _vec = _o->vector_of_weak_references();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      _writer.Number(_vec->Get(_i));
+    }
+    _writer.EndArray();
+  }
+  if (_o->vector_of_strong_referrables()) {
+    _writer.Key("vector_of_strong_referrables");
+    auto _vec = _o->vector_of_strong_referrables();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      if (!ToJson(_vec->Get(_i), _writer)) return false;
+    }
+    _writer.EndArray();
+  }
+  if (_t->CheckField(Monster::VT_CO_OWNING_REFERENCE)) {
+    _writer.Key("co_owning_reference");
+    _writer.Number(_o->co_owning_reference());
+  }
+  if (_o->vector_of_co_owning_references()) {
+    _writer.Key("vector_of_co_owning_references");
+    auto _vec = _o->vector_of_co_owning_references();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      _writer.Number(_vec->Get(_i));
+    }
+    _writer.EndArray();
+  }
+  if (_t->CheckField(Monster::VT_NON_OWNING_REFERENCE)) {
+    _writer.Key("non_owning_reference");
+    _writer.Number(_o->non_owning_reference());
+  }
+  if (_o->vector_of_non_owning_references()) {
+    _writer.Key("vector_of_non_owning_references");
+    auto _vec = _o->vector_of_non_owning_references();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      _writer.Number(_vec->Get(_i));
+    }
+    _writer.EndArray();
+  }
+  if (_t->CheckField(Monster::VT_ANY_UNIQUE_TYPE)) {
+    _writer.Key("any_unique_type");
+    ToJson(static_cast<AnyUniqueAliases>(_o->any_unique_type()), _writer);
+  }
+  if (_o->any_unique()) {
+    _writer.Key("any_unique");
+    if (!ToJson(_o->any_unique_type(), _o->any_unique(), _writer)) {
+      return false;
+    }
+  }
+  if (_t->CheckField(Monster::VT_ANY_AMBIGUOUS_TYPE)) {
+    _writer.Key("any_ambiguous_type");
+    ToJson(static_cast<AnyAmbiguousAliases>(_o->any_ambiguous_type()), _writer);
+  }
+  if (_o->any_ambiguous()) {
+    _writer.Key("any_ambiguous");
+    if (!ToJson(_o->any_ambiguous_type(), _o->any_ambiguous(), _writer)) {
+      return false;
+    }
+  }
+  if (_o->vector_of_enums()) {
+    _writer.Key("vector_of_enums");
+    auto _vec = _o->vector_of_enums();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      ToJson(static_cast<Color>(_vec->Get(_i)), _writer);
+    }
+    _writer.EndArray();
+  }
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_o) {
+  Vec3 _pos;
+  bool _pos_set = false;
+  int16_t _mana = 150;
+  int16_t _hp = 100;
+  flatbuffers::Offset<flatbuffers::String> _name;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> _inventory;
+  Color _color = Color_Blue;
+  Any _test_type = Any_NONE;
+  flatbuffers::Offset<void> _test;
+  const char *_test_mark = nullptr;
+  flatbuffers::Offset<flatbuffers::Vector<const Test *>> _test4;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> _testarrayofstring;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Monster>>> _testarrayoftables;
+  flatbuffers::Offset<Monster> _enemy;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> _testnestedflatbuffer;
+  flatbuffers::Offset<Stat> _testempty;
+  bool _testbool = false;
+  int32_t _testhashs32_fnv1 = 0;
+  uint32_t _testhashu32_fnv1 = 0;
+  int64_t _testhashs64_fnv1 = 0;
+  uint64_t _testhashu64_fnv1 = 0;
+  int32_t _testhashs32_fnv1a = 0;
+  uint32_t _testhashu32_fnv1a = 0;
+  int64_t _testhashs64_fnv1a = 0;
+  uint64_t _testhashu64_fnv1a = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> _testarrayofbools;
+  float _testf = 3.14159f;
+  float _testf2 = 3.0f;
+  float _testf3 = 0.0f;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> _testarrayofstring2;
+  flatbuffers::Offset<flatbuffers::Vector<const Ability *>> _testarrayofsortedstruct;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> _flex;
+  flatbuffers::Offset<flatbuffers::Vector<const Test *>> _test5;
+  flatbuffers::Offset<flatbuffers::Vector<int64_t>> _vector_of_longs;
+  flatbuffers::Offset<flatbuffers::Vector<double>> _vector_of_doubles;
+  flatbuffers::Offset<MyGame::InParentNamespace> _parent_namespace_test;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Referrable>>> _vector_of_referrables;
+  uint64_t _single_weak_reference = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint64_t>> _vector_of_weak_references;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Referrable>>> _vector_of_strong_referrables;
+  uint64_t _co_owning_reference = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint64_t>> _vector_of_co_owning_references;
+  uint64_t _non_owning_reference = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint64_t>> _vector_of_non_owning_references;
+  AnyUniqueAliases _any_unique_type = AnyUniqueAliases_NONE;
+  flatbuffers::Offset<void> _any_unique;
+  const char *_any_unique_mark = nullptr;
+  AnyAmbiguousAliases _any_ambiguous_type = AnyAmbiguousAliases_NONE;
+  flatbuffers::Offset<void> _any_ambiguous;
+  const char *_any_ambiguous_mark = nullptr;
+  flatbuffers::Offset<flatbuffers::Vector<int8_t>> _vector_of_enums;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("pos")) {
+      if (_reader.Null()) continue;
+      if (!FromJson(_reader, &_pos)) return false;
+      _pos_set = true;
+    } else if (_reader.KeyIs("mana")) {
+      if (!_reader.Number(&_mana)) return false;
+    } else if (_reader.KeyIs("hp")) {
+      if (!_reader.Number(&_hp)) return false;
+    } else if (_reader.KeyIs("name")) {
+      if (_reader.Null()) continue;
+      if (!_reader.String()) return false;
+      _name = _fbb.CreateString(_reader.str());
+    } else if (_reader.KeyIs("friendly")) {
+      if (!_reader.SkipValue()) return false;
+    } else if (_reader.KeyIs("inventory")) {
+      if (_reader.Null()) continue;
+      std::vector<uint8_t> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        uint8_t _elem = 0;
+        if (!_reader.Number(&_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _inventory = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("color")) {
+      if (!FromJson(_reader, &_color)) return false;
+    } else if (_reader.KeyIs("test_type")) {
+      if (!FromJson(_reader, &_test_type)) return false;
+    } else if (_reader.KeyIs("test")) {
+      if (_reader.Null()) continue;
+      if (_test_type == Any_NONE) {
+        // The type comes after the value, so read the value at the end.
+        _test_mark = _reader.Mark();
+        if (!_reader.SkipValue()) return false;
+      } else if (!FromJson(_reader, _fbb, _test_type, &_test)) {
+        return false;
+      }
+    } else if (_reader.KeyIs("test4")) {
+      if (_reader.Null()) continue;
+      std::vector<Test> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        Test _elem;
+        if (!FromJson(_reader, &_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _test4 = _fbb.CreateVectorOfStructs(_vec);
+    } else if (_reader.KeyIs("testarrayofstring")) {
+      if (_reader.Null()) continue;
+      std::vector<flatbuffers::Offset<flatbuffers::String>> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        if (!_reader.String()) return false;
+        _vec.push_back(_fbb.CreateString(_reader.str()));
+      }
+      if (!_reader.ok()) return false;
+      _testarrayofstring = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("testarrayoftables")) {
+      if (_reader.Null()) continue;
+      std::vector<flatbuffers::Offset<Monster>> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        flatbuffers::Offset<Monster> _elem;
+        if (!FromJson(_reader, _fbb, &_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _testarrayoftables = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("enemy")) {
+      if (_reader.Null()) continue;
+      if (!FromJson(_reader, _fbb, &_enemy)) return false;
+    } else if (_reader.KeyIs("testnestedflatbuffer")) {
+      if (_reader.Null()) continue;
+      if (_reader.Peek() != '[') {
+        flatbuffers::FlatBufferBuilder _nested;
+        flatbuffers::Offset<Monster> _root;
+        if (!FromJson(_reader, _nested, &_root)) return false;
+        _nested.Finish(_root);
+        _fbb.ForceVectorAlignment(_nested.GetSize(), sizeof(uint8_t),
+                                  _nested.GetBufferMinAlignment());
+        _testnestedflatbuffer = _fbb.CreateVector(
+            _nested.GetBufferPointer(), _nested.GetSize());
+        continue;
+      }
+      std::vector<uint8_t> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        uint8_t _elem = 0;
+        if (!_reader.Number(&_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _testnestedflatbuffer = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("testempty")) {
+      if (_reader.Null()) continue;
+      if (!FromJson(_reader, _fbb, &_testempty)) return false;
+    } else if (_reader.KeyIs("testbool")) {
+      if (!_reader.Bool(&_testbool)) return false;
+    } else if (_reader.KeyIs("testhashs32_fnv1")) {
+      if (!_reader.HashedNumber(&_testhashs32_fnv1, flatbuffers::FindHashFunction32("fnv1_32"))) return false;
+    } else if (_reader.KeyIs("testhashu32_fnv1")) {
+      if (!_reader.HashedNumber(&_testhashu32_fnv1, flatbuffers::FindHashFunction32("fnv1_32"))) return false;
+    } else if (_reader.KeyIs("testhashs64_fnv1")) {
+      if (!_reader.HashedNumber(&_testhashs64_fnv1, flatbuffers::FindHashFunction64("fnv1_64"))) return false;
+    } else if (_reader.KeyIs("testhashu64_fnv1")) {
+      if (!_reader.HashedNumber(&_testhashu64_fnv1, flatbuffers::FindHashFunction64("fnv1_64"))) return false;
+    } else if (_reader.KeyIs("testhashs32_fnv1a")) {
+      if (!_reader.HashedNumber(&_testhashs32_fnv1a, flatbuffers::FindHashFunction32("fnv1a_32"))) return false;
+    } else if (_reader.KeyIs("testhashu32_fnv1a")) {
+      if (!_reader.HashedNumber(&_testhashu32_fnv1a, flatbuffers::FindHashFunction32("fnv1a_32"))) return false;
+    } else if (_reader.KeyIs("testhashs64_fnv1a")) {
+      if (!_reader.HashedNumber(&_testhashs64_fnv1a, flatbuffers::FindHashFunction64("fnv1a_64"))) return false;
+    } else if (_reader.KeyIs("testhashu64_fnv1a")) {
+      if (!_reader.HashedNumber(&_testhashu64_fnv1a, flatbuffers::FindHashFunction64("fnv1a_64"))) return false;
+    } else if (_reader.KeyIs("testarrayofbools")) {
+      if (_reader.Null()) continue;
+      std::vector<uint8_t> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        bool _elem = false;
+        if (!_reader.Bool(&_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _testarrayofbools = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("testf")) {
+      if (!_reader.Number(&_testf)) return false;
+    } else if (_reader.KeyIs("testf2")) {
+      if (!_reader.Number(&_testf2)) return false;
+    } else if (_reader.KeyIs("testf3")) {
+      if (!_reader.Number(&_testf3)) return false;
+    } else if (_reader.KeyIs("testarrayofstring2")) {
+      if (_reader.Null()) continue;
+      std::vector<flatbuffers::Offset<flatbuffers::String>> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        if (!_reader.String()) return false;
+        _vec.push_back(_fbb.CreateString(_reader.str()));
+      }
+      if (!_reader.ok()) return false;
+      _testarrayofstring2 = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("testarrayofsortedstruct")) {
+      if (_reader.Null()) continue;
+      std::vector<Ability> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        Ability _elem;
+        if (!FromJson(_reader, &_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _testarrayofsortedstruct = _fbb.CreateVectorOfStructs(_vec);
+    } else if (_reader.KeyIs("flex")) {
+      if (_reader.Null()) continue;
+      if (!_reader.FlexBuffer(_fbb, &_flex)) return false;
+    } else if (_reader.KeyIs("test5")) {
+      if (_reader.Null()) continue;
+      std::vector<Test> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        Test _elem;
+        if (!FromJson(_reader, &_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _test5 = _fbb.CreateVectorOfStructs(_vec);
+    } else if (_reader.KeyIs("vector_of_longs")) {
+      if (_reader.Null()) continue;
+      std::vector<int64_t> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        int64_t _elem = 0;
+        if (!_reader.Number(&_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _vector_of_longs = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("vector_of_doubles")) {
+      if (_reader.Null()) continue;
+      std::vector<double> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        double _elem = 0;
+        if (!_reader.Number(&_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _vector_of_doubles = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("parent_namespace_test")) {
+      if (_reader.Null()) continue;
+      if (!FromJson(_reader, _fbb, &_parent_namespace_test)) return false;
+    } else if (_reader.KeyIs("vector_of_referrables")) {
+      if (_reader.Null()) continue;
+      std::vector<flatbuffers::Offset<Referrable>> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        flatbuffers::Offset<Referrable> _elem;
+        if (!FromJson(_reader, _fbb, &_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _vector_of_referrables = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("single_weak_reference")) {
+      if (!_reader.HashedNumber(&_single_weak_reference, flatbuffers::FindHashFunction64("fnv1a_64"))) return false;
+    } else if (_reader.KeyIs("vector_of_weak_references")) {
+      if (_reader.Null()) continue;
+      std::vector<uint64_t> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        uint64_t _elem = 0;
+        if (!_reader.HashedNumber(&_elem, flatbuffers::FindHashFunction64("fnv1a_64"))) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _vector_of_weak_references = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("vector_of_strong_referrables")) {
+      if (_reader.Null()) continue;
+      std::vector<flatbuffers::Offset<Referrable>> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        flatbuffers::Offset<Referrable> _elem;
+        if (!FromJson(_reader, _fbb, &_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _vector_of_strong_referrables = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("co_owning_reference")) {
+      if (!_reader.HashedNumber(&_co_owning_reference, flatbuffers::FindHashFunction64("fnv1a_64"))) return false;
+    } else if (_reader.KeyIs("vector_of_co_owning_references")) {
+      if (_reader.Null()) continue;
+      std::vector<uint64_t> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        uint64_t _elem = 0;
+        if (!_reader.HashedNumber(&_elem, flatbuffers::FindHashFunction64("fnv1a_64"))) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _vector_of_co_owning_references = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("non_owning_reference")) {
+      if (!_reader.HashedNumber(&_non_owning_reference, flatbuffers::FindHashFunction64("fnv1a_64"))) return false;
+    } else if (_reader.KeyIs("vector_of_non_owning_references")) {
+      if (_reader.Null()) continue;
+      std::vector<uint64_t> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        uint64_t _elem = 0;
+        if (!_reader.HashedNumber(&_elem, flatbuffers::FindHashFunction64("fnv1a_64"))) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _vector_of_non_owning_references = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("any_unique_type")) {
+      if (!FromJson(_reader, &_any_unique_type)) return false;
+    } else if (_reader.KeyIs("any_unique")) {
+      if (_reader.Null()) continue;
+      if (_any_unique_type == AnyUniqueAliases_NONE) {
+        // The type comes after the value, so read the value at the end.
+        _any_unique_mark = _reader.Mark();
+        if (!_reader.SkipValue()) return false;
+      } else if (!FromJson(_reader, _fbb, _any_unique_type, &_any_unique)) {
+        return false;
+      }
+    } else if (_reader.KeyIs("any_ambiguous_type")) {
+      if (!FromJson(_reader, &_any_ambiguous_type)) return false;
+    } else if (_reader.KeyIs("any_ambiguous")) {
+      if (_reader.Null()) continue;
+      if (_any_ambiguous_type == AnyAmbiguousAliases_NONE) {
+        // The type comes after the value, so read the value at the end.
+        _any_ambiguous_mark = _reader.Mark();
+        if (!_reader.SkipValue()) return false;
+      } else if (!FromJson(_reader, _fbb, _any_ambiguous_type, &_any_ambiguous)) {
+        return false;
+      }
+    } else if (_reader.KeyIs("vector_of_enums")) {
+      if (_reader.Null()) continue;
+      std::vector<int8_t> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        auto _elem = static_cast<Color>(0);
+        if (!FromJson(_reader, &_elem)) return false;
+        _vec.push_back(static_cast<int8_t>(_elem));
+      }
+      if (!_reader.ok()) return false;
+      _vector_of_enums = _fbb.CreateVector(_vec);
+    } else if (!_reader.SkipUnknownField()) {
+      return false;
+    }
+  }
+  if (!_reader.ok()) return false;
+  if (_test_mark) {
+    auto _end = _reader.Mark();
+    _reader.Rewind(_test_mark);
+    if (!FromJson(_reader, _fbb, _test_type, &_test)) {
+      return false;
+    }
+    _reader.Rewind(_end);
+  }
+  if (_any_unique_mark) {
+    auto _end = _reader.Mark();
+    _reader.Rewind(_any_unique_mark);
+    if (!FromJson(_reader, _fbb, _any_unique_type, &_any_unique)) {
+      return false;
+    }
+    _reader.Rewind(_end);
+  }
+  if (_any_ambiguous_mark) {
+    auto _end = _reader.Mark();
+    _reader.Rewind(_any_ambiguous_mark);
+    if (!FromJson(_reader, _fbb, _any_ambiguous_type, &_any_ambiguous)) {
+      return false;
+    }
+    _reader.Rewind(_end);
+  }
+  if (_name.IsNull()) {
+    return _reader.Error("required field is missing: name");
+  }
+  *_o = CreateMonster(_fbb,
+      _pos_set ? &_pos : nullptr,
+      _mana,
+      _hp,
+      _name,
+      _inventory,
+      _color,
+      _test_type,
+      _test,
+      _test4,
+      _testarrayofstring,
+      _testarrayoftables,
+      _enemy,
+      _testnestedflatbuffer,
+      _testempty,
+      _testbool,
+      _testhashs32_fnv1,
+      _testhashu32_fnv1,
+      _testhashs64_fnv1,
+      _testhashu64_fnv1,
+      _testhashs32_fnv1a,
+      _testhashu32_fnv1a,
+      _testhashs64_fnv1a,
+      _testhashu64_fnv1a,
+      _testarrayofbools,
+      _testf,
+      _testf2,
+      _testf3,
+      _testarrayofstring2,
+      _testarrayofsortedstruct,
+      _flex,
+      _test5,
+      _vector_of_longs,
+      _vector_of_doubles,
+      _parent_namespace_test,
+      _vector_of_referrables,
+      _single_weak_reference,
+      _vector_of_weak_references,
+      _vector_of_strong_referrables,
+      _co_owning_reference,
+      _vector_of_co_owning_references,
+      _non_owning_reference,
+      _vector_of_non_owning_references,
+      _any_unique_type,
+      _any_unique,
+      _any_ambiguous_type,
+      _any_ambiguous,
+      _vector_of_enums);
+  return true;
+}
+
+inline bool ToJson(const TypeAliases *_o, flatbuffers::JsonWriter &_writer) {
+  auto _t = reinterpret_cast<const flatbuffers::Table *>(_o);
+  _writer.StartObject();
+  if (_t->CheckField(TypeAliases::VT_I8)) {
+    _writer.Key("i8");
+    _writer.Number(_o->i8());
+  }
+  if (_t->CheckField(TypeAliases::VT_U8)) {
+    _writer.Key("u8");
+    _writer.Number(_o->u8());
+  }
+  if (_t->CheckField(TypeAliases::VT_I16)) {
+    _writer.Key("i16");
+    _writer.Number(_o->i16());
+  }
+  if (_t->CheckField(TypeAliases::VT_U16)) {
+    _writer.Key("u16");
+    _writer.Number(_o->u16());
+  }
+  if (_t->CheckField(TypeAliases::VT_I32)) {
+    _writer.Key("i32");
+    _writer.Number(_o->i32());
+  }
+  if (_t->CheckField(TypeAliases::VT_U32)) {
+    _writer.Key("u32");
+    _writer.Number(_o->u32());
+  }
+  if (_t->CheckField(TypeAliases::VT_I64)) {
+    _writer.Key("i64");
+    _writer.Number(_o->i64());
+  }
+  if (_t->CheckField(TypeAliases::VT_U64)) {
+    _writer.Key("u64");
+    _writer.Number(_o->u64());
+  }
+  if (_t->CheckField(TypeAliases::VT_F32)) {
+    _writer.Key("f32");
+    _writer.Number(_o->f32());
+  }
+  if (_t->CheckField(TypeAliases::VT_F64)) {
+    _writer.Key("f64");
+    _writer.Number(_o->f64());
+  }
+  if (_o->v8()) {
+    _writer.Key("v8");
+    auto _vec = _o->v8();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      _writer.Number(_vec->Get(_i));
+    }
+    _writer.EndArray();
+  }
+  if (_o->vf64()) {
+    _writer.Key("vf64");
+    auto _vec = _o->vf64();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      _writer.Number(_vec->Get(_i));
+    }
+    _writer.EndArray();
+  }
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TypeAliases> *_o) {
+  int8_t _i8 = 0;
+  uint8_t _u8 = 0;
+  int16_t _i16 = 0;
+  uint16_t _u16 = 0;
+  int32_t _i32 = 0;
+  uint32_t _u32 = 0;
+  int64_t _i64 = 0;
+  uint64_t _u64 = 0;
+  float _f32 = 0.0f;
+  double _f64 = 0.0;
+  flatbuffers::Offset<flatbuffers::Vector<int8_t>> _v8;
+  flatbuffers::Offset<flatbuffers::Vector<double>> _vf64;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("i8")) {
+      if (!_reader.Number(&_i8)) return false;
+    } else if (_reader.KeyIs("u8")) {
+      if (!_reader.Number(&_u8)) return false;
+    } else if (_reader.KeyIs("i16")) {
+      if (!_reader.Number(&_i16)) return false;
+    } else if (_reader.KeyIs("u16")) {
+      if (!_reader.Number(&_u16)) return false;
+    } else if (_reader.KeyIs("i32")) {
+      if (!_reader.Number(&_i32)) return false;
+    } else if (_reader.KeyIs("u32")) {
+      if (!_reader.Number(&_u32)) return false;
+    } else if (_reader.KeyIs("i64")) {
+      if (!_reader.Number(&_i64)) return false;
+    } else if (_reader.KeyIs("u64")) {
+      if (!_reader.Number(&_u64)) return false;
+    } else if (_reader.KeyIs("f32")) {
+      if (!_reader.Number(&_f32)) return false;
+    } else if (_reader.KeyIs("f64")) {
+      if (!_reader.Number(&_f64)) return false;
+    } else if (_reader.KeyIs("v8")) {
+      if (_reader.Null()) continue;
+      std::vector<int8_t> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        int8_t _elem = 0;
+        if (!_reader.Number(&_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _v8 = _fbb.CreateVector(_vec);
+    } else if (_reader.KeyIs("vf64")) {
+      if (_reader.Null()) continue;
+      std::vector<double> _vec;
+      if (!_reader.StartArray()) return false;
+      while (_reader.NextElement()) {
+        double _elem = 0;
+        if (!_reader.Number(&_elem)) return false;
+        _vec.push_back(_elem);
+      }
+      if (!_reader.ok()) return false;
+      _vf64 = _fbb.CreateVector(_vec);
+    } else if (!_reader.SkipUnknownField()) {
+      return false;
+    }
+  }
+  if (!_reader.ok()) return false;
+  *_o = CreateTypeAliases(_fbb,
+      _i8,
+      _u8,
+      _i16,
+      _u16,
+      _i32,
+      _u32,
+      _i64,
+      _u64,
+      _f32,
+      _f64,
+      _v8,
+      _vf64);
+  return true;
+}
+
 inline const flatbuffers::TypeTable *ColorTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_CHAR, 0, 0 },
@@ -3483,6 +5331,24 @@ inline flatbuffers::unique_ptr<MonsterT> UnPackMonster(
   return flatbuffers::unique_ptr<MonsterT>(GetMonster(buf)->UnPack(res));
 }
 
+inline bool MonsterToJson(const void *buf, std::string *json) {
+  flatbuffers::JsonWriter writer(json);
+  return ToJson(GetMonster(buf), writer);
+}
+
+inline bool MonsterFromJson(
+    const char *json, flatbuffers::FlatBufferBuilder &fbb,
+    std::string *error = nullptr) {
+  flatbuffers::JsonReader reader(json);
+  flatbuffers::Offset<MyGame::Example::Monster> root;
+  if (FromJson(reader, fbb, &root) && reader.ExpectEnd()) {
+    FinishMonsterBuffer(fbb, root);
+    return true;
+  }
+  if (error) *error = reader.error();
+  return false;
+}
+
 }  // namespace Example
 }  // namespace MyGame
 
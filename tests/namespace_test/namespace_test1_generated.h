@@ -122,6 +122,12 @@ struct TableInNestedNSBuilder {
 inline flatbuffers::Offset<TableInNestedNS> CreateTableInNestedNS(
     flatbuffers::FlatBufferBuilder &_fbb,
     int32_t foo = 0) {
+  if (!flatbuffers::IsTheSameAs<int32_t>(foo, 0)) {
+    static const flatbuffers::voffset_t vtable_[] = { 6, 8, 4 };
+    auto table_ = _fbb.StartFixedTable(8, 4);
+    flatbuffers::WriteScalar<int32_t>(table_ + 4, foo);
+    return flatbuffers::Offset<TableInNestedNS>(_fbb.EndFixedTable(vtable_));
+  }
   TableInNestedNSBuilder builder_(_fbb);
   builder_.add_foo(foo);
   return builder_.Finish();
@@ -104,6 +104,16 @@ inline flatbuffers::Offset<TableInFirstNS> CreateTableInFirstNS(
     flatbuffers::Offset<NamespaceA::NamespaceB::TableInNestedNS> foo_table = 0,
     NamespaceA::NamespaceB::EnumInNestedNS foo_enum = NamespaceA::NamespaceB::EnumInNestedNS_A,
     const NamespaceA::NamespaceB::StructInNestedNS *foo_struct = 0) {
+  if (foo_table.o &&
+      !flatbuffers::IsTheSameAs<int8_t>(static_cast<int8_t>(foo_enum), 0) &&
+      foo_struct) {
+    static const flatbuffers::voffset_t vtable_[] = { 10, 17, 4, 16, 8 };
+    auto table_ = _fbb.StartFixedTable(17, 4);
+    _fbb.AddFixedOffset(table_, 4, foo_table);
+    flatbuffers::WriteScalar<int8_t>(table_ + 16, static_cast<int8_t>(foo_enum));
+    memcpy(table_ + 8, foo_struct, sizeof(*foo_struct));
+    return flatbuffers::Offset<TableInFirstNS>(_fbb.EndFixedTable(vtable_));
+  }
   TableInFirstNSBuilder builder_(_fbb);
   builder_.add_foo_struct(foo_struct);
   builder_.add_foo_table(foo_table);
@@ -170,6 +180,14 @@ inline flatbuffers::Offset<TableInC> CreateTableInC(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<NamespaceA::TableInFirstNS> refer_to_a1 = 0,
     flatbuffers::Offset<NamespaceA::SecondTableInA> refer_to_a2 = 0) {
+  if (refer_to_a1.o &&
+      refer_to_a2.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 8, 12, 4, 8 };
+    auto table_ = _fbb.StartFixedTable(12, 4);
+    _fbb.AddFixedOffset(table_, 4, refer_to_a1);
+    _fbb.AddFixedOffset(table_, 8, refer_to_a2);
+    return flatbuffers::Offset<TableInC>(_fbb.EndFixedTable(vtable_));
+  }
   TableInCBuilder builder_(_fbb);
   builder_.add_refer_to_a2(refer_to_a2);
   builder_.add_refer_to_a1(refer_to_a1);
@@ -222,6 +240,12 @@ struct SecondTableInABuilder {
 inline flatbuffers::Offset<SecondTableInA> CreateSecondTableInA(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<NamespaceC::TableInC> refer_to_c = 0) {
+  if (refer_to_c.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 6, 8, 4 };
+    auto table_ = _fbb.StartFixedTable(8, 4);
+    _fbb.AddFixedOffset(table_, 4, refer_to_c);
+    return flatbuffers::Offset<SecondTableInA>(_fbb.EndFixedTable(vtable_));
+  }
   SecondTableInABuilder builder_(_fbb);
   builder_.add_refer_to_c(refer_to_c);
   return builder_.Finish();
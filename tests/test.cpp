@@ -13,7 +13,13 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <thread>
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/minireflect.h"
@@ -34,6 +40,8 @@
 #include "namespace_test/namespace_test2_generated.h"
 #include "union_vector/union_vector_generated.h"
 #include "monster_extra_generated.h"
+#include "hash_index_test_generated.h"
+#include "arena_test_generated.h"
 #include "test_assert.h"
 
 #include "flatbuffers/flexbuffers.h"
@@ -51,6 +59,21 @@ uint32_t lcg_rand() {
 }
 void lcg_reset() { lcg_seed = 48271; }
 
+// Count heap allocations, to test code that shouldn't allocate.
+std::atomic<size_t> heap_allocations(0);
+void *operator new(size_t size) {
+  heap_allocations++;
+  auto p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+// Not inlined, or GCC takes this for a free() of memory from new, in release
+// builds.
+#if defined(__GNUC__)
+__attribute__((noinline))
+#endif
+void operator delete(void *p) FLATBUFFERS_NOEXCEPT { free(p); }
+
 std::string test_data_path =
 #ifdef BAZEL_TEST_DATA_PATH
     "../com_github_google_flatbuffers/tests/";
@@ -528,6 +551,47 @@ void ObjectFlatBuffersTest(uint8_t *flatbuf) {
   TEST_EQ(tests[1].b(), 40);
 }
 
+// UnPackTo() into an existing object reuses its strings, vectors, subobjects
+// and union values.
+void ObjectReuseTest(const uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  MonsterT obj;
+  auto allocations = heap_allocations.load();
+  monster->UnPackTo(&obj);
+  TEST_EQ(heap_allocations.load() > allocations, true);
+  TEST_EQ(obj.testarrayoftables.size(), 3U);
+  auto table = obj.testarrayoftables[0].get();
+  auto union_value = obj.test.value;
+
+  allocations = heap_allocations.load();
+  monster->UnPackTo(&obj);
+  TEST_EQ(heap_allocations.load(), allocations);
+  TEST_EQ(obj.testarrayoftables[0].get(), table);
+  TEST_EQ(obj.test.value, union_value);
+
+  // The result is the same as that of a fresh UnPack().
+  auto fresh = UnPackMonster(flatbuf);
+  flatbuffers::FlatBufferBuilder fbb1;
+  fbb1.Finish(CreateMonster(fbb1, &obj), MonsterIdentifier());
+  flatbuffers::FlatBufferBuilder fbb2;
+  fbb2.Finish(CreateMonster(fbb2, fresh.get()), MonsterIdentifier());
+  TEST_EQ(fbb1.GetSize(), fbb2.GetSize());
+  TEST_EQ(memcmp(fbb1.GetBufferPointer(), fbb2.GetBufferPointer(),
+                 fbb1.GetSize()),
+          0);
+
+  // Fields absent from the buffer are reset.
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.Finish(CreateMonsterDirect(fbb3, nullptr, 150, 100, "Bob"),
+              MonsterIdentifier());
+  auto bob = GetMonster(fbb3.GetBufferPointer());
+  bob->UnPackTo(&obj);
+  MonsterT bob_obj;
+  bob->UnPackTo(&bob_obj);
+  TEST_EQ(obj == bob_obj, true);
+  TEST_EQ(obj.test.type, Any_NONE);
+}
+
 // Prefix a FlatBuffer with a size field.
 void SizePrefixedTest() {
   // Create size prefixed buffer.
@@ -627,6 +691,34 @@ void TestMonsterExtraFloats() {}
 
 // example of parsing text straight into a buffer, and generating
 // text back from it:
+// Collects text from GenerateText, in chunks.
+class ChunkedTextSink : public flatbuffers::TextSink {
+ public:
+  ChunkedTextSink() : max_chunk(0), num_chunks(0), fail(false) {}
+
+  bool Write(const char *data, size_t size) {
+    text.append(data, size);
+    max_chunk = std::max(max_chunk, size);
+    num_chunks++;
+    return !fail;
+  }
+
+  std::string text;
+  size_t max_chunk;
+  size_t num_chunks;
+  bool fail;
+};
+
+// Collects what GenerateTextFile saves, instead of writing it to disk.
+std::string saved_file_name;
+std::string saved_file_text;
+bool SaveFileToString(const char *name, const char *buf, size_t len,
+                      bool /*binary*/) {
+  saved_file_name = name;
+  saved_file_text.assign(buf, len);
+  return true;
+}
+
 void ParseAndGenerateTextTest(bool binary) {
   // load FlatBuffer schema (.fbs) and JSON from disk
   std::string schemafile;
@@ -658,6 +750,13 @@ void ParseAndGenerateTextTest(bool binary) {
   } else {
     TEST_EQ(parser.Parse(schemafile.c_str(), include_directories), true);
   }
+  // Field names used in JSON are looked up through a hash table.
+  auto root_def = parser.root_struct_def_;
+  for (auto it = root_def->fields.vec.begin();
+       it != root_def->fields.vec.end(); ++it) {
+    TEST_EQ(root_def->LookupField((*it)->name), *it);
+  }
+  TEST_EQ(root_def->LookupField("no_such_field") == nullptr, true);
   TEST_EQ(parser.Parse(jsonfile.c_str(), include_directories), true);
 
   // here, parser.builder_ contains a binary buffer that is the parsed data.
@@ -678,6 +777,93 @@ void ParseAndGenerateTextTest(bool binary) {
   TEST_EQ(result, true);
   TEST_EQ_STR(jsongen.c_str(), jsonfile.c_str());
 
+  // Text can also be streamed in chunks, e.g. straight to a file.
+  ChunkedTextSink sink;
+  TEST_EQ(GenerateText(parser, parser.builder_.GetBufferPointer(), &sink, 64),
+          true);
+  TEST_EQ_STR(sink.text.c_str(), jsonfile.c_str());
+  TEST_EQ(sink.num_chunks > 10, true);
+  TEST_EQ(sink.max_chunk < 256, true);
+  ChunkedTextSink failing_sink;
+  failing_sink.fail = true;
+  TEST_EQ(GenerateText(parser, parser.builder_.GetBufferPointer(),
+                       &failing_sink, 64),
+          false);
+  TEST_EQ(failing_sink.num_chunks, 1);
+
+  // With a custom SaveFileFunction, files are saved all at once through it.
+  auto save_file = flatbuffers::SetSaveFileFunction(SaveFileToString);
+  result = flatbuffers::GenerateTextFile(parser, "out/", "monsterdata");
+  flatbuffers::SetSaveFileFunction(save_file);
+  TEST_EQ(result, true);
+  TEST_EQ_STR(saved_file_name.c_str(), "out/monsterdata.json");
+  TEST_EQ_STR(saved_file_text.c_str(), jsonfile.c_str());
+
+  // To convert more JSON with the same schema (e.g. on many threads), use a
+  // JsonConverter, which shares the schema of the parser:
+  {
+    flatbuffers::JsonConverter converter(parser);
+    for (int i = 0; i < 2; i++) {
+      TEST_EQ(converter.Parse(jsonfile.c_str()), true);
+      auto &fbb = converter.builder();
+      AccessFlatBufferTest(fbb.GetBufferPointer(), fbb.GetSize(), false);
+      jsongen.clear();
+      TEST_EQ(GenerateText(parser, fbb.GetBufferPointer(), &jsongen), true);
+      TEST_EQ_STR(jsongen.c_str(), jsonfile.c_str());
+    }
+    TEST_EQ(converter.Parse("table T { a:int; }"), false);
+    TEST_EQ(converter.error().empty(), false);
+    TEST_EQ(converter.Parse("{ unknown_field: 1 }"), false);
+    TEST_EQ(converter.Parse("{ name: \"A\", hp: 1 }"), true);
+    TEST_EQ(GetMonster(converter.builder().GetBufferPointer())->hp(), 1);
+
+    // Newline-delimited JSON becomes a stream of size-prefixed buffers.
+    std::string ndjson;
+    for (int i = 0; i < 1000; i++) {
+      ndjson += "{ name: \"Monster" + flatbuffers::NumToString(i) +
+                "\", hp: " + flatbuffers::NumToString(i) + " }\n";
+      if (i % 100 == 0) ndjson += " \r\n";  // Blank lines are skipped.
+    }
+    // Longer than the blocks the input is read in, and without a newline.
+    ndjson += "{ name: \"" + std::string(100000, 'x') + "\" }";
+    std::stringstream records(ndjson), binaries;
+    TEST_EQ(converter.ConvertStream(records, binaries), true);
+    auto stream = binaries.str();
+    int count = 0;
+    for (size_t offset = 0; offset < stream.size(); count++) {
+      auto buf = reinterpret_cast<const uint8_t *>(stream.data()) + offset;
+      auto size = flatbuffers::GetPrefixedSize(buf) +
+                  sizeof(flatbuffers::uoffset_t);
+      TEST_EQ(offset + size <= stream.size(), true);
+      flatbuffers::Verifier record_verifier(buf, size);
+      TEST_EQ(VerifySizePrefixedMonsterBuffer(record_verifier), true);
+      auto monster = GetSizePrefixedMonster(buf);
+      if (count < 1000) {
+        TEST_EQ(monster->hp(), count);
+      } else {
+        TEST_EQ(monster->name()->size(), 100000);
+      }
+      offset += size;
+    }
+    TEST_EQ(count, 1001);
+
+    // Conversion stops at the first line that fails.
+    std::stringstream bad_records("{ name: \"A\" }\n{ name: \"B\", hp: }\n"
+                                  "{ name: \"C\" }\n");
+    std::stringstream partial;
+    TEST_EQ(converter.ConvertStream(bad_records, partial, "records.json"),
+            false);
+    TEST_EQ(converter.error().find("records.json") != std::string::npos,
+            true);
+    auto written = partial.str();
+    TEST_EQ(written.size(),
+            flatbuffers::GetPrefixedSize(
+                reinterpret_cast<const uint8_t *>(written.data())) +
+                sizeof(flatbuffers::uoffset_t));
+    std::stringstream null_record(std::string("{ name: \"A\" }\0x\n", 16));
+    TEST_EQ(converter.ConvertStream(null_record, partial), false);
+  }
+
   // We can also do the above using the convenient Registry that knows about
   // a set of file_identifiers mapped to schemas.
   flatbuffers::Registry registry;
@@ -701,6 +887,36 @@ void ParseAndGenerateTextTest(bool binary) {
   // If this fails, check registry.lasterror_.
   TEST_EQ(ok, true);
   TEST_EQ_STR(text.c_str(), jsonfile.c_str());
+  // The parsed schema is kept around, so converting more buffers doesn't
+  // parse it again.
+  auto buf2 = registry.TextToFlatBuffer(jsonfile.c_str(), MonsterIdentifier());
+  TEST_NOTNULL(buf2.data());
+  text.clear();
+  TEST_EQ(registry.FlatBufferToText(buf2.data(), buf2.size(), &text), true);
+  TEST_EQ_STR(text.c_str(), jsonfile.c_str());
+  TEST_EQ(registry.TextToFlatBuffer("{ unknown_field: 1 }", MonsterIdentifier())
+              .data() == nullptr,
+          true);
+  TEST_EQ(registry.GetLastError().empty(), false);
+  // Text can't change the schema used by later calls.
+  TEST_EQ(registry.TextToFlatBuffer("table T { a:int; } root_type T; { a: 1 }",
+                                    MonsterIdentifier())
+              .data() == nullptr,
+          true);
+  auto buf3 = registry.TextToFlatBuffer(jsonfile.c_str(), MonsterIdentifier());
+  TEST_NOTNULL(buf3.data());
+  AccessFlatBufferTest(buf3.data(), buf3.size(), false);
+  // Binary schemas load faster, and need no include directories.
+  flatbuffers::Registry bfbs_registry;
+  bfbs_registry.Register(MonsterIdentifier(),
+                         (test_data_path + "monster_test.bfbs").c_str());
+  auto bfbs_buf =
+      bfbs_registry.TextToFlatBuffer(jsonfile.c_str(), MonsterIdentifier());
+  TEST_NOTNULL(bfbs_buf.data());
+  AccessFlatBufferTest(bfbs_buf.data(), bfbs_buf.size(), false);
+  text.clear();
+  TEST_EQ(bfbs_registry.FlatBufferToText(buf.data(), buf.size(), &text), true);
+  TEST_EQ_STR(text.c_str(), jsonfile.c_str());
 
   // Generate text for UTF-8 strings without escapes.
   std::string jsonfile_utf8;
@@ -877,6 +1093,42 @@ void ReflectionTest(uint8_t *flatbuf, size_t length) {
                               resizingbuf.size()),
           true);
 
+  // Many strings and vectors can also be resized in one go, which only
+  // passes over the buffer once.
+  std::vector<uint8_t> batchbuf(flatbuf, flatbuf + length);
+  auto broot = flatbuffers::GetAnyRoot(flatbuffers::vector_data(batchbuf));
+  auto bstrings = flatbuffers::GetFieldV<flatbuffers::Offset<flatbuffers::String>>(
+      *broot, testarrayofstring_field);
+  auto &test4_field = *fields->LookupByKey("test4");
+  flatbuffers::ResizeBatch batch(schema, &batchbuf);
+  batch.SetString("a name that is quite a bit longer",
+                  GetFieldS(*broot, name_field));
+  batch.SetString("b", bstrings->Get(0));
+  batch.SetString("frederick", bstrings->Get(1));
+  batch.ResizeVector<uint8_t>(
+      3, 0, flatbuffers::GetFieldV<uint8_t>(*broot, inventory_field));
+  batch.ResizeVector(
+      5, Test(7, 8), flatbuffers::GetFieldV<Test>(*broot, test4_field));
+  batch.Apply();
+  flatbuffers::Verifier batch_verifier(flatbuffers::vector_data(batchbuf),
+                                       batchbuf.size());
+  TEST_EQ(VerifyMonsterBuffer(batch_verifier), true);
+  TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(),
+                              flatbuffers::vector_data(batchbuf),
+                              batchbuf.size()),
+          true);
+  auto bmonster = GetMonster(flatbuffers::vector_data(batchbuf));
+  TEST_EQ_STR(bmonster->name()->c_str(), "a name that is quite a bit longer");
+  TEST_EQ_STR(bmonster->testarrayofstring()->Get(0)->c_str(), "b");
+  TEST_EQ_STR(bmonster->testarrayofstring()->Get(1)->c_str(), "frederick");
+  TEST_EQ(bmonster->inventory()->size(), 3);
+  TEST_EQ(bmonster->inventory()->Get(2), 2);
+  TEST_EQ(bmonster->test4()->size(), 5);
+  TEST_EQ(bmonster->test4()->Get(1)->b(), 40);
+  TEST_EQ(bmonster->test4()->Get(4)->a(), 7);
+  TEST_EQ(bmonster->hp(), 80);
+  TEST_EQ_STR(bmonster->testarrayoftables()->Get(2)->name()->c_str(), "Wilma");
+
   // As an additional test, also set it on the name field.
   // Note: unlike the name change above, this just overwrites the offset,
   // rather than changing the string in-place.
@@ -1789,6 +2041,49 @@ void InvalidFloatTest() {
   TestError("table T { F:float; } root_type T; { F:null }", invalid_msg);
 }
 
+void FloatTextTest() {
+  const char *schema = "table T { f:float; d:double; } root_type T;";
+  const char *tests[][3] = {
+    // JSON, shortest output, fixed precision output.
+    { "{ f: 0.1, d: 0.1 }", "{f: 0.1,d: 0.1}", "{f: 0.1,d: 0.1}" },
+    { "{ f: 1e-7, d: 1.2345678901234567e23 }",
+      "{f: 1e-7,d: 1.2345678901234567e23}",
+      "{f: 0.0,d: 123456789012345669025792.0}" },
+    { "{ f: -3.4028235e38, d: 5e-324 }", "{f: -3.4028235e38,d: 5e-324}",
+      "{f: -340282346638528859811704183484516925440.0,d: 0.0}" },
+    { "{ f: 16777216, d: -2.5 }", "{f: 16777216.0,d: -2.5}",
+      "{f: 16777216.0,d: -2.5}" },
+  };
+  for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+    for (int fixed = 0; fixed < 2; fixed++) {
+      flatbuffers::IDLOptions opts;
+      opts.indent_step = -1;
+      opts.fixed_precision_floats = fixed != 0;
+      flatbuffers::Parser parser(opts);
+      TEST_EQ(parser.Parse(schema), true);
+      TEST_EQ(parser.Parse(tests[i][0]), true);
+      std::string text;
+      TEST_EQ(GenerateText(parser, parser.builder_.GetBufferPointer(), &text),
+              true);
+      TEST_EQ_STR(text.c_str(), tests[i][1 + fixed]);
+      if (fixed) continue;
+      // The shortest output converts back to exactly the same buffer.
+      flatbuffers::Parser reparser(opts);
+      TEST_EQ(reparser.Parse(schema), true);
+      TEST_EQ(reparser.Parse(text.c_str()), true);
+      TEST_EQ(reparser.builder_.GetSize(), parser.builder_.GetSize());
+      TEST_EQ(memcmp(reparser.builder_.GetBufferPointer(),
+                     parser.builder_.GetBufferPointer(),
+                     parser.builder_.GetSize()),
+              0);
+    }
+  }
+  TEST_EQ_STR(flatbuffers::NumToString(-9223372036854775807LL - 1).c_str(),
+              "-9223372036854775808");
+  TEST_EQ_STR(flatbuffers::NumToString(18446744073709551615ULL).c_str(),
+              "18446744073709551615");
+}
+
 void GenerateTableTextTest() {
   std::string schemafile;
   std::string jsonfile;
@@ -1836,6 +2131,114 @@ void GenerateTableTextTest() {
   TEST_EQ_STR(jsongen.c_str(), "{a: 10,b: 20}");
 }
 
+// The code generated with --gen-json converts to and from JSON the same way
+// GenerateText() and the Parser do, without the schema.
+void GeneratedJsonTest() {
+  std::string schemafile;
+  std::string jsonfile;
+  bool ok =
+      flatbuffers::LoadFile((test_data_path + "monster_test.fbs").c_str(),
+                            false, &schemafile) &&
+      flatbuffers::LoadFile(
+          (test_data_path + "monsterdata_test.golden").c_str(), false,
+          &jsonfile);
+  TEST_EQ(ok, true);
+
+  flatbuffers::FlatBufferBuilder fbb;
+  std::string error;
+  TEST_EQ(MonsterFromJson(jsonfile.c_str(), fbb, &error), true);
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  AccessFlatBufferTest(fbb.GetBufferPointer(), fbb.GetSize(), false);
+  std::string jsongen;
+  TEST_EQ(MonsterToJson(fbb.GetBufferPointer(), &jsongen), true);
+  TEST_EQ_STR(jsongen.c_str(), jsonfile.c_str());
+
+  // Compare with the Parser and GenerateText() on the less common features:
+  // unions before their type, enum flags, hashes, nested FlatBuffers,
+  // FlexBuffers, and the syntax the Parser is lenient about.
+  const char *json =
+      "{ /* comment */ test: { name: 'Fred' }, test_type: Monster,\n"
+      "  name: \"\\u00e9t\\u00e9 \\ud83d\\ude00\", color: \"Red Green\",\n"
+      "  testnestedflatbuffer: { name: \"nested\", hp: 1 },\n"
+      "  flex: { a: [1, 2.5, \"x\", true, null], b: {} },\n"
+      "  testhashu32_fnv1: \"This string is being hashed!\",\n"
+      "  vector_of_enums: [Blue, 'Red', 2], testarrayofbools: [true, 0],\n"
+      "  any_ambiguous_type: M2, any_ambiguous: { name: \"M2\" },\n"
+      "  testf: 1e-3, vector_of_doubles: [-1.5, 1e300], \"enemy\": null,\n"
+      "  test4: [{ a: 1, b: -2 }], testarrayofstring: [\"a\\tb\"], }";
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(test_data_path, "include_test");
+  const char *include_directories[] = { test_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  flatbuffers::Parser parser;
+  ok = parser.Parse(schemafile.c_str(), include_directories) &&
+       parser.Parse(json, include_directories);
+  TEST_EQ(ok, true);
+  std::string expected;
+  TEST_EQ(GenerateText(parser, parser.builder_.GetBufferPointer(), &expected),
+          true);
+  jsongen.clear();
+  TEST_EQ(MonsterToJson(parser.builder_.GetBufferPointer(), &jsongen), true);
+  TEST_EQ_STR(jsongen.c_str(), expected.c_str());
+  fbb.Clear();
+  TEST_EQ(MonsterFromJson(json, fbb, &error), true);
+  jsongen.clear();
+  TEST_EQ(GenerateText(parser, fbb.GetBufferPointer(), &jsongen), true);
+  TEST_EQ_STR(jsongen.c_str(), expected.c_str());
+
+  // The writer takes the same formatting options as GenerateText().
+  parser.opts.strict_json = true;
+  parser.opts.indent_step = -1;
+  expected.clear();
+  TEST_EQ(GenerateText(parser, fbb.GetBufferPointer(), &expected), true);
+  jsongen.clear();
+  flatbuffers::JsonWriter writer(&jsongen, -1, true);
+  TEST_EQ(ToJson(GetMonster(fbb.GetBufferPointer()), writer), true);
+  TEST_EQ_STR(jsongen.c_str(), expected.c_str());
+
+  // Errors.
+  TEST_EQ(MonsterFromJson("{ hp: 1 }", fbb, &error), false);
+  TEST_EQ_STR(error.c_str(), "line 1: error: required field is missing: name");
+  TEST_EQ(MonsterFromJson("{ name: \"a\",\n  nope: 1 }", fbb, &error), false);
+  TEST_EQ_STR(error.c_str(), "line 2: error: unknown field: nope");
+  TEST_EQ(MonsterFromJson("{ name: \"a\" } {}", fbb), false);
+  TEST_EQ(MonsterFromJson("{ name: \"a\", pos: { x: 1 } }", fbb), false);
+  TEST_EQ(MonsterFromJson("{ name: \"a\", color: Purple }", fbb), false);
+  TEST_EQ(MonsterFromJson("{ name: \"a\", test: {} }", fbb), false);
+  TEST_EQ(MonsterFromJson("{ name: \"a\" hp: 1 }", fbb), false);
+  TEST_EQ(MonsterFromJson("{ name: \"\\ud83d\" }", fbb), false);
+  TEST_EQ(MonsterFromJson("{ name: \"a", fbb), false);
+
+  // Nesting is limited, so deeply nested JSON can't overflow the stack, but
+  // any number of objects and arrays may follow each other.
+  std::string nested(10000, '[');
+  TEST_EQ(MonsterFromJson(("{ name: \"a\", flex: " + nested).c_str(), fbb,
+                          &error),
+          false);
+  TEST_EQ(error.find("maximum parsing recursion") != std::string::npos, true);
+  std::string siblings;
+  for (int i = 0; i < 200; i++) siblings += "[[{ a: [] }]],";
+  TEST_EQ(MonsterFromJson(("{ name: \"a\", flex: [" + siblings + "] }").c_str(),
+                          fbb),
+          true);
+
+  // Unknown fields can be skipped.
+  flatbuffers::JsonReader reader("{ name: \"a\", nope: [{ x: 1 }], hp: 5 }",
+                                 true);
+  flatbuffers::Offset<Monster> root;
+  fbb.Clear();
+  TEST_EQ(FromJson(reader, fbb, &root), true);
+  FinishMonsterBuffer(fbb, root);
+  TEST_EQ(GetMonster(fbb.GetBufferPointer())->hp(), 5);
+  auto nested_unknown = "{ nope: " + nested;
+  flatbuffers::JsonReader nested_reader(nested_unknown.c_str(), true);
+  TEST_EQ(FromJson(nested_reader, fbb, &root), false);
+  TEST_EQ(nested_reader.error().find("maximum parsing recursion") !=
+              std::string::npos,
+          true);
+}
+
 template<typename T>
 void NumericUtilsTestInteger(const char *lower, const char *upper) {
   T x;
@@ -1872,6 +2275,66 @@ void NumericUtilsTest() {
   NumericUtilsTestFloat<float>("-1.7977e+308", "+1.7977e+308");
 }
 
+void NumberParsingTest() {
+  // Plain decimal numbers are converted without strtod, which must give the
+  // exact same result.
+  lcg_reset();  // Keep it deterministic.
+  for (int i = 0; i < 100000; i++) {
+    std::string s = lcg_rand() % 2 ? "-" : "";
+    auto int_digits = lcg_rand() % 12, frac_digits = lcg_rand() % 12;
+    for (uint32_t j = 0; j < int_digits + frac_digits; j++) {
+      if (j == int_digits) s += '.';
+      s += static_cast<char>('0' + lcg_rand() % 10);
+    }
+    if (!int_digits && !frac_digits) s += '0';
+    if (lcg_rand() % 2) {
+      auto exp = static_cast<int>(lcg_rand() % 60) - 30;
+      s += "e" + flatbuffers::NumToString(exp);
+    }
+    double d = 0, expected_d = strtod(s.c_str(), nullptr);
+    TEST_EQ(flatbuffers::StringToNumber(s.c_str(), &d), true);
+    TEST_EQ(memcmp(&d, &expected_d, sizeof(d)), 0);
+    float f = 0, expected_f = strtof(s.c_str(), nullptr);
+    TEST_EQ(flatbuffers::StringToNumber(s.c_str(), &f), true);
+    TEST_EQ(memcmp(&f, &expected_f, sizeof(f)), 0);
+  }
+  // Numbers with the most digits and biggest exponents that are converted
+  // without strtod.
+  double d;
+  TEST_EQ(flatbuffers::StringToNumber("9007199254740993e22", &d), true);
+  TEST_EQ(d, 9007199254740993e22);
+  TEST_EQ(flatbuffers::StringToNumber("-0.000000000000000000001", &d), true);
+  TEST_EQ(d, -1e-21);
+  TEST_EQ(flatbuffers::StringToNumber("-0.0", &d), true);
+  TEST_EQ(std::signbit(d), true);
+  float f;
+  TEST_EQ(flatbuffers::StringToNumber("16777216e10", &f), true);
+  TEST_EQ(f, 16777216e10f);
+  TEST_EQ(flatbuffers::StringToNumber("-0.0000000001", &f), true);
+  TEST_EQ(f, -1e-10f);
+  #if FLATBUFFERS_LOCALE_INDEPENDENT
+  // Rounding this to double first gives 0x3f800004 instead of 0x3f800005, so
+  // floats must not be converted through double.
+  uint32_t f_bits;
+  TEST_EQ(flatbuffers::StringToNumber("1.000000536441803", &f), true);
+  memcpy(&f_bits, &f, sizeof(f));
+  TEST_EQ(f_bits, 0x3f800005);
+  #endif
+  TEST_EQ(flatbuffers::StringToNumber("1.5e", &d), false);
+  TEST_EQ(flatbuffers::StringToNumber("1..5", &d), false);
+  TEST_EQ(flatbuffers::StringToNumber("-", &d), false);
+  int64_t i64;
+  TEST_EQ(flatbuffers::StringToNumber("-999999999999999999", &i64), true);
+  TEST_EQ(i64, -999999999999999999LL);
+  TEST_EQ(flatbuffers::StringToNumber("+0012", &i64), true);
+  TEST_EQ(i64, 12);
+  TEST_EQ(flatbuffers::StringToNumber("12a", &i64), false);
+  uint64_t u64;
+  TEST_EQ(flatbuffers::StringToNumber("-1", &u64), false);
+  TEST_EQ(flatbuffers::StringToNumber("-0", &u64), true);
+  TEST_EQ(u64, 0);
+}
+
 void IsAsciiUtilsTest() {
   char c = -128;
   for (int cnt = 0; cnt < 256; cnt++) {
@@ -1906,6 +2369,50 @@ void UnicodeTest() {
               "\\u5225\\u30B5\\u30A4\\u30C8\\u20AC\\u0080\\uD83D\\uDE0E\"}");
 }
 
+void StringConstantTest() {
+  // Runs of plain chars in strings are scanned in blocks, so put special
+  // chars at every position in a block.
+  for (size_t i = 0; i < 20; i++) {
+    const char *specials[][2] = { { "\\n", "\n" },
+                                  { "\\\"", "\"" },
+                                  { "'", "'" },
+                                  { "\xC3\xA9", "\xC3\xA9" },
+                                  { "~\x7F", "~\x7F" } };
+    for (size_t j = 0; j < sizeof(specials) / sizeof(specials[0]); j++) {
+      flatbuffers::Parser parser;
+      std::string head(i, 'a'), tail(20 - i, 'b');
+      auto json = "table T { F:string; } root_type T; { F: \"" + head +
+                  specials[j][0] + tail + "\" }";
+      TEST_EQ(parser.Parse(json.c_str()), true);
+      auto root = flatbuffers::GetRoot<flatbuffers::Table>(
+          parser.builder_.GetBufferPointer());
+      auto str = root->GetPointer<const flatbuffers::String *>(4);
+      TEST_EQ_STR(str->c_str(), (head + specials[j][1] + tail).c_str());
+    }
+    flatbuffers::Parser parser;
+    auto json = "table T { F:string; } root_type T; { F: \"" +
+                std::string(i, 'a') + "\n\" }";
+    TEST_EQ(parser.Parse(json.c_str()), false);
+  }
+}
+
+void BlankRunTest() {
+  // Runs of spaces are skipped in blocks, so end them at every position in a
+  // block, and check that line and column numbers are still right.
+  for (size_t i = 0; i < 20; i++) {
+    flatbuffers::Parser parser;
+    std::string blanks(i, ' ');
+    auto json = "table T { F:int; } root_type T;\n{" + blanks + "\t F:" +
+                blanks + "\r\n" + blanks + "1," + blanks + "\n" + blanks +
+                "G: 2 }";
+    TEST_EQ(parser.Parse(json.c_str()), false);
+    auto col = flatbuffers::NumToString(i + 4);
+    TEST_EQ(parser.error_.find("4: " + col + ": error: unknown field: G") !=
+                std::string::npos,
+            true);
+  }
+}
+
 void UnicodeTestAllowNonUTF8() {
   flatbuffers::Parser parser;
   parser.opts.allow_non_utf8 = true;
@@ -2258,6 +2765,21 @@ void UnionVectorTest() {
   TEST_EQ(VerifyMovieBuffer(jverifier), true);
   TestMovie(GetMovie(jbuf));
 
+  // The code generated with --gen-json writes it as the Parser reads it.
+  // GenerateText() has no support for vectors of unions to compare with.
+  std::string jsongen;
+  flatbuffers::JsonWriter writer(&jsongen, -1, false);
+  TEST_EQ(ToJson(GetMovie(jbuf), writer), true);
+  TEST_EQ_STR(jsongen.c_str(),
+              "{main_character_type: \"Rapunzel\","
+              "main_character: {hair_length: 6},"
+              "characters_type: [\"Belle\",\"MuLan\",\"BookFan\","
+              "\"Other\",\"Unused\"],"
+              "characters: [{books_read: 7},{sword_attack_damage: 5},"
+              "{books_read: 2},\"Other\",\"Unused\"]}");
+  TEST_EQ(parser.Parse(jsongen.c_str()), true);
+  TestMovie(GetMovie(parser.builder_.GetBufferPointer()));
+
   auto movie_object = flat_movie->UnPack();
   TEST_EQ(movie_object->main_character.AsRapunzel()->hair_length(), 6);
   TEST_EQ(movie_object->characters[0].AsBelle()->books_read(), 7);
@@ -2498,6 +3020,114 @@ void FlexBuffersTest() {
   TEST_EQ_STR(jsontest, jsonback.c_str());
 }
 
+// Three maps with the same keys (one written out of order), followed by a
+// map with its keys out of order that contains another map with those keys.
+void FlexBuffersWriteRecords(flexbuffers::Builder &slb) {
+  auto vec = slb.StartVector();
+  for (int i = 0; i < 3; i++) {
+    auto map = slb.StartMap();
+    if (i == 1) {
+      slb.Int("z", i);
+      slb.Int("a", i * 10);
+      slb.Int("m", i * 100);
+    } else {
+      slb.Int("a", i * 10);
+      slb.Int("m", i * 100);
+      slb.Int("z", i);
+    }
+    slb.EndMap(map);
+  }
+  auto outer = slb.StartMap();
+  slb.Int("x", 1);
+  slb.Key("b");
+  auto inner = slb.StartMap();
+  slb.Int("a", 2);
+  slb.Int("m", 3);
+  slb.Int("z", 4);
+  slb.EndMap(inner);
+  slb.EndMap(outer);
+  slb.EndVector(vec, false, false);
+  slb.Finish();
+}
+
+void FlexBuffersKeyVectorsTest() {
+  flexbuffers::Builder slb(512, flexbuffers::BUILDER_FLAG_SHARE_ALL);
+  FlexBuffersWriteRecords(slb);
+  auto records = flexbuffers::GetRoot(slb.GetBuffer()).AsVector();
+  TEST_EQ(records.size(), 4);
+  auto keys = records[0].AsMap().Keys();
+  TEST_EQ(keys.size(), 3);
+  TEST_EQ_STR(keys[0].AsKey(), "a");
+  TEST_EQ_STR(keys[1].AsKey(), "m");
+  TEST_EQ_STR(keys[2].AsKey(), "z");
+  for (int i = 0; i < 3; i++) {
+    auto map = records[i].AsMap();
+    TEST_EQ(map["a"].AsInt64(), i * 10);
+    TEST_EQ(map["m"].AsInt64(), i * 100);
+    TEST_EQ(map["z"].AsInt64(), i);
+  }
+  auto outer = records[3].AsMap();
+  TEST_EQ_STR(outer.Keys()[0].AsKey(), "b");
+  TEST_EQ(outer["x"].AsInt64(), 1);
+  auto inner = outer["b"].AsMap();
+  TEST_EQ(inner.Keys().size(), 3);
+  TEST_EQ(inner["z"].AsInt64(), 4);
+
+  // Without sharing key vectors, every map gets its own copy.
+  flexbuffers::Builder unshared(512, flexbuffers::BUILDER_FLAG_SHARE_KEYS);
+  FlexBuffersWriteRecords(unshared);
+  TEST_EQ(unshared.GetBuffer().size() > slb.GetBuffer().size(), true);
+  records = flexbuffers::GetRoot(unshared.GetBuffer()).AsVector();
+  TEST_EQ(records[1].AsMap()["a"].AsInt64(), 10);
+  TEST_EQ(records[3].AsMap()["b"].AsMap()["m"].AsInt64(), 3);
+}
+
+void FlexBuffersHashedMapTest() {
+  // Only maps of 256 keys or more get a hash table.
+  const int num_keys = 300;
+  for (int hashed = 0; hashed < 2; hashed++) {
+    flexbuffers::Builder slb(
+        512, static_cast<flexbuffers::BuilderFlag>(
+                 flexbuffers::BUILDER_FLAG_SHARE_KEYS |
+                 (hashed ? flexbuffers::BUILDER_FLAG_HASH_MAPS : 0)));
+    auto vec = slb.StartVector();
+    auto big = slb.StartMap();
+    for (int i = 0; i < num_keys; i++) {
+      slb.Int(("key" + flatbuffers::NumToString(i)).c_str(), i);
+    }
+    slb.EndMap(big);
+    auto small = slb.StartMap();
+    slb.Int("a", 1);
+    slb.EndMap(small);
+    slb.EndVector(vec, false, false);
+    slb.Finish();
+
+    auto root = flexbuffers::GetRoot(slb.GetBuffer()).AsVector();
+    auto map = root[0].AsMap();
+    TEST_EQ(map.HashTable().size() >= 2 * num_keys, hashed != 0);
+    TEST_EQ(root[1].AsMap().HashTable().size(), 0);
+    TEST_EQ(root[1].AsMap()["a"].AsInt64(), 1);
+    flexbuffers::MapLookup lookup(map);
+    for (int i = 0; i < num_keys; i++) {
+      auto key = "key" + flatbuffers::NumToString(i);
+      TEST_EQ(map[key].AsInt64(), i);
+      TEST_EQ(lookup[key].AsInt64(), i);
+    }
+    TEST_EQ(map["key"].IsNull(), true);
+    TEST_EQ(lookup["key300"].IsNull(), true);
+    TEST_EQ(flexbuffers::MapLookup(root[1].AsMap())["b"].IsNull(), true);
+    // Readers that don't know about the hash table still see sorted keys with
+    // their values.
+    auto keys = map.Keys();
+    auto values = map.Values();
+    TEST_EQ(keys.size(), static_cast<size_t>(num_keys));
+    for (size_t i = 1; i < keys.size(); i++) {
+      TEST_EQ(strcmp(keys[i - 1].AsKey(), keys[i].AsKey()) < 0, true);
+      TEST_EQ_STR(keys[i].AsKey() + 3, values[i].ToString().c_str());
+    }
+  }
+}
+
 void TypeAliasesTest() {
   flatbuffers::FlatBufferBuilder builder;
 
@@ -2611,6 +3241,47 @@ void LoadVerifyBinaryTest() {
   }
 }
 
+void MapFileTest() {
+  auto filename = test_data_path + "monsterdata_test.mon";
+  std::string loaded;
+  TEST_EQ(flatbuffers::LoadFile(filename.c_str(), true, &loaded), true);
+
+  // The mapped file has the same contents, and can be verified and read in
+  // place.
+  flatbuffers::MappedFile file;
+  TEST_EQ(flatbuffers::MapFile(filename.c_str(), &file), true);
+  TEST_EQ(file.size(), loaded.size());
+  TEST_EQ(memcmp(file.data(), loaded.data(), loaded.size()), 0);
+  flatbuffers::Verifier verifier(file.data(), file.size());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ_STR(GetMonster(file.data())->name()->c_str(), "MyMonster");
+
+  // Mapping again replaces the previous contents.
+  TEST_EQ(flatbuffers::MapFile((test_data_path + "monster_test.fbs").c_str(),
+                               &file),
+          true);
+  TEST_EQ(memcmp(file.data(), "// test schema", 14), 0);
+
+  TEST_EQ(flatbuffers::MapFile((test_data_path + "no-such-file").c_str(),
+                               &file),
+          false);
+  TEST_EQ(file.size(), 0);
+  file.Reset();
+  TEST_EQ(file.size(), 0);
+
+  // A custom MapFileFunction can hand out contents it loaded itself.
+  auto previous = flatbuffers::SetMapFileFunction(
+      [](const char *, flatbuffers::MappedFile *mapped) {
+        std::string contents = "hello";
+        mapped->Assign(&contents);
+        return true;
+      });
+  TEST_EQ(flatbuffers::MapFile(filename.c_str(), &file), true);
+  TEST_EQ(file.size(), 5);
+  TEST_EQ(memcmp(file.data(), "hello", 5), 0);
+  flatbuffers::SetMapFileFunction(previous);
+}
+
 void CreateSharedStringTest() {
   flatbuffers::FlatBufferBuilder builder;
   const auto one1 = builder.CreateSharedString("one");
@@ -2661,6 +3332,500 @@ void CreateSharedStringTest() {
   TEST_EQ((*a[5]) < (*a[4]), false);
   TEST_EQ((*a[5]) < (*a[4]), false);
   TEST_EQ((*a[6]) < (*a[5]), true);
+
+  // 2 of the 7 strings above were shared.
+  TEST_EQ(builder.GetSharedStringHits(), 2U);
+  TEST_EQ(builder.GetSharedStringMisses(), 5U);
+  builder.Clear();
+  TEST_EQ(builder.GetSharedStringHits(), 0U);
+
+  // Only strings seen before the pool is full get shared.
+  builder.SetSharedStringPoolLimit(1024);
+  std::vector<flatbuffers::Offset<flatbuffers::String>> first, second;
+  for (int pass = 0; pass < 2; pass++) {
+    for (int i = 0; i < 1000; i++) {
+      auto s = builder.CreateSharedString(flatbuffers::NumToString(i));
+      (pass ? second : first).push_back(s);
+    }
+  }
+  TEST_EQ(first.front().o, second.front().o);
+  TEST_EQ(first.back().o != second.back().o, true);
+  TEST_EQ(builder.GetSharedStringHits() + builder.GetSharedStringMisses(),
+          2000U);
+  TEST_EQ(builder.GetSharedStringHits() < 1000U, true);
+}
+
+void VTableDedupTest() {
+  // Enough distinct table shapes to make the vtable index grow a few times.
+  const int kNumShapes = 300;
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::uoffset_t> tables;
+  for (int pass = 0; pass < 2; pass++) {
+    for (int shape = 0; shape < kNumShapes; shape++) {
+      auto start = builder.StartTable();
+      // Each bit of the shape number is a field that is present.
+      for (int field = 0; field < 9; field++) {
+        if (shape & (1 << field)) {
+          builder.AddElement<int32_t>(
+              flatbuffers::FieldIndexToOffset(
+                  static_cast<flatbuffers::voffset_t>(field)),
+              pass * kNumShapes + shape, 0);
+        }
+      }
+      tables.push_back(builder.EndTable(start));
+    }
+  }
+  auto vtable_of = [&](flatbuffers::uoffset_t table) {
+    auto t = flatbuffers::GetTemporaryPointer(
+        builder, flatbuffers::Offset<flatbuffers::Table>(table));
+    return t->GetVTable();
+  };
+  // Tables with identical vtable contents must share a single vtable.
+  // (Same shapes don't always have identical vtables, since the table size
+  // includes alignment padding).
+  size_t num_shared = 0;
+  for (size_t i = 0; i < tables.size(); i++) {
+    for (size_t j = 0; j < i; j++) {
+      auto vt1 = vtable_of(tables[i]);
+      auto vt2 = vtable_of(tables[j]);
+      auto vt1_size = flatbuffers::ReadScalar<flatbuffers::voffset_t>(vt1);
+      auto same = vt1_size ==
+                      flatbuffers::ReadScalar<flatbuffers::voffset_t>(vt2) &&
+                  !memcmp(vt1, vt2, vt1_size);
+      TEST_EQ(same, vt1 == vt2);
+      if (same) num_shared++;
+    }
+  }
+  TEST_EQ(num_shared > 0, true);
+  // Vtables are forgotten with the rest of the buffer, so a new one gets
+  // written rather than referring to a stale one.
+  builder.Clear();
+  auto start = builder.StartTable();
+  builder.AddElement<int32_t>(flatbuffers::FieldIndexToOffset(1), 1, 0);
+  auto table = builder.EndTable(start);
+  auto buf = builder.GetCurrentBufferPointer();
+  TEST_EQ(vtable_of(table) >= buf, true);
+  TEST_EQ(vtable_of(table) < buf + builder.GetSize(), true);
+}
+
+void FixedLayoutCreateTest() {
+  using namespace MyGame::Example;
+  flatbuffers::FlatBufferBuilder builder;
+  // With all fields present CreateStat() writes a table of fixed layout,
+  // otherwise it goes through StatBuilder.
+  flatbuffers::Offset<Stat> stats[] = {
+    CreateStat(builder, builder.CreateString("one"), 1, 10),
+    CreateStat(builder, builder.CreateString("two"), -2, 20),
+    CreateStat(builder, builder.CreateString("three"), 0, 30),
+  };
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (size_t i = 0; i < 3; i++) {
+    monsters.push_back(CreateMonster(builder, nullptr, 0, 0,
+                                     builder.CreateString("m"), 0, Color_Blue,
+                                     Any_NONE, 0, 0, 0, 0, 0, 0, stats[i]));
+  }
+  FinishMonsterBuffer(
+      builder, CreateMonster(builder, nullptr, 0, 0, builder.CreateString("r"),
+                             0, Color_Blue, Any_NONE, 0, 0, 0,
+                             builder.CreateVector(monsters)));
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+
+  auto table_of = [](const void *table) {
+    return reinterpret_cast<const flatbuffers::Table *>(table);
+  };
+  auto tables = GetMonster(builder.GetBufferPointer())->testarrayoftables();
+  auto one = tables->Get(0)->testempty();
+  auto two = tables->Get(1)->testempty();
+  auto three = tables->Get(2)->testempty();
+  TEST_EQ_STR(one->id()->c_str(), "one");
+  TEST_EQ(one->val(), 1);
+  TEST_EQ(one->count(), 10);
+  TEST_EQ_STR(two->id()->c_str(), "two");
+  TEST_EQ(two->val(), -2);
+  TEST_EQ(two->count(), 20);
+  TEST_EQ_STR(three->id()->c_str(), "three");
+  TEST_EQ(table_of(three)->CheckField(Stat::VT_VAL), false);
+  TEST_EQ(three->count(), 30);
+  // The fixed layout tables share a single vtable.
+  TEST_EQ(table_of(one)->GetVTable() == table_of(two)->GetVTable(), true);
+  TEST_EQ(table_of(one)->GetVTable() == table_of(three)->GetVTable(), false);
+
+  // After Clear(), the vtable is written again rather than referring to the
+  // one of the previous buffer.
+  builder.Clear();
+  auto s3 = CreateStat(builder, builder.CreateString("three"), 3, 30);
+  auto vt3 = table_of(flatbuffers::GetTemporaryPointer(builder, s3))
+                 ->GetVTable();
+  auto buf = builder.GetCurrentBufferPointer();
+  TEST_EQ(vt3 >= buf, true);
+  TEST_EQ(vt3 < buf + builder.GetSize(), true);
+  TEST_EQ(flatbuffers::GetTemporaryPointer(builder, s3)->count(), 30);
+
+  // Without deduplication each table gets its own copy.
+  builder.Clear();
+  builder.DedupVtables(false);
+  auto s1 = CreateStat(builder, builder.CreateString("one"), 1, 10);
+  auto s2 = CreateStat(builder, builder.CreateString("two"), 2, 20);
+  auto vt1 = table_of(flatbuffers::GetTemporaryPointer(builder, s1))
+                 ->GetVTable();
+  auto vt2 = table_of(flatbuffers::GetTemporaryPointer(builder, s2))
+                 ->GetVTable();
+  TEST_EQ(vt1 == vt2, false);
+  auto vt_size = flatbuffers::ReadScalar<flatbuffers::voffset_t>(vt1);
+  TEST_EQ(memcmp(vt1, vt2, vt_size), 0);
+}
+
+void VerifyVectorOfStringsTest() {
+  // Enough strings to exercise both the 8-at-a-time fast path (when
+  // available) and the element-wise remainder.
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<std::string> strings;
+  for (int i = 0; i < 37; i++) {
+    strings.push_back(std::string(static_cast<size_t>(i % 7),
+                                  static_cast<char>('a' + i % 26)));
+  }
+  // Put the strings last, so they determine the size of the buffer.
+  auto vec = builder.CreateVectorOfStrings(strings);
+  auto name = builder.CreateString("strings");
+  MonsterBuilder monster_builder(builder);
+  monster_builder.add_name(name);
+  monster_builder.add_testarrayofstring(vec);
+  FinishMonsterBuffer(builder, monster_builder.Finish());
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+    TEST_EQ(verifier.GetComputedSize(), builder.GetSize());
+  #endif
+  // clang-format on
+  auto monster = GetMonster(builder.GetBufferPointer());
+  for (flatbuffers::uoffset_t i = 0; i < strings.size(); i++) {
+    TEST_EQ(monster->testarrayofstring()->Get(i)->str(), strings[i]);
+  }
+
+  // clang-format off
+  #ifndef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
+    // Each check of the fast path must also fail a string inside a full
+    // block of 8: an offset out of bounds, a length running past the end of
+    // the buffer, and a missing terminator.
+    for (int corruption = 0; corruption < 3; corruption++) {
+      std::vector<uint8_t> buf(builder.GetBufferPointer(),
+                               builder.GetBufferPointer() + builder.GetSize());
+      auto vec = GetMutableMonster(buf.data())->mutable_testarrayofstring();
+      auto elem = vec->Data() + 3 * sizeof(flatbuffers::uoffset_t);
+      auto str = reinterpret_cast<uint8_t *>(
+          const_cast<flatbuffers::String *>(vec->Get(3)));
+      TEST_EQ(vec->Get(3)->size(), 3U);
+      switch (corruption) {
+        case 0:
+          flatbuffers::WriteScalar<flatbuffers::uoffset_t>(elem, 0x7FFFFFF0);
+          break;
+        case 1:
+          flatbuffers::WriteScalar(
+              str, static_cast<flatbuffers::uoffset_t>(buf.size()));
+          break;
+        default:
+          str[sizeof(flatbuffers::uoffset_t) + 3] = 'x';
+          break;
+      }
+      flatbuffers::Verifier corrupt_verifier(buf.data(), buf.size());
+      TEST_EQ(VerifyMonsterBuffer(corrupt_verifier), false);
+    }
+  #endif
+  // clang-format on
+}
+
+void ParallelVerifierTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 100; i++) {
+    auto name = builder.CreateString("monster" + flatbuffers::NumToString(i));
+    auto inventory = builder.CreateVector(std::vector<uint8_t>(i, 1));
+    monsters.push_back(CreateMonster(builder, nullptr, 150, 80, name,
+                                     inventory));
+  }
+  auto tables = builder.CreateVector(monsters);
+  auto name = builder.CreateString("root");
+  MonsterBuilder monster_builder(builder);
+  monster_builder.add_name(name);
+  monster_builder.add_testarrayoftables(tables);
+  FinishMonsterBuffer(builder, monster_builder.Finish());
+
+  // Run the tasks one after another, in reverse, to make sure the result
+  // doesn't depend on the order they run in.
+  size_t tasks_run = 0;
+  auto parallel_for = [&](size_t num_tasks,
+                          const std::function<void(size_t)> &task) {
+    for (auto i = num_tasks; i > 0;) {
+      task(--i);
+      tasks_run++;
+    }
+  };
+  flatbuffers::Verifier serial_verifier(builder.GetBufferPointer(),
+                                        builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(serial_verifier), true);
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  verifier.SetParallelFor(parallel_for, 7, 50);
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(tasks_run, 7U);
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+    TEST_EQ(verifier.GetComputedSize(), serial_verifier.GetComputedSize());
+  #endif
+  // clang-format on
+
+  // Below the minimum size, vectors are verified as usual.
+  tasks_run = 0;
+  TEST_EQ(flatbuffers::VerifyBufferParallel<Monster>(
+              builder.GetBufferPointer(), builder.GetSize(), parallel_for, 4,
+              MonsterIdentifier()),
+          true);
+  TEST_EQ(tasks_run, 0U);
+
+  // The same, with each part verified on a thread of its own.
+  auto threaded_for = [](size_t num_tasks,
+                         const std::function<void(size_t)> &task) {
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < num_tasks; i++) threads.emplace_back(task, i);
+    for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+  };
+  flatbuffers::Verifier threaded_verifier(builder.GetBufferPointer(),
+                                          builder.GetSize());
+  threaded_verifier.SetParallelFor(threaded_for, 7, 50);
+  TEST_EQ(VerifyMonsterBuffer(threaded_verifier), true);
+
+  // A corrupt table in one of the parts fails the whole buffer. Verification
+  // failures assert with FLATBUFFERS_DEBUG_VERIFICATION_FAILURE, so this can
+  // only be checked without it.
+  // clang-format off
+  #ifndef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
+    std::vector<uint8_t> corrupt(builder.GetBufferPointer(),
+                                 builder.GetBufferPointer() +
+                                     builder.GetSize());
+    auto name60 = GetMonster(builder.GetBufferPointer())
+                      ->testarrayoftables()->Get(60)->name();
+    auto length_offset = reinterpret_cast<const uint8_t *>(name60) -
+                         builder.GetBufferPointer();
+    flatbuffers::WriteScalar<flatbuffers::uoffset_t>(
+        corrupt.data() + length_offset, 0x7FFFFFFF);
+    flatbuffers::Verifier corrupt_verifier(corrupt.data(), corrupt.size());
+    corrupt_verifier.SetParallelFor(threaded_for, 7, 50);
+    TEST_EQ(VerifyMonsterBuffer(corrupt_verifier), false);
+    flatbuffers::Verifier corrupt_serial_verifier(corrupt.data(),
+                                                  corrupt.size());
+    TEST_EQ(VerifyMonsterBuffer(corrupt_serial_verifier), false);
+  #endif
+  // clang-format on
+}
+
+void LookupByKeyTest() {
+  // Try all keys (present, missing and out of range) for all vector sizes up
+  // to a few levels of the search tree, in both layouts.
+  for (uint64_t len = 0; len < 40; len++) {
+    flatbuffers::FlatBufferBuilder builder;
+    std::vector<flatbuffers::Offset<Referrable>> referrables;
+    for (uint64_t i = len; i > 0; i--) {
+      referrables.push_back(CreateReferrable(builder, i * 2));
+    }
+    auto sorted = builder.CreateVectorOfSortedTables(&referrables);
+    auto eytzinger = builder.CreateVectorOfEytzingerTables(&referrables);
+    auto sorted_vec = flatbuffers::GetTemporaryPointer(builder, sorted);
+    auto eytzinger_vec = flatbuffers::GetTemporaryPointer(builder, eytzinger);
+    for (uint64_t key = 0; key <= len * 2 + 1; key++) {
+      auto found = sorted_vec->LookupByKey(key);
+      auto found_eytzinger = eytzinger_vec->LookupByKeyEytzinger(key);
+      if (key && !(key & 1)) {
+        TEST_NOTNULL(found);
+        TEST_EQ(found->id(), key);
+        TEST_EQ(found, found_eytzinger);
+      } else {
+        TEST_EQ(found == nullptr, true);
+        TEST_EQ(found_eytzinger == nullptr, true);
+      }
+    }
+  }
+}
+
+void HashIndexTest() {
+  using namespace MyGame::HashIndex;
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Item>> items;
+  std::vector<flatbuffers::Offset<Entry>> entries;
+  for (int i = 0; i < 1000; i++) {
+    items.push_back(CreateItemDirect(
+        builder, ("item" + flatbuffers::NumToString(i)).c_str(), i));
+    entries.push_back(CreateEntry(builder, static_cast<uint64_t>(i) * 7));
+  }
+  auto items_vec = builder.CreateVectorOfSortedTables(&items);
+  auto items_index = CreateInventoryItemsIndex(builder, items_vec);
+  auto entries_vec = builder.CreateVectorOfSortedTables(&entries);
+  auto entries_index = CreateInventoryEntriesIndex(builder, entries_vec);
+  builder.Finish(
+      CreateInventory(builder, items_index, items_vec, entries_vec,
+                      entries_index));
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyInventoryBuffer(verifier), true);
+  auto inventory = GetInventory(builder.GetBufferPointer());
+  TEST_EQ(inventory->items_index()->size(), 2048U);
+  for (int i = 0; i < 1000; i++) {
+    auto item =
+        inventory->items_by_key(("item" + flatbuffers::NumToString(i)).c_str());
+    TEST_NOTNULL(item);
+    TEST_EQ(item->count(), i);
+    TEST_EQ(item, inventory->items()->LookupByKey(item->name()->c_str()));
+    auto entry = inventory->entries_by_key(static_cast<uint64_t>(i) * 7);
+    TEST_NOTNULL(entry);
+    TEST_EQ(entry->id(), static_cast<uint64_t>(i) * 7);
+  }
+  TEST_EQ(inventory->items_by_key("item1000") == nullptr, true);
+  TEST_EQ(inventory->items_by_key("") == nullptr, true);
+  TEST_EQ(inventory->entries_by_key(8) == nullptr, true);
+
+  // Without an index the sorted vector is searched instead.
+  builder.Clear();
+  std::vector<flatbuffers::Offset<Item>> no_index_items;
+  no_index_items.push_back(CreateItemDirect(builder, "b", 2));
+  no_index_items.push_back(CreateItemDirect(builder, "a", 1));
+  auto no_index_vec = builder.CreateVectorOfSortedTables(&no_index_items);
+  builder.Finish(CreateInventory(builder, 0, no_index_vec));
+  inventory = GetInventory(builder.GetBufferPointer());
+  TEST_EQ(inventory->items_by_key("a")->count(), 1);
+  TEST_EQ(inventory->items_by_key("b")->count(), 2);
+  TEST_EQ(inventory->items_by_key("c") == nullptr, true);
+}
+
+void CheckedAccessorsTest(const uint8_t *flatbuf, size_t length) {
+  flatbuffers::Verifier verifier(flatbuf, length);
+  auto monster = verifier.GetRootChecked<Monster>(MonsterIdentifier());
+  TEST_NOTNULL(monster);
+  TEST_EQ(monster->hp(verifier), 80);
+  TEST_EQ(monster->mana(verifier), 150);  // default
+  TEST_EQ_STR(monster->name(verifier)->c_str(), "MyMonster");
+  TEST_EQ(monster->color(verifier), Color_Blue);
+  TEST_EQ(monster->testbool(verifier), false);
+  TEST_EQ(monster->pos(verifier)->z(), 3);
+  TEST_EQ(monster->inventory(verifier)->size(), 10U);
+  TEST_EQ(monster->testarrayoftables(verifier)->size(), 3U);
+  TEST_EQ(monster->enemy(verifier) == nullptr, true);  // Absent.
+
+  // Unions are checked once cast.
+  TEST_EQ(monster->test_type(verifier), Any_Monster);
+  TEST_EQ(monster->test_as_TestSimpleTableWithEnum(verifier) == nullptr,
+          true);
+  auto monster2 = monster->test_as_Monster(verifier);
+  TEST_NOTNULL(monster2);
+  TEST_EQ(monster2->hp(verifier), 100);  // default
+  TEST_EQ_STR(monster2->name(verifier)->c_str(), "Fred");
+
+  // Elements of vectors of tables and strings are checked on access.
+  auto vecofstrings = monster->testarrayofstring(verifier);
+  TEST_EQ_STR(verifier.GetChecked(vecofstrings, 1)->c_str(), "fred");
+  TEST_EQ(verifier.GetChecked(vecofstrings, 4) == nullptr, true);
+  auto vecoftables = monster->testarrayoftables(verifier);
+  TEST_EQ_STR(verifier.GetChecked(vecoftables, 2)->name(verifier)->c_str(),
+              "Wilma");
+
+  // Reading a scalar only touches the root table and its vtable, not the rest
+  // of the buffer.
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+    flatbuffers::Verifier hp_verifier(flatbuf, length);
+    TEST_EQ(hp_verifier.GetRootChecked<Monster>()->hp(hp_verifier), 80);
+    TEST_EQ(hp_verifier.GetComputedSize() < length / 2, true);
+  #endif
+  // clang-format on
+}
+
+void ArenaTest() {
+  using namespace MyGame::ArenaTest;
+  // Objects created outside of any arena scope use the heap.
+  NodeT src;
+  src.name = "root";
+  src.kind = Kind_Large;
+  src.tags.push_back("a fairly long tag, to defeat the small string buffer");
+  src.tags.push_back("b");
+  src.flags.push_back(true);
+  src.flags.push_back(false);
+  src.kinds.push_back(Kind_Large);
+  src.origin.reset(new Point(1, 2));
+  src.path.push_back(Point(3, 4));
+  src.leaf.reset(new LeafT());
+  src.leaf->name = "leaf";
+  src.leaf->values.push_back(42);
+  src.children.emplace_back(new NodeT());
+  src.children[0]->name = "child";
+  LeafT payload_leaf;
+  payload_leaf.name = "payload";
+  src.payload.Set(std::move(payload_leaf));
+  src.payloads.resize(2);
+  src.payloads[0].Set(NodeT());
+  src.payloads[1].type = Payload_Label;
+  src.payloads[1].value = new flatbuffers::ArenaUnionString(
+      "a fairly long label, to defeat the small string buffer", 54);
+  TEST_EQ(src.name.get_allocator().arena() == nullptr, true);
+
+  flatbuffers::FlatBufferBuilder fbb;
+  FinishNodeBuffer(fbb, CreateNode(fbb, &src));
+
+  flatbuffers::Arena arena(256);
+  auto node = UnPackNode(fbb.GetBufferPointer(), arena);
+  TEST_EQ(flatbuffers::Arena::current() == nullptr, true);
+  TEST_EQ(arena.allocated() > 0, true);
+  TEST_EQ_STR(node->name.c_str(), "root");
+  TEST_EQ(node->name.get_allocator().arena(), &arena);
+  TEST_EQ_STR(node->tags[0].c_str(), src.tags[0].c_str());
+  TEST_EQ(node->tags[0].get_allocator().arena(), &arena);
+  TEST_EQ(node->tags.get_allocator().arena(), &arena);
+  TEST_EQ(node->flags.size(), 2U);
+  TEST_EQ(node->flags[0], true);
+  TEST_EQ(node->kinds[0], Kind_Large);
+  TEST_EQ(node->origin->y(), 2);
+  TEST_EQ(node->path[0].x(), 3);
+  TEST_EQ(node->leaf->values[0], 42);
+  TEST_EQ(node->leaf->values.get_allocator().arena(), &arena);
+  TEST_EQ_STR(node->children[0]->name.c_str(), "child");
+  TEST_EQ_STR(node->payload.AsLeaf()->name.c_str(), "payload");
+  TEST_EQ(node->payloads[0].type, Payload_Node);
+  TEST_EQ(*node->payloads[1].AsLabel() == *src.payloads[1].AsLabel(), true);
+  TEST_EQ(node->payloads[1].AsLabel()->get_allocator().arena(), &arena);
+
+  // The arena copy packs to the same buffer.
+  flatbuffers::FlatBufferBuilder fbb2;
+  FinishNodeBuffer(fbb2, CreateNode(fbb2, node.get()));
+  TEST_EQ(fbb2.GetSize(), fbb.GetSize());
+  TEST_EQ(memcmp(fbb2.GetBufferPointer(), fbb.GetBufferPointer(),
+                 fbb.GetSize()),
+          0);
+
+  // Modifying the tree after the scope keeps using the arena it came from,
+  // and new objects go on the heap.
+  auto allocated = arena.allocated();
+  node->name.append(100, 'x');
+  TEST_EQ(arena.allocated() > allocated, true);
+  node->children.emplace_back(new NodeT());
+  node->children.back()->name = "heap";
+  TEST_EQ(node->children.back()->name.get_allocator().arena() == nullptr,
+          true);
+
+  // Destroying a tree runs destructors, so the heap objects are freed.
+  node.reset();
+  arena.Reset();
+  TEST_EQ(arena.allocated(), 0U);
+
+  // A tree that only owns arena memory can be dropped without destructors.
+  node = UnPackNode(fbb.GetBufferPointer(), arena);
+  TEST_EQ_STR(node->leaf->name.c_str(), "leaf");
+  TEST_EQ(node->payloads[1].AsLabel()->get_allocator().arena(), &arena);
+  node.release();
+  arena.Reset();
+  TEST_EQ(arena.allocated(), 0U);
 }
 
 int FlatBufferTests() {
@@ -2681,10 +3846,12 @@ int FlatBufferTests() {
   AccessFlatBufferTest(reinterpret_cast<const uint8_t *>(rawbuf.c_str()),
                        rawbuf.length());
   AccessFlatBufferTest(flatbuf.data(), flatbuf.size());
+  CheckedAccessorsTest(flatbuf.data(), flatbuf.size());
 
   MutateFlatBuffersTest(flatbuf.data(), flatbuf.size());
 
   ObjectFlatBuffersTest(flatbuf.data());
+  ObjectReuseTest(flatbuf.data());
 
   MiniReflectFlatBuffersTest(flatbuf.data());
 
@@ -2701,7 +3868,9 @@ int FlatBufferTests() {
     ParseProtoTest();
     UnionVectorTest();
     LoadVerifyBinaryTest();
+    MapFileTest();
     GenerateTableTextTest();
+    GeneratedJsonTest();
   #endif
   // clang-format on
 
@@ -2717,6 +3886,8 @@ int FlatBufferTests() {
   IntegerOutOfRangeTest();
   IntegerBoundaryTest();
   UnicodeTest();
+  StringConstantTest();
+  BlankRunTest();
   UnicodeTestAllowNonUTF8();
   UnicodeTestGenerateTextFailsOnNonUTF8();
   UnicodeSurrogatesTest();
@@ -2730,19 +3901,107 @@ int FlatBufferTests() {
   TypeAliasesTest();
   EndianSwapTest();
   CreateSharedStringTest();
+  LookupByKeyTest();
+  HashIndexTest();
+  ArenaTest();
+  VTableDedupTest();
+  FixedLayoutCreateTest();
+  VerifyVectorOfStringsTest();
+  ParallelVerifierTest();
   JsonDefaultTest();
   FlexBuffersTest();
+  FlexBuffersKeyVectorsTest();
+  FlexBuffersHashedMapTest();
   UninitializedVectorTest();
   EqualOperatorTest();
   NumericUtilsTest();
+  NumberParsingTest();
   IsAsciiUtilsTest();
   ValidFloatTest();
   InvalidFloatTest();
+  FloatTextTest();
   TestMonsterExtraFloats();
   return 0;
 }
 
-int main(int /*argc*/, const char * /*argv*/ []) {
+// Benchmarks, run with `flattests --benchmark` instead of the tests.
+// Prints the average time f takes over `iterations` calls.
+template<typename F>
+void Benchmark(const char *name, int iterations, const F &f) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) f();
+  std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - start;
+  TEST_OUTPUT_LINE("%-45s %9.2f us", name, elapsed.count() / iterations);
+}
+
+// Loads monster_test.fbs into parser, and monsterdata_test.golden into json.
+void LoadMonsterBenchmarkData(flatbuffers::Parser *parser, std::string *json) {
+  std::string schemafile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "monster_test.fbs").c_str(),
+                                false, &schemafile),
+          true);
+  TEST_EQ(flatbuffers::LoadFile(
+              (test_data_path + "monsterdata_test.golden").c_str(), false,
+              json),
+          true);
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(test_data_path, "include_test");
+  const char *include_directories[] = { test_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  TEST_EQ(parser->Parse(schemafile.c_str(), include_directories), true);
+}
+
+void JsonFieldLookupBenchmark() {
+  flatbuffers::Parser parser;
+  std::string json;
+  LoadMonsterBenchmarkData(&parser, &json);
+  flatbuffers::JsonConverter converter(parser);
+  TEST_EQ(converter.Parse(json.c_str()), true);
+  Benchmark("JSON to binary, hashed field names", 20000,
+            [&]() { converter.Parse(json.c_str()); });
+  // Without its table, LookupField() falls back to fields.Lookup(), the
+  // std::map used before.
+  for (auto it = parser.structs_.vec.begin(); it != parser.structs_.vec.end();
+       ++it) {
+    (*it)->field_lookup.clear();
+  }
+  Benchmark("JSON to binary, field names in a std::map", 20000,
+            [&]() { converter.Parse(json.c_str()); });
+}
+
+// Compares the code generated with --gen-json to the schema driven Parser
+// and GenerateText().
+void GeneratedJsonBenchmark() {
+  flatbuffers::Parser parser;
+  std::string json;
+  LoadMonsterBenchmarkData(&parser, &json);
+  TEST_EQ(parser.Parse(json.c_str()), true);
+  Benchmark("JSON to binary, Parser", 20000,
+            [&]() { parser.Parse(json.c_str()); });
+  flatbuffers::FlatBufferBuilder fbb;
+  Benchmark("JSON to binary, generated FromJson", 20000, [&]() {
+    fbb.Clear();
+    MonsterFromJson(json.c_str(), fbb);
+  });
+  std::string text;
+  Benchmark("binary to JSON, GenerateText", 20000, [&]() {
+    text.clear();
+    GenerateText(parser, parser.builder_.GetBufferPointer(), &text);
+  });
+  Benchmark("binary to JSON, generated ToJson", 20000, [&]() {
+    text.clear();
+    MonsterToJson(parser.builder_.GetBufferPointer(), &text);
+  });
+}
+
+int FlatBufferBenchmarks() {
+  JsonFieldLookupBenchmark();
+  GeneratedJsonBenchmark();
+  return 0;
+}
+
+int main(int argc, const char *argv[]) {
   InitTestEngine();
 
   std::string req_locale;
@@ -2757,6 +4016,11 @@ int main(int /*argc*/, const char * /*argv*/ []) {
     TEST_OUTPUT_LINE("The global C-locale changed: %s", the_locale.c_str());
   }
 
+  if (argc > 1 && !strcmp(argv[1], "--benchmark")) {
+    FlatBufferBenchmarks();
+    return CloseTestEngine();
+  }
+
   FlatBufferTests();
   FlatBufferBuilderTest();
 
@@ -5,6 +5,7 @@
 #define FLATBUFFERS_GENERATED_UNIONVECTOR_H_
 
 #include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/json.h"
 
 struct Attacker;
 struct AttackerT;
@@ -96,6 +97,7 @@ struct CharacterUnion {
   void Reset();
 
   static void *UnPack(const void *obj, Character type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackFrom(const void *obj, Character _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   AttackerT *AsMuLan() {
@@ -321,6 +323,12 @@ struct AttackerBuilder {
 inline flatbuffers::Offset<Attacker> CreateAttacker(
     flatbuffers::FlatBufferBuilder &_fbb,
     int32_t sword_attack_damage = 0) {
+  if (!flatbuffers::IsTheSameAs<int32_t>(sword_attack_damage, 0)) {
+    static const flatbuffers::voffset_t vtable_[] = { 6, 8, 4 };
+    auto table_ = _fbb.StartFixedTable(8, 4);
+    flatbuffers::WriteScalar<int32_t>(table_ + 4, sword_attack_damage);
+    return flatbuffers::Offset<Attacker>(_fbb.EndFixedTable(vtable_));
+  }
   AttackerBuilder builder_(_fbb);
   builder_.add_sword_attack_damage(sword_attack_damage);
   return builder_.Finish();
@@ -450,6 +458,18 @@ inline flatbuffers::Offset<Movie> CreateMovie(
     flatbuffers::Offset<void> main_character = 0,
     flatbuffers::Offset<flatbuffers::Vector<uint8_t>> characters_type = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<void>>> characters = 0) {
+  if (!flatbuffers::IsTheSameAs<uint8_t>(static_cast<uint8_t>(main_character_type), 0) &&
+      main_character.o &&
+      characters_type.o &&
+      characters.o) {
+    static const flatbuffers::voffset_t vtable_[] = { 12, 17, 16, 4, 8, 12 };
+    auto table_ = _fbb.StartFixedTable(17, 4);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 16, static_cast<uint8_t>(main_character_type));
+    _fbb.AddFixedOffset(table_, 4, main_character);
+    _fbb.AddFixedOffset(table_, 8, characters_type);
+    _fbb.AddFixedOffset(table_, 12, characters);
+    return flatbuffers::Offset<Movie>(_fbb.EndFixedTable(vtable_));
+  }
   MovieBuilder builder_(_fbb);
   builder_.add_characters(characters);
   builder_.add_characters_type(characters_type);
@@ -511,10 +531,8 @@ inline MovieT *Movie::UnPack(const flatbuffers::resolver_function_t *_resolver)
 inline void Movie::UnPackTo(MovieT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = main_character_type(); _o->main_character.type = _e; };
-  { auto _e = main_character(); if (_e) _o->main_character.value = CharacterUnion::UnPack(_e, main_character_type(), _resolver); };
-  { auto _e = characters_type(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].type = static_cast<Character>(_e->Get(_i)); } } };
-  { auto _e = characters(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].value = CharacterUnion::UnPack(_e->Get(_i), characters_type()->GetEnum<Character>(_i), _resolver); } } };
+  { auto _e = main_character(); _o->main_character.UnPackFrom(_e, main_character_type(), _resolver); };
+  { auto _e = characters(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].UnPackFrom(_e->Get(_i), characters_type()->GetEnum<Character>(_i), _resolver); } } else _o->characters.clear(); };
 }
 
 inline flatbuffers::Offset<Movie> Movie::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MovieT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -609,6 +627,53 @@ inline void *CharacterUnion::UnPack(const void *obj, Character type, const flatb
   }
 }
 
+inline void CharacterUnion::UnPackFrom(const void *obj, Character _type, const flatbuffers::resolver_function_t *resolver) {
+  if (obj && value && _type == type) {
+    switch (type) {
+      case Character_MuLan: {
+        auto ptr = reinterpret_cast<const Attacker *>(obj);
+        auto _o = reinterpret_cast<AttackerT *>(value);
+        ptr->UnPackTo(_o, resolver);
+        return;
+      }
+      case Character_Rapunzel: {
+        auto ptr = reinterpret_cast<const Rapunzel *>(obj);
+        auto _o = reinterpret_cast<Rapunzel *>(value);
+        *_o = *ptr;
+        return;
+      }
+      case Character_Belle: {
+        auto ptr = reinterpret_cast<const BookReader *>(obj);
+        auto _o = reinterpret_cast<BookReader *>(value);
+        *_o = *ptr;
+        return;
+      }
+      case Character_BookFan: {
+        auto ptr = reinterpret_cast<const BookReader *>(obj);
+        auto _o = reinterpret_cast<BookReader *>(value);
+        *_o = *ptr;
+        return;
+      }
+      case Character_Other: {
+        auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+        auto _o = reinterpret_cast<std::string *>(value);
+        _o->assign(ptr->c_str(), ptr->size());
+        return;
+      }
+      case Character_Unused: {
+        auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+        auto _o = reinterpret_cast<std::string *>(value);
+        _o->assign(ptr->c_str(), ptr->size());
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  if (obj) value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> CharacterUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Character_MuLan: {
@@ -708,6 +773,283 @@ inline void CharacterUnion::Reset() {
   type = Character_NONE;
 }
 
+inline void ToJson(Character _e, flatbuffers::JsonWriter &_writer) {
+  switch (_e) {
+    case Character_NONE: _writer.Enum("NONE"); break;
+    case Character_MuLan: _writer.Enum("MuLan"); break;
+    case Character_Rapunzel: _writer.Enum("Rapunzel"); break;
+    case Character_Belle: _writer.Enum("Belle"); break;
+    case Character_BookFan: _writer.Enum("BookFan"); break;
+    case Character_Other: _writer.Enum("Other"); break;
+    case Character_Unused: _writer.Enum("Unused"); break;
+    default: _writer.Number(static_cast<uint8_t>(_e)); break;
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Character *_e) {
+  static const char * const names[] = {
+    "NONE",
+    "MuLan",
+    "Rapunzel",
+    "Belle",
+    "BookFan",
+    "Other",
+    "Unused"
+  };
+  static const uint8_t values[] = {
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6
+  };
+  uint8_t _v = 0;
+  if (!_reader.Enum(&_v, names, values, 7)) return false;
+  *_e = static_cast<Character>(_v);
+  return true;
+}
+
+inline bool ToJson(const Attacker *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Attacker> *_o);
+inline bool ToJson(const Rapunzel *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, Rapunzel *_o);
+inline bool ToJson(const BookReader *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, BookReader *_o);
+inline bool ToJson(const Movie *_o, flatbuffers::JsonWriter &_writer);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Movie> *_o);
+
+inline bool ToJson(Character _type, const void *_obj, flatbuffers::JsonWriter &_writer) {
+  switch (_type) {
+    case Character_MuLan:
+      return ToJson(reinterpret_cast<const Attacker *>(_obj), _writer);
+    case Character_Rapunzel:
+      return ToJson(reinterpret_cast<const Rapunzel *>(_obj), _writer);
+    case Character_Belle:
+      return ToJson(reinterpret_cast<const BookReader *>(_obj), _writer);
+    case Character_BookFan:
+      return ToJson(reinterpret_cast<const BookReader *>(_obj), _writer);
+    case Character_Other:
+      return _writer.String(reinterpret_cast<const flatbuffers::String *>(_obj));
+    case Character_Unused:
+      return _writer.String(reinterpret_cast<const flatbuffers::String *>(_obj));
+    default: return false;
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, Character _type, flatbuffers::Offset<void> *_o) {
+  switch (_type) {
+    case Character_MuLan: {
+      flatbuffers::Offset<Attacker> _u;
+      if (!FromJson(_reader, _fbb, &_u)) return false;
+      *_o = _u.Union();
+      return true;
+    }
+    case Character_Rapunzel: {
+      Rapunzel _u;
+      if (!FromJson(_reader, &_u)) return false;
+      *_o = _fbb.CreateStruct(_u).Union();
+      return true;
+    }
+    case Character_Belle: {
+      BookReader _u;
+      if (!FromJson(_reader, &_u)) return false;
+      *_o = _fbb.CreateStruct(_u).Union();
+      return true;
+    }
+    case Character_BookFan: {
+      BookReader _u;
+      if (!FromJson(_reader, &_u)) return false;
+      *_o = _fbb.CreateStruct(_u).Union();
+      return true;
+    }
+    case Character_Other: {
+      if (!_reader.String()) return false;
+      *_o = _fbb.CreateString(_reader.str()).Union();
+      return true;
+    }
+    case Character_Unused: {
+      if (!_reader.String()) return false;
+      *_o = _fbb.CreateString(_reader.str()).Union();
+      return true;
+    }
+    default:
+      return _reader.Error("illegal type id for union: Character");
+  }
+}
+
+inline bool ToJson(const Attacker *_o, flatbuffers::JsonWriter &_writer) {
+  auto _t = reinterpret_cast<const flatbuffers::Table *>(_o);
+  _writer.StartObject();
+  if (_t->CheckField(Attacker::VT_SWORD_ATTACK_DAMAGE)) {
+    _writer.Key("sword_attack_damage");
+    _writer.Number(_o->sword_attack_damage());
+  }
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Attacker> *_o) {
+  int32_t _sword_attack_damage = 0;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("sword_attack_damage")) {
+      if (!_reader.Number(&_sword_attack_damage)) return false;
+    } else if (!_reader.SkipUnknownField()) {
+      return false;
+    }
+  }
+  if (!_reader.ok()) return false;
+  *_o = CreateAttacker(_fbb,
+      _sword_attack_damage);
+  return true;
+}
+
+inline bool ToJson(const Rapunzel *_o, flatbuffers::JsonWriter &_writer) {
+  _writer.StartObject();
+  _writer.Key("hair_length");
+  _writer.Number(_o->hair_length());
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Rapunzel *_o) {
+  int32_t _hair_length = 0;
+  size_t _fields = 0;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("hair_length")) {
+      if (!_reader.Number(&_hair_length)) return false;
+    } else {
+      if (!_reader.SkipUnknownField()) return false;
+      continue;
+    }
+    _fields++;
+  }
+  if (!_reader.ok()) return false;
+  if (_fields != 1) {
+    return _reader.Error("wrong number of fields in struct: Rapunzel");
+  }
+  *_o = Rapunzel(_hair_length);
+  return true;
+}
+
+inline bool ToJson(const BookReader *_o, flatbuffers::JsonWriter &_writer) {
+  _writer.StartObject();
+  _writer.Key("books_read");
+  _writer.Number(_o->books_read());
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, BookReader *_o) {
+  int32_t _books_read = 0;
+  size_t _fields = 0;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("books_read")) {
+      if (!_reader.Number(&_books_read)) return false;
+    } else {
+      if (!_reader.SkipUnknownField()) return false;
+      continue;
+    }
+    _fields++;
+  }
+  if (!_reader.ok()) return false;
+  if (_fields != 1) {
+    return _reader.Error("wrong number of fields in struct: BookReader");
+  }
+  *_o = BookReader(_books_read);
+  return true;
+}
+
+inline bool ToJson(const Movie *_o, flatbuffers::JsonWriter &_writer) {
+  auto _t = reinterpret_cast<const flatbuffers::Table *>(_o);
+  _writer.StartObject();
+  if (_t->CheckField(Movie::VT_MAIN_CHARACTER_TYPE)) {
+    _writer.Key("main_character_type");
+    ToJson(static_cast<Character>(_o->main_character_type()), _writer);
+  }
+  if (_o->main_character()) {
+    _writer.Key("main_character");
+    if (!ToJson(_o->main_character_type(), _o->main_character(), _writer)) {
+      return false;
+    }
+  }
+  if (_o->characters_type()) {
+    _writer.Key("characters_type");
+    auto _vec = _o->characters_type();
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      ToJson(static_cast<Character>(_vec->Get(_i)), _writer);
+    }
+    _writer.EndArray();
+  }
+  if (_o->characters()) {
+    _writer.Key("characters");
+    auto _vec = _o->characters();
+    auto _types = _o->characters_type();
+    if (!_types || _types->size() != _vec->size()) return false;
+    _writer.StartArray();
+    for (flatbuffers::uoffset_t _i = 0; _i < _vec->size(); _i++) {
+      _writer.Element();
+      auto _type = static_cast<Character>(_types->Get(_i));
+      if (!ToJson(_type, _vec->Get(_i), _writer)) return false;
+    }
+    _writer.EndArray();
+  }
+  _writer.EndObject();
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Movie> *_o) {
+  Character _main_character_type = Character_NONE;
+  flatbuffers::Offset<void> _main_character;
+  const char *_main_character_mark = nullptr;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> _characters_type;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<void>>> _characters;
+  if (!_reader.StartObject()) return false;
+  while (_reader.NextKey()) {
+    if (_reader.KeyIs("main_character_type")) {
+      if (!FromJson(_reader, &_main_character_type)) return false;
+    } else if (_reader.KeyIs("main_character")) {
+      if (_reader.Null()) continue;
+      if (_main_character_type == Character_NONE) {
+        // The type comes after the value, so read the value at the end.
+        _main_character_mark = _reader.Mark();
+        if (!_reader.SkipValue()) return false;
+      } else if (!FromJson(_reader, _fbb, _main_character_type, &_main_character)) {
+        return false;
+      }
+    } else if (_reader.KeyIs("characters_type")) {
+      if (_reader.Null()) continue;
+      return _reader.Error("vectors of unions are not supported: characters_type");
+    } else if (_reader.KeyIs("characters")) {
+      if (_reader.Null()) continue;
+      return _reader.Error("vectors of unions are not supported: characters");
+    } else if (!_reader.SkipUnknownField()) {
+      return false;
+    }
+  }
+  if (!_reader.ok()) return false;
+  if (_main_character_mark) {
+    auto _end = _reader.Mark();
+    _reader.Rewind(_main_character_mark);
+    if (!FromJson(_reader, _fbb, _main_character_type, &_main_character)) {
+      return false;
+    }
+    _reader.Rewind(_end);
+  }
+  *_o = CreateMovie(_fbb,
+      _main_character_type,
+      _main_character,
+      _characters_type,
+      _characters);
+  return true;
+}
+
 inline const flatbuffers::TypeTable *CharacterTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_SEQUENCE, 0, -1 },
@@ -850,4 +1192,22 @@ inline flatbuffers::unique_ptr<MovieT> UnPackMovie(
   return flatbuffers::unique_ptr<MovieT>(GetMovie(buf)->UnPack(res));
 }
 
+inline bool MovieToJson(const void *buf, std::string *json) {
+  flatbuffers::JsonWriter writer(json);
+  return ToJson(GetMovie(buf), writer);
+}
+
+inline bool MovieFromJson(
+    const char *json, flatbuffers::FlatBufferBuilder &fbb,
+    std::string *error = nullptr) {
+  flatbuffers::JsonReader reader(json);
+  flatbuffers::Offset<Movie> root;
+  if (FromJson(reader, fbb, &root) && reader.ExpectEnd()) {
+    FinishMovieBuffer(fbb, root);
+    return true;
+  }
+  if (error) *error = reader.error();
+  return false;
+}
+
 #endif  // FLATBUFFERS_GENERATED_UNIONVECTOR_H_